@@ -9,6 +9,9 @@ include(cmake/googletest.cmake)
 include(cmake/boost.cmake)
 include(compiler_settings)
 
+find_package(Threads REQUIRED)
+set(DEPENDENCY_LIBRARIES ${DEPENDENCY_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
+
 include_directories(SYSTEM ${BOOST_INCLUDE_DIRS})
 
 # Common dependencies
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_ALGORITHMS_H
+#define PSS_ASTROTYPES_MULTIARRAY_ALGORITHMS_H
+
+#include <cstddef>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief Destinations of at least this many bytes are written with non-temporal (streaming) stores
+ * @details Such a destination would not fit in a typical last level cache, so writing it through the cache only
+ *          evicts data that is still useful. Where streaming stores are not available a plain copy/fill is used.
+ */
+constexpr std::size_t streaming_store_bytes = std::size_t(1) << 23;
+
+/**
+ * @brief copy each element of src into the corresponding element (in iteration order) of dst
+ * @details Works with any MultiArray or Slice types. The contiguous runs of memory of the two objects are
+ *          matched up and each pair copied in bulk (with memcpy where the element types are the same).
+ * @code
+ *      // copy a block of spectra between two TimeFrequency buffers
+ *      bulk_copy(tf_a.slice(DimensionSpan<Time>(DimensionIndex<Time>(0), DimensionSize<Time>(1024)))
+ *              , tf_b.slice(DimensionSpan<Time>(DimensionIndex<Time>(2048), DimensionSize<Time>(1024))));
+ * @endcode
+ * @throw std::invalid_argument if src and dst hold different numbers of elements
+ */
+template<typename SrcT, typename DstT>
+void bulk_copy(SrcT const& src, DstT&& dst);
+
+/**
+ * @brief set every element of data to value, a contiguous run at a time
+ */
+template<typename DataT, typename T>
+void bulk_fill(DataT&& data, T const& value);
+
+/**
+ * @brief return true if a and b hold the same number of elements and each is equal to the corresponding
+ *        element (in iteration order) of the other
+ * @details integer data is compared with memcmp
+ */
+template<typename DataA, typename DataB>
+bool bulk_equal(DataA const& a, DataB const& b);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Algorithms.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_ALGORITHMS_H
@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_ALIGNEDALLOCATOR_H
+#define PSS_ASTROTYPES_MULTIARRAY_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief Allocator that returns memory aligned to an Alignment byte boundary.
+ * @details The default of 64 bytes matches the cache line size and the widest (AVX-512) vector loads.
+ *          Suitable as the Alloc parameter of any of the MultiArray based types.
+ * @tparam Alignment must be a power of 2 and a multiple of sizeof(void*)
+ * @code
+ *      TimeFrequency<float, AlignedAllocator<float>> data(DimensionSize<Time>(100), DimensionSize<Frequency>(4096));
+ * @endcode
+ */
+template<typename LocalType, std::size_t Alignment=64>
+class AlignedAllocator
+{
+        static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2");
+        static_assert(Alignment % sizeof(void*) == 0, "Alignment must be a multiple of sizeof(void*)");
+
+    public:
+        using value_type = LocalType;
+        static constexpr std::size_t alignment = Alignment;
+
+        template<typename OtherType>
+        struct rebind {
+            typedef AlignedAllocator<OtherType, Alignment> other;
+        };
+
+        AlignedAllocator() noexcept = default;
+        template<typename OtherType> AlignedAllocator(AlignedAllocator<OtherType, Alignment> const &) noexcept {}
+
+        /**
+         * @brief Allocate an area of contiguos memory starting on an Alignment byte boundary.
+         * @param size Number of elements that the allocated memory area should fit
+         * @return Pointer to the allocated memory area
+         */
+        value_type * allocate(std::size_t size)
+        {
+            void* pointer = nullptr;
+            if(::posix_memalign(&pointer, Alignment, size * sizeof(value_type)) != 0) {
+                throw std::bad_alloc();
+            }
+            return static_cast<value_type *>(pointer);
+        }
+
+        /**
+         * @brief Free a previously allocated memory area.
+         * @param pointer Pointer to the memory area to deallocate
+         * @param size Number of elements that the allocated memory area should fit
+         */
+        void deallocate(value_type * pointer, std::size_t) noexcept
+        {
+            ::free(pointer);
+        }
+};
+
+template<typename LocalType, std::size_t Alignment>
+constexpr std::size_t AlignedAllocator<LocalType, Alignment>::alignment;
+
+/**
+ * @brief Allows to test for equivalence of AlignedAllocator objects.
+ */
+template<typename FirstType, typename SecondType, std::size_t Alignment>
+bool operator==(AlignedAllocator<FirstType, Alignment> const &, AlignedAllocator<SecondType, Alignment> const &) noexcept
+{
+    return true;
+}
+
+/**
+ * @brief Allows to test for diversity of AlignedAllocator objects.
+ */
+template<typename FirstType, typename SecondType, std::size_t Alignment>
+bool operator!=(AlignedAllocator<FirstType, Alignment> const &, AlignedAllocator<SecondType, Alignment> const &) noexcept
+{
+    return false;
+}
+
+} // namespace astrotypes
+} // namespace pss
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_ALIGNEDALLOCATOR_H
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_ARRAYREF_H
+#define PSS_ASTROTYPES_MULTIARRAY_ARRAYREF_H
+
+#include "DimensionIndex.h"
+#include "DimensionSize.h"
+#include "MultiArray.h"
+#include "TypeTraits.h"
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief
+ *      A lightweight, trivially copyable reference to the data of a MultiArray or Slice
+ *
+ * @details
+ *      Holds only a pointer and the extent and stride (in elements) of each dimension, so it is cheap
+ *      to construct, to pass by value (e.g. to another thread) and to hand to plain C kernels via
+ *      data(), extents() and strides(). Dimensions are ordered as in the array it was taken from.
+ *
+ *      The ArrayRef does not own the data: the array it was taken from must outlive it and must
+ *      not be resized while it is in use.
+ *
+ * @code
+ *      TimeFrequency<float> tf(DimensionSize<Time>(1024), DimensionSize<Frequency>(4096));
+ *      auto ref = make_array_ref(tf.slice(DimensionSpan<Frequency>(DimensionIndex<Frequency>(10), DimensionSize<Frequency>(100))));
+ *      c_kernel(ref.data(), ref.extents(), ref.strides());
+ *      float& value = ref(DimensionIndex<Frequency>(5), DimensionIndex<Time>(2));
+ * @endcode
+ */
+template<typename T, typename... Dimensions>
+class ArrayRef
+{
+    public:
+        typedef T value_type;
+        typedef T& reference_type;
+        typedef std::tuple<Dimensions...> DimensionTuple;
+        static constexpr std::size_t rank = sizeof...(Dimensions);
+        typedef std::array<std::size_t, rank> ExtentsType;
+
+    public:
+        ArrayRef();
+
+        /// a reference to contiguous data (the last Dimension varying fastest)
+        ArrayRef(T* data, DimensionSize<Dimensions>... extents);
+
+        /// a reference to strided data
+        ArrayRef(T* data, ExtentsType const& extents, ExtentsType const& strides);
+
+        /// conversion from non-const to const
+        template<typename OtherT, typename Enable=typename std::enable_if<std::is_same<OtherT const, T>::value && !std::is_same<OtherT, T>::value>::type>
+        ArrayRef(ArrayRef<OtherT, Dimensions...> const& other);
+
+        /// pointer to the first element
+        T* data() const;
+
+        /// the extent of each dimension in order
+        std::size_t const* extents() const;
+
+        /// the stride (in elements) of each dimension in order
+        std::size_t const* strides() const;
+
+        /// the size of the specified dimension
+        template<typename Dim>
+        DimensionSize<Dim> dimension() const;
+
+        /// the number of elements between consecutive indexes of the specified dimension
+        template<typename Dim>
+        std::size_t stride() const;
+
+        /// the total number of elements referenced
+        std::size_t data_size() const;
+
+        /// true if the elements form a single contiguous block
+        bool is_contiguous() const;
+
+        /**
+         * @brief access a single element
+         * @details the indexes can be given in any order, but all dimensions must be specified
+         */
+        template<typename... Dims>
+        T& operator()(DimensionIndex<Dims>... indexes) const;
+
+    private:
+        template<typename Dim, typename... Dims>
+        std::size_t offset(DimensionIndex<Dim> const& index, DimensionIndex<Dims> const&... indexes) const;
+        std::size_t offset() const;
+
+    private:
+        template<typename, typename...> friend class ArrayRef;
+
+        T* _data;
+        ExtentsType _extents;
+        ExtentsType _strides;
+};
+
+/**
+ * @brief the type of ArrayRef returned by make_array_ref for the DataT
+ * @details the dimensions are those of DataT::DimensionTuple and the element type is const if DataT is
+ */
+template<typename DataT>
+struct ArrayRefType;
+
+/**
+ * @brief an ArrayRef to the data of a MultiArray, Slice or any type derived from them
+ * @details the cost is independent of the size of the data
+ */
+template<typename DataT>
+typename ArrayRefType<DataT>::type make_array_ref(DataT&& data);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/ArrayRef.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_ARRAYREF_H
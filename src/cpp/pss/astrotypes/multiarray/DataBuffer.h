@@ -29,6 +29,16 @@
 namespace pss {
 namespace astrotypes {
 
+/**
+ * @brief tag to request that newly allocated elements are left uninitialised
+ * @details Only has an effect for trivial types (float, uint8_t, ...). Use it when every element will
+ *          be overwritten anyway (e.g. reading data from a file) to avoid touching the memory twice.
+ *      @code
+ *      TimeFrequency<uint8_t> data(NoInitialisation(), DimensionSize<Time>(8192), DimensionSize<Frequency>(4096));
+ *      @endcode
+ */
+struct NoInitialisation {};
+
 namespace detail {
     template<typename T, typename Alloc, bool use_std_vec=!std::is_trivial<T>::value>
     class DataBufferImpl {
@@ -39,6 +49,8 @@ namespace detail {
     {
         public:
             using std::vector<T,Alloc>::vector;
+
+            void resize_initialised(std::size_t size) { this->resize(size); }
     };
 
     // easily initialise allocator ond its state info
@@ -51,6 +63,7 @@ namespace detail {
                 AllocatedMemory(Alloc& alloc, std::size_t capacity);
                 AllocatedMemory(Alloc& alloc);
                 AllocatedMemory(AllocatedMemory&& mem);
+                AllocatedMemory(AllocatedMemory&& mem, Alloc& alloc);
                 ~AllocatedMemory();
                 AllocatedMemory& operator=(AllocatedMemory&&);
 
@@ -115,12 +128,16 @@ namespace detail {
             std::size_t capacity() const;
             std::size_t size() const;
 
-            std::size_t max_size();
+            std::size_t max_size() const;
+            bool empty() const;
 
             void resize(std::size_t size);
             void resize(std::size_t size, T const& value);
             void reserve(std::size_t s);
 
+            /// resize, default constructing any new elements with the allocator (as std::vector::resize)
+            void resize_initialised(std::size_t size);
+
             // data access
             T& operator[](std::size_t n);
             T const& operator[](std::size_t n) const;
@@ -132,6 +149,9 @@ namespace detail {
             const T* cbegin() const;
             const T* cend() const;
 
+            T* data();
+            T const* data() const;
+
             T& front() { return *begin(); }
             T const& front() const { return *begin(); }
             T& back() { return *(end() - 1); }
@@ -183,6 +203,8 @@ class DataBuffer : public detail::DataBufferImpl<T, Alloc>
     public:
         template<typename... Args>
         DataBuffer(Args&&...);
+        DataBuffer(DataBuffer const&);
+        DataBuffer(DataBuffer&&);
         ~DataBuffer();
 };
 
@@ -32,9 +32,15 @@ namespace astrotypes {
 
 /**
  * @brief
- *      Defines a contiguous range over dimension in index
+ *      Defines a range over dimension in index
  *
  * @details
+ *      The range is contiguous by default. A stride can be specified to select every stride'th index
+ *      starting from start(), e.g. every 4th spectrum
+ * @code
+ *      DimensionSpan<Time> span(DimensionIndex<Time>(10), DimensionSize<Time>(100), 4); // 10, 14, 18, ... 406
+ * @endcode
+ *      span() is always the number of indices selected.
  */
 
 template<typename Dimension>
@@ -43,17 +49,25 @@ class DimensionSpan
     public:
         DimensionSpan(DimensionIndex<Dimension> start_index, DimensionIndex<Dimension> end_index);
         DimensionSpan(DimensionIndex<Dimension> start_index, DimensionSize<Dimension> size);
+        /// select size indices, stride apart, beginning at start_index
+        /// @throw std::invalid_argument if stride is 0
+        DimensionSpan(DimensionIndex<Dimension> start_index, DimensionSize<Dimension> size, std::size_t stride);
         /// convenience operator, start_index will be set to 0
         DimensionSpan(DimensionSize<Dimension> size);
 
         inline DimensionIndex<Dimension>&         start() { return _start_index; }
         inline DimensionIndex<Dimension> const&   start() const { return _start_index; };
         inline void                               start(DimensionIndex<Dimension> s) { _start_index = s; }
-        inline DimensionIndex<Dimension>          end() const { return _start_index + (_span - 1); }
-        inline void                               end(DimensionIndex<Dimension> const& end) { _span = end - _start_index + 1; }
+        /// the last index in the span
+        inline DimensionIndex<Dimension>          end() const { return _start_index + DimensionSize<Dimension>((static_cast<std::size_t>(_span) - 1) * _stride); }
+        inline void                               end(DimensionIndex<Dimension> const& end) { _span = DimensionSize<Dimension>(static_cast<std::size_t>(end - _start_index) / _stride + 1); }
         inline DimensionSize<Dimension>&          span() { return _span; };
         inline DimensionSize<Dimension> const&    span() const { return _span; };
         inline void                               span(DimensionSize<Dimension> s) { _span = s; }
+        /// the number of indices between consecutive elements of the span (1 for a contiguous span)
+        inline std::size_t                        stride() const { return _stride; }
+        /// @throw std::invalid_argument if s is 0
+        void                                      stride(std::size_t s);
 
         /// ensure the span fits within the size provided
         inline DimensionSpan<Dimension>&          trim(DimensionSize<Dimension> bounds);
@@ -64,6 +78,7 @@ class DimensionSpan
     private:
         DimensionIndex<Dimension> _start_index;
         DimensionSize<Dimension>  _span;
+        std::size_t               _stride;
 };
 
 
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_EXECUTOR_H
+#define PSS_ASTROTYPES_MULTIARRAY_EXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief Executes tasks one after the other on the calling thread
+ * @details Executors provide a single method
+ *          @code
+ *              template<typename FunctionT>
+ *              void parallel_for(std::size_t number_of_tasks, FunctionT const& fn);
+ *          @endcode
+ *          that calls fn(task_index) for each task_index in [0, number_of_tasks) and returns when all the
+ *          tasks are complete, along with concurrency() to report the number of tasks that may run at once.
+ *          Any executor type with this interface can be used with the parallel algorithms.
+ */
+class SerialExecutor
+{
+    public:
+        /// the number of tasks that can be run concurrently
+        std::size_t concurrency() const;
+
+        /// call fn(task_index) for each task
+        template<typename FunctionT>
+        void parallel_for(std::size_t number_of_tasks, FunctionT const& fn);
+};
+
+/**
+ * @brief Executes tasks on a fixed pool of threads
+ * @details The calling thread also takes part in executing the tasks, so a pool of N threads
+ *          starts N-1 worker threads. Tasks are handed out dynamically to balance the load.
+ *          If any task throws, the first exception is rethrown from parallel_for once all the
+ *          other tasks have completed.
+ *          Calls to parallel_for from different threads are serialised. A task may itself call
+ *          parallel_for on the same executor (e.g. through one of the parallel algorithms); the
+ *          nested call runs all its tasks on the thread making it. The same applies to a call from
+ *          a task of another ThreadPoolExecutor that finds this pool busy, as waiting could deadlock.
+ */
+class ThreadPoolExecutor
+{
+    public:
+        /**
+         * @param number_of_threads the total number of threads (including the calling thread) to use
+         */
+        explicit ThreadPoolExecutor(std::size_t number_of_threads = std::thread::hardware_concurrency());
+        ThreadPoolExecutor(ThreadPoolExecutor const&) = delete;
+        ThreadPoolExecutor& operator=(ThreadPoolExecutor const&) = delete;
+        ~ThreadPoolExecutor();
+
+        /// the number of tasks that can be run concurrently
+        std::size_t concurrency() const;
+
+        /// call fn(task_index) for each task, distributed over the threads in the pool
+        template<typename FunctionT>
+        void parallel_for(std::size_t number_of_tasks, FunctionT const& fn);
+
+    private:
+        /// marks the tasks of an executor as running on the current thread, so that nested calls can be detected
+        class TaskScope
+        {
+            public:
+                explicit TaskScope(ThreadPoolExecutor const* executor);
+                ~TaskScope();
+                TaskScope(TaskScope const&) = delete;
+                TaskScope& operator=(TaskScope const&) = delete;
+
+                /// true if the current thread is running a task of executor
+                static bool running(ThreadPoolExecutor const* executor);
+
+                /// true if the current thread is running a task of any ThreadPoolExecutor
+                static bool running();
+
+            private:
+                static TaskScope const*& current();
+
+            private:
+                ThreadPoolExecutor const* _executor;
+                TaskScope const* _previous;
+        };
+
+    private:
+        void run_tasks(std::size_t generation);
+        void worker();
+        void execute(std::size_t number_of_tasks, std::function<void(std::size_t)> const& fn);
+
+    private:
+        std::vector<std::thread> _threads;
+        std::mutex _call_mutex;
+
+        std::mutex _mutex;
+        std::condition_variable _start_condition;
+        std::condition_variable _done_condition;
+        std::function<void(std::size_t)> const* _task;
+        std::size_t _number_of_tasks;
+        std::atomic<std::size_t> _next_task;
+        std::size_t _tasks_completed;
+        std::size_t _active_threads;
+        std::size_t _generation;
+        bool _stop;
+        std::exception_ptr _exception;
+};
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Executor.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_EXECUTOR_H
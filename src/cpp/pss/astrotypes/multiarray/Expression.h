@@ -0,0 +1,286 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_EXPRESSION_H
+#define PSS_ASTROTYPES_MULTIARRAY_EXPRESSION_H
+
+#include "MultiArray.h"
+#include "Slice.h"
+#include "ParallelAlgorithms.h"
+#include "TypeTraits.h"
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+    template<typename PointerT, std::size_t Rank> class ArrayEvaluator;
+    template<typename OpT, typename EvaluatorT> class UnaryEvaluator;
+    template<typename OpT, typename LhsEvaluatorT, typename RhsEvaluatorT> class BinaryEvaluator;
+
+    // element wise operations
+    struct Add;
+    struct Subtract;
+    struct Multiply;
+    struct Divide;
+    struct Negate;
+
+    // maps an argument of an operator to its expression type (e.g. an ArrayOperand or ScalarOperand)
+    template<typename T, typename Enable=void> struct Operand;
+
+    // true if the arguments of a binary operator should generate an expression
+    template<typename LhsT, typename RhsT> struct is_expression_arguments;
+} // namespace detail
+
+/**
+ * @brief Lazy element-wise arithmetic over MultiArray and Slice types
+ * @details Combining MultiArrays, Slices and scalars with + - * / (or unary -) does not
+ *          calculate anything. Instead a lightweight expression object is built that
+ *          records its operands (MultiArrays by reference, Slices and scalars by value).
+ *          The expression is evaluated in a single fused pass, without temporaries, when
+ *          it is assigned to a destination with assign() or parallel_assign().
+ *
+ *          Operands are matched by their named dimensions rather than their position.
+ *          An operand that is missing some of the destinations dimensions is broadcast
+ *          along them, so e.g. a per channel bandpass (a spectrum, with only
+ *          units::Frequency) can be applied to every spectrum of a TimeFrequency block.
+ *          The dimension order of an operand may also differ from that of the destination.
+ *          Using an expression with a dimension the destination does not have is a compile time error.
+ *          Dimensions the operands share must have the same size as the destinations, or
+ *          std::invalid_argument is thrown at assignment.
+ *
+ * @code
+ *      TimeFrequency<float> data(...);
+ *      TimeFrequency<float> calibration(DimensionSize<units::Time>(2), data.dimension<units::Frequency>());
+ *      auto bandpass = calibration[DimensionIndex<units::Time>(0)]; // has only units::Frequency
+ *      auto scale = calibration[DimensionIndex<units::Time>(1)];
+ *
+ *      // (data - bandpass) * scale for every spectrum, in one pass
+ *      assign(data, (data - bandpass) * scale);
+ *
+ *      // the same spread over several threads
+ *      ThreadPoolExecutor executor;
+ *      parallel_assign(executor, data, (data - bandpass) * scale);
+ * @endcode
+ *
+ *      The destination may appear in the expression as long as each element only depends
+ *      on the destination element at the same position (as above).
+ */
+class ExpressionTag
+{
+};
+
+/**
+ * @brief true if T is an expression type
+ */
+template<typename T>
+struct is_expression : public std::is_base_of<ExpressionTag, typename std::decay<T>::type>
+{
+};
+
+/**
+ * @brief true if T is a MultiArray or Slice type that can be used as an expression operand
+ */
+template<typename T>
+struct is_expression_array : public std::integral_constant<bool, is_multiarray<T>::value || is_slice<T>::value>
+{
+};
+
+/**
+ * @brief An expression leaf referring to the data of a MultiArray or Slice
+ */
+template<typename ArrayT>
+class ArrayOperand : public ExpressionTag
+{
+        // Slices are lightweight views and may be temporaries, MultiArrays are held by reference
+        typedef typename std::conditional<is_slice<ArrayT>::value, ArrayT, ArrayT const&>::type StorageType;
+
+    public:
+        typedef typename ArrayT::DimensionTuple DimensionTuple;
+        typedef typename std::decay<decltype(*std::declval<ArrayT const&>().begin())>::type value_type;
+
+        /// the type returned by evaluator() for a destination of the given rank
+        template<std::size_t Rank>
+        using Evaluator = detail::ArrayEvaluator<value_type const*, Rank>;
+
+    public:
+        explicit ArrayOperand(ArrayT const& array);
+
+        /**
+         * @brief return an object that can generate the values of this expression
+         *        for a destination with the dimensions and sizes provided
+         */
+        template<typename... DstDimensions>
+        Evaluator<sizeof...(DstDimensions)> evaluator(std::tuple<DstDimensions...> const*
+                                                     , std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const;
+
+    private:
+        StorageType _array;
+};
+
+/**
+ * @brief An expression leaf that has the same value for every element
+ */
+template<typename T>
+class ScalarOperand : public ExpressionTag
+{
+    public:
+        typedef std::tuple<> DimensionTuple;
+        typedef T value_type;
+
+        template<std::size_t Rank>
+        using Evaluator = ScalarOperand;
+
+    public:
+        explicit ScalarOperand(T const& value);
+
+        template<typename... DstDimensions>
+        ScalarOperand evaluator(std::tuple<DstDimensions...> const*
+                               , std::array<std::size_t, sizeof...(DstDimensions)> const&) const;
+
+        /// the value for each position in the current row
+        template<bool UnitStride>
+        T const& at(std::size_t) const { return _value; }
+
+        /// called when the row changes
+        template<std::size_t Rank>
+        void row(std::array<std::size_t, Rank> const&) {}
+
+        /// true if the at() can be called with UnitStride=true
+        constexpr bool unit_stride() const { return true; }
+
+    private:
+        T _value;
+};
+
+/**
+ * @brief An expression applying the unary function OpT to each element of another expression
+ */
+template<typename OpT, typename ExpressionT>
+class UnaryExpression : public ExpressionTag
+{
+    public:
+        typedef typename ExpressionT::DimensionTuple DimensionTuple;
+        typedef typename std::decay<decltype(std::declval<OpT const&>()(std::declval<typename ExpressionT::value_type const&>()))>::type value_type;
+
+        template<std::size_t Rank>
+        using Evaluator = detail::UnaryEvaluator<OpT, typename ExpressionT::template Evaluator<Rank>>;
+
+    public:
+        explicit UnaryExpression(ExpressionT const& expression);
+
+        template<typename... DstDimensions>
+        Evaluator<sizeof...(DstDimensions)> evaluator(std::tuple<DstDimensions...> const* tag, std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const;
+
+    private:
+        ExpressionT _expression;
+};
+
+/**
+ * @brief An expression applying the binary function OpT to each pair of elements of two other expressions
+ * @details The dimensions of the expression are the union of the dimensions of its operands
+ */
+template<typename OpT, typename LhsT, typename RhsT>
+class BinaryExpression : public ExpressionTag
+{
+    public:
+        typedef typename unique_tuple<typename LhsT::DimensionTuple, typename RhsT::DimensionTuple>::type DimensionTuple;
+        typedef typename std::decay<decltype(std::declval<OpT const&>()(std::declval<typename LhsT::value_type const&>()
+                                                                       , std::declval<typename RhsT::value_type const&>()))>::type value_type;
+
+        template<std::size_t Rank>
+        using Evaluator = detail::BinaryEvaluator<OpT, typename LhsT::template Evaluator<Rank>, typename RhsT::template Evaluator<Rank>>;
+
+    public:
+        BinaryExpression(LhsT const& lhs, RhsT const& rhs);
+
+        template<typename... DstDimensions>
+        Evaluator<sizeof...(DstDimensions)> evaluator(std::tuple<DstDimensions...> const* tag, std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const;
+
+    private:
+        LhsT _lhs;
+        RhsT _rhs;
+};
+
+/**
+ * @brief the expression types generated by the arithmetic operators
+ * @details Only enabled when at least one argument is an expression, MultiArray or Slice.
+ *          Any other argument is treated as a scalar.
+ */
+template<typename LhsT, typename RhsT>
+using AddExpression = BinaryExpression<detail::Add, typename detail::Operand<LhsT>::type, typename detail::Operand<RhsT>::type>;
+template<typename LhsT, typename RhsT>
+using SubtractExpression = BinaryExpression<detail::Subtract, typename detail::Operand<LhsT>::type, typename detail::Operand<RhsT>::type>;
+template<typename LhsT, typename RhsT>
+using MultiplyExpression = BinaryExpression<detail::Multiply, typename detail::Operand<LhsT>::type, typename detail::Operand<RhsT>::type>;
+template<typename LhsT, typename RhsT>
+using DivideExpression = BinaryExpression<detail::Divide, typename detail::Operand<LhsT>::type, typename detail::Operand<RhsT>::type>;
+template<typename T>
+using NegateExpression = UnaryExpression<detail::Negate, typename detail::Operand<T>::type>;
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, AddExpression<LhsT, RhsT>>::type
+operator+(LhsT const& lhs, RhsT const& rhs);
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, SubtractExpression<LhsT, RhsT>>::type
+operator-(LhsT const& lhs, RhsT const& rhs);
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, MultiplyExpression<LhsT, RhsT>>::type
+operator*(LhsT const& lhs, RhsT const& rhs);
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, DivideExpression<LhsT, RhsT>>::type
+operator/(LhsT const& lhs, RhsT const& rhs);
+
+template<typename T>
+typename std::enable_if<is_expression<T>::value || is_expression_array<T>::value, NegateExpression<T>>::type
+operator-(T const& operand);
+
+/**
+ * @brief evaluate expression for every element of dst
+ * @details expression may be any expression, MultiArray, Slice or scalar.
+ *          dst may be any MultiArray or Slice type.
+ * @throw std::invalid_argument if the size of a dimension of an operand does not match that of dst
+ */
+template<typename DstT, typename ExpressionT>
+void assign(DstT&& dst, ExpressionT const& expression);
+
+/**
+ * @brief evaluate expression for every element of dst, spreading the work over the executor
+ * @details dst is partitioned along its outermost dimension (see parallel_fill)
+ * @throw std::invalid_argument if the size of a dimension of an operand does not match that of dst
+ */
+template<typename ExecutorT, typename DstT, typename ExpressionT>
+void parallel_assign(ExecutorT& executor, DstT&& dst, ExpressionT const& expression);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Expression.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_EXPRESSION_H
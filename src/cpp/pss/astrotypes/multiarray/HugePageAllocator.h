@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_HUGEPAGEALLOCATOR_H
+#define PSS_ASTROTYPES_MULTIARRAY_HUGEPAGEALLOCATOR_H
+
+#include <cstddef>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief How the HugePageAllocator should obtain huge pages.
+ */
+enum class HugePagePolicy {
+    Transparent,
+    HugeTlb
+};
+
+/**
+ * @brief Allocator for large blocks backed by huge pages, optionally bound to a NUMA node.
+ * @details Iterating over multi GB TimeFrequency blocks with 4kB pages costs a TLB miss every
+ *          4kB. Blocks of at least huge_page_size bytes are mapped directly (2MB aligned) with
+ *          either
+ *            - HugePagePolicy::Transparent : madvise(MADV_HUGEPAGE) so the kernel backs the block
+ *                                            with transparent huge pages where it can
+ *            - HugePagePolicy::HugeTlb     : MAP_HUGETLB from the reserved hugetlbfs pool of huge_page_size
+ *                                            pages. If none are reserved (or the platform cannot select
+ *                                            the page size) this falls back to Transparent.
+ *          If a numa_node is given the block is bound to that node (mbind) before it is touched.
+ *          This is a best effort hint and is ignored on systems without NUMA support.
+ *
+ *          Smaller blocks are allocated from the heap with 64 byte alignment, as are all blocks on
+ *          platforms without mmap.
+ *
+ * @code
+ *      HugePageAllocator<uint8_t> allocator(HugePagePolicy::Transparent, 0); // node 0
+ *      TimeFrequency<uint8_t, HugePageAllocator<uint8_t>> data(allocator, DimensionSize<Time>(1<<20), DimensionSize<Frequency>(4096));
+ * @endcode
+ */
+template<typename LocalType>
+class HugePageAllocator
+{
+    public:
+        using value_type = LocalType;
+
+        /// size of the huge pages assumed for alignment and the threshold for using them
+        static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+        /// use when no NUMA binding is required
+        static constexpr int any_numa_node = -1;
+
+    public:
+        HugePageAllocator(HugePagePolicy policy = HugePagePolicy::Transparent, int numa_node = any_numa_node) noexcept;
+        template<typename OtherType> HugePageAllocator(HugePageAllocator<OtherType> const &) noexcept;
+
+        /**
+         * @brief Allocate an area of contiguos memory.
+         * @param size Number of elements that the allocated memory area should fit
+         * @return Pointer to the allocated memory area
+         * @throw std::bad_alloc
+         */
+        value_type * allocate(std::size_t size);
+
+        /**
+         * @brief Free a previously allocated memory area.
+         * @param pointer Pointer to the memory area to deallocate
+         * @param size Number of elements that the allocated memory area should fit
+         */
+        void deallocate(value_type * pointer, std::size_t size) noexcept;
+
+        /// the huge page policy for large blocks
+        HugePagePolicy policy() const;
+
+        /// the NUMA node large blocks are bound to (or any_numa_node)
+        int numa_node() const;
+
+    private:
+        HugePagePolicy _policy;
+        int _numa_node;
+};
+
+/**
+ * @brief Allocators are equivalent if they share the same policy and NUMA node.
+ */
+template<typename FirstType, typename SecondType>
+bool operator==(HugePageAllocator<FirstType> const &, HugePageAllocator<SecondType> const &) noexcept;
+
+/**
+ * @brief Allows to test for diversity of HugePageAllocator objects.
+ */
+template<typename FirstType, typename SecondType>
+bool operator!=(HugePageAllocator<FirstType> const &, HugePageAllocator<SecondType> const &) noexcept;
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/HugePageAllocator.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_HUGEPAGEALLOCATOR_H
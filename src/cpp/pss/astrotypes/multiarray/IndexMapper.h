@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -24,48 +24,97 @@
 #ifndef PSS_ASTROTYPES_MULTIARRAY_INDEXMAPPER_H
 #define PSS_ASTROTYPES_MULTIARRAY_INDEXMAPPER_H
 
-#include "NumericalRepresentation.h"
+#include "DimensionIndex.h"
+#include "DimensionSize.h"
+#include <cstddef>
+#include <vector>
 
 namespace pss {
 namespace astrotypes {
+namespace multiarray {
 
 /**
  * @brief
- *      Maps indexes from one container onto another
+ *      Maps the indexes of a single dimension of a View onto those of the underlying data
  *
  * @details
+ *      The map is either affine (source = start + i * step, where step may be negative) or
+ *      an arbitrary table of source indexes.
+ *      The map is also summarised as runs of consecutive (ascending or descending) source indexes
+ *      so that copies through the map can be made a block at a time.
  * @code
- * bool   flags[100];
- * MultiContainer<2, int> c1(10, 10);
- * auto im = make_IndexMapper(flags, c1);
- *
- * auto it = c1.begin();
- * im(it) = true;
+ *      // flip the band
+ *      auto flip = IndexMapper<Frequency>::reverse(tf.dimension<Frequency>());
  *
+ *      // drop flagged channels
+ *      std::vector<bool> flags(tf.number_of_channels(), false);
+ *      flags[10] = true;
+ *      auto unflagged = IndexMapper<Frequency>::exclude_flagged(flags);
  * @endcode
  */
-
-template<typename DestinationContainer, typename SrcContainerType>
+template<typename Dimension>
 class IndexMapper
 {
-        typedef typename NumericalRepresentation<DestinationContainer>::type T;
-        typedef typename SrcContainerType::Iterator Iterator;
+    public:
+        /**
+         * @brief a run of consecutive mapped indexes
+         * @details view indexes [start, start + length) map to source_start, source_start + 1, ...
+         *          or source_start, source_start - 1, ... if reversed
+         */
+        struct Run {
+            std::size_t start;
+            std::size_t source_start;
+            std::size_t length;
+            bool reversed;
+        };
 
     public:
-        IndexMapper(DestinationContainer& container, SrcContainerType const& view);
+        /// the identity map
+        explicit IndexMapper(DimensionSize<Dimension> size);
+
+        /// an affine map i -> start + i * step
+        IndexMapper(DimensionIndex<Dimension> start, long step, DimensionSize<Dimension> size);
+
+        /// a table of source indexes, one for each index of the view
+        explicit IndexMapper(std::vector<std::size_t> table);
+
         ~IndexMapper();
 
-        T& operator()(IteratorType) const;
+        /// the map that reverses the order of the dimension (e.g. to flip a band with a negative channel width)
+        static IndexMapper reverse(DimensionSize<Dimension> size);
+
+        /**
+         * @brief a map that drops every index whose flag is set
+         * @param flags any container of values convertible to bool, one for each index of the source
+         */
+        template<typename FlagsT>
+        static IndexMapper exclude_flagged(FlagsT const& flags);
+
+        /// @brief the source index corresponding to the view index
+        DimensionIndex<Dimension> operator()(DimensionIndex<Dimension> index) const;
+        std::size_t operator()(std::size_t index) const;
+
+        /// @brief the size of the view dimension
+        DimensionSize<Dimension> size() const;
+
+        /// @brief true if every mapped index is less than source_size
+        bool fits(DimensionSize<Dimension> source_size) const;
+
+        /// @brief the map as runs of consecutive source indexes, in view order
+        std::vector<Run> const& runs() const;
 
     private:
-};
+        void add_runs();
 
-template<typename DestinationContainer, typename SrcContainerType>
-IndexMapper<DestinationContainer, SrcContainerType> make_IndexMapper(DestinationContainer& dst, SrcContainerType const& src)
-{
-    return IndexMapper<DestinationContainer, SrcContainerType>(dst, src);
-}
+    private:
+        std::size_t _size;
+        std::size_t _start;
+        long _step;
+        std::vector<std::size_t> _table; // empty for an affine map
+        std::vector<Run> _runs;
+};
 
+} // namespace multiarray
 } // namespace astrotypes
 } // namespace pss
 #include "detail/IndexMapper.cpp"
@@ -26,8 +26,10 @@
 
 #include "Slice.h"
 #include "DimensionSize.h"
+#include "StaticDimensionSize.h"
 #include "DimensionIndex.h"
 #include "DataBuffer.h"
+#include "Transpose.h"
 #include <vector>
 
 namespace pss {
@@ -64,7 +66,7 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
         typedef typename BaseT::value_type value_type;
 
     public:
-         typedef std::tuple<FirstDimension, OtherDimensions...> DimensionTuple;
+         typedef std::tuple<DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...> DimensionTuple;
 
         /**
           * @brief provides a template to determine the returned type of an operator[]
@@ -93,10 +95,10 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
         template<typename SliceInputType>
         struct ConstSliceReturnType;
 
-        typedef SliceMixin<Slice<false, SelfType, SliceMixin, FirstDimension, OtherDimensions...>> SliceType;
-        typedef SliceMixin<Slice<true, SelfType, SliceMixin, FirstDimension, OtherDimensions...>> ConstSliceType;
-        typedef typename SliceType::template OperatorSliceType<FirstDimension>::type ReducedDimensionSliceType;
-        typedef typename ConstSliceType::template ConstOperatorSliceType<FirstDimension>::type ConstReducedDimensionSliceType;
+        typedef SliceMixin<Slice<false, SelfType, SliceMixin, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>> SliceType;
+        typedef SliceMixin<Slice<true, SelfType, SliceMixin, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>> ConstSliceType;
+        typedef typename SliceType::template OperatorSliceType<DimensionTag<FirstDimension>>::type ReducedDimensionSliceType;
+        typedef typename ConstSliceType::template ConstOperatorSliceType<DimensionTag<FirstDimension>>::type ConstReducedDimensionSliceType;
 
         typedef T& reference_type;
         typedef T const& const_reference_type;
@@ -107,6 +109,21 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
         template<typename Dim, typename... Dims>
         MultiArray(DimensionSize<Dim> size, DimensionSize<Dims>... sizes);
 
+        /// @brief construct using a specific allocator instance (e.g. for stateful allocators)
+        template<typename Dim, typename... Dims>
+        MultiArray(Alloc const& allocator, DimensionSize<Dim> size, DimensionSize<Dims>... sizes);
+
+        /**
+         * @brief construct without initialising the data
+         * @details for trivial types the data is left as found in memory. Use when every element is
+         *          about to be overwritten (e.g. when reading from a file)
+         */
+        template<typename Dim, typename... Dims>
+        MultiArray(NoInitialisation const&, DimensionSize<Dim> size, DimensionSize<Dims>... sizes);
+
+        template<typename Dim, typename... Dims>
+        MultiArray(NoInitialisation const&, Alloc const& allocator, DimensionSize<Dim> size, DimensionSize<Dims>... sizes);
+
         /// copy operator needs to be called explicitly as this is an expensive operation
         explicit MultiArray(MultiArray const&) = default;
 
@@ -114,8 +131,8 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
         //  @details will copy the memory from the object tranposing it in the process
         //  to the required memory order
         template<typename DimensionType, typename Enable=typename std::enable_if<
-                   has_dimensions<DimensionType, FirstDimension, OtherDimensions...>::value
-                && !has_exact_dimensions<FirstDimension, OtherDimensions...>::value>::type>
+                   has_dimensions<DimensionType, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>::value
+                && !has_exact_dimensions<DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>::value>::type>
         explicit MultiArray(DimensionType const&);
 
         static constexpr std::size_t rank = 1 + sizeof...(OtherDimensions);
@@ -124,7 +141,7 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          * @brief return true if this slice has dimesion D
          */
         template<typename D>
-        static constexpr bool has_dimension() { return has_type<std::tuple<FirstDimension, OtherDimensions...>, D>::value; }
+        static constexpr bool has_dimension() { return has_type<std::tuple<DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>, D>::value; }
 
         /**
          * @brief iterators acting over he entire data structure
@@ -154,21 +171,46 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          * }
          * @endcode
          */
-        ReducedDimensionSliceType operator[](DimensionIndex<FirstDimension> index);
-        ConstReducedDimensionSliceType operator[](DimensionIndex<FirstDimension> index) const;
+        ReducedDimensionSliceType operator[](DimensionIndex<DimensionTag<FirstDimension>> index);
+        ConstReducedDimensionSliceType operator[](DimensionIndex<DimensionTag<FirstDimension>> index) const;
 
         template<typename Dim>
         typename std::enable_if<astrotypes::has_dimension<MultiArray, Dim>::value
-                            && !std::is_same<Dim, FirstDimension>::value
+                            && !std::is_same<Dim, DimensionTag<FirstDimension>>::value
                             , typename OperatorSliceType<Dim>::type>::type
         operator[](DimensionIndex<Dim> const&);
 
         template<typename Dim>
         typename std::enable_if<astrotypes::has_dimension<MultiArray, Dim>::value
-                            && !std::is_same<Dim, FirstDimension>::value
+                            && !std::is_same<Dim, DimensionTag<FirstDimension>>::value
                             , typename ConstOperatorSliceType<Dim>::type>::type
         operator[](DimensionIndex<Dim> const&) const;
 
+        /**
+         * @brief direct access to a single element
+         * @details The indexes can be given in any order, but all dimensions must be specified.
+         *          Unlike chained operator[] calls no intermediate slices are constructed: the offset
+         *          is calculated directly from the strides of each dimension (cached on resize).
+         * @code
+         * tf(DimensionIndex<Frequency>(10), DimensionIndex<Time>(2)) = 1;
+         * @endcode
+         */
+        template<typename... Dims>
+        reference_type operator()(DimensionIndex<Dims>... indexes);
+
+        template<typename... Dims>
+        const_reference_type operator()(DimensionIndex<Dims>... indexes) const;
+
+        /**
+         * @brief as operator() but with bounds checking
+         * @throw std::out_of_range if any index is outside the array
+         */
+        template<typename... Dims>
+        reference_type at(DimensionIndex<Dims>... indexes);
+
+        template<typename... Dims>
+        const_reference_type at(DimensionIndex<Dims>... indexes) const;
+
         /**
          * @brief return a slice of the specified dimension spanning the index_range provided
          * @details no bonuds checking is performed. Undefined behaviour can result from requests
@@ -200,13 +242,13 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          * @details specialisation where Dimensions match that of the slice.
          */
         template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-        SliceType overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, OtherDimensions...>> const&);
+        SliceType overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>> const&);
 
         template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-        SliceType overlay(Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, OtherDimensions...> const&);
+        SliceType overlay(Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...> const&);
 
         template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-        ConstSliceType overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, OtherDimensions...>> const&) const;
+        ConstSliceType overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>> const&) const;
 
         template<typename SliceArgType>
         typename SliceReturnType<SliceArgType>::type overlay(SliceArgType const& slice);
@@ -241,6 +283,46 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
         template<typename Dim, typename... Dimensions>
         void resize(DimensionSize<Dim>, DimensionSize<Dimensions>... size, T const& value);
 
+        /**
+         * @brief resize the array in the specified dimensions leaving any new elements uninitialised (for trivial types)
+         */
+        template<typename... Dimensions>
+        void resize(NoInitialisation const&, DimensionSize<Dimensions>... size);
+
+        /**
+         * @brief reserve storage for an array of the specified size without changing its current size or data
+         * @details dimensions not specified are taken at their current size.
+         *          Storage is never released by reserve or by resizing to a smaller size, so shrinking
+         *          (e.g. for a short final chunk) and growing again within the capacity does not reallocate.
+         *      @code
+         *      tf.reserve(DimensionSize<Time>(8192));
+         *      @endcode
+         */
+        template<typename... Dims>
+        void reserve(DimensionSize<Dims>... sizes);
+
+        /**
+         * @brief the size the outermost dimension can grow to (with the other dimensions at their current size)
+         *        without reallocating
+         */
+        template<typename Dim>
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
+        capacity() const;
+
+        /**
+         * @brief append data to the end of the outermost dimension
+         * @details data can be any MultiArray or Slice with the same dimensions, including those with the outermost
+         *          dimension reduced (e.g. append a single spectrum to a TimeFrequency).
+         *          Data with the same dimensions in a different memory order (e.g. a FrequencyTime appended to
+         *          a TimeFrequency) is transposed. A reduced dimension type must have the same ordering.
+         *          Storage is grown geometrically, so repeated appends have amortised constant cost per element.
+         *          If the array is empty it will take its other dimensions from data.
+         *          data may be a view of this array.
+         * @throw std::invalid_argument if the other dimensions do not match
+         */
+        template<typename DataT>
+        void append(DataT const& data);
+
         /**
          * @brief resize the array in the specified dimension
          *      @code
@@ -248,19 +330,19 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          *      @endcode
          */
         template<typename Dim>
-        typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
         size() const;
 
         template<typename Dim>
-        typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+        typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
         size() const;
 
         template<typename Dim>
-        typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
         dimension() const;
 
         template<typename Dim>
-        typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+        typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
         dimension() const;
 
         /**
@@ -268,6 +350,18 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          */
         std::size_t data_size() const;
 
+        /**
+         * @brief call fn(begin, end) for each contiguous block of data
+         * @details All the data in a MultiArray is contiguous and so fn is called once (if the array is not empty)
+         *          with pointers to the whole data block. Provided for compatibility with the Slice interface
+         *          so that generic algorithms can be written as tight pointer loops.
+         */
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn);
+
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn) const;
+
         /**
          * @brief compare data in the two arrays
          */
@@ -282,14 +376,14 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          * @brief the size of a block (span) at the specified Dimension
          */
         template<typename Dimension>
-        typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+        typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
         block_size_t() const;
 
         /**
          * @brief the size of a block (span) at the specified Dimension
          */
         template<typename Dimension>
-        typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+        typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
         block_size_t() const;
 
         /**
@@ -320,35 +414,54 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
     protected:
 
         template<typename... Dims>
-        MultiArray(typename std::enable_if<arg_helper<FirstDimension, Dims...>::value, bool>::type disable_resize_tag
+        MultiArray(typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type disable_resize_tag
                   , DimensionSize<Dims> const&...);
 
+        template<typename... Dims>
+        MultiArray(typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type disable_resize_tag
+                  , Alloc const& allocator, DimensionSize<Dims> const&...);
+
         template<typename DimensionType>
-        MultiArray(typename std::enable_if<has_dimensions<DimensionType, FirstDimension, OtherDimensions...>::value, bool>::type disable_transpose_tag
+        MultiArray(typename std::enable_if<has_dimensions<DimensionType, DimensionTag<FirstDimension>, DimensionTag<OtherDimensions>...>::value, bool>::type disable_transpose_tag
                   , DimensionType const& d);
 
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<!arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total, DimensionSize<Dimension> size, DimensionSize<Dims>... sizes);
 
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<!arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total, DimensionSize<Dimension> size, DimensionSize<Dims>... sizes, T const& value);
 
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total, DimensionSize<Dimension> size, DimensionSize<Dims>... sizes);
 
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total, DimensionSize<Dimension> size, DimensionSize<Dims>... sizes, T const& value);
 
         void do_resize(std::size_t total);
         void do_resize(std::size_t total, T const& value);
 
+        template<typename... Dims>
+        void do_resize(NoInitialisation const&, std::size_t total, DimensionSize<Dims>... sizes);
+
+        template<typename... Dims>
+        void do_reserve(std::size_t total, DimensionSize<Dims>... sizes);
+        std::size_t data_capacity() const;
+
         template<typename SelfSlice, typename OtherSlice>
         void do_transpose(SelfSlice&, OtherSlice const&);
 
+        /// transpose from another MultiArray using the cache blocked algorithm
+        template<typename DimensionType>
+        void transpose_copy(DimensionType const&, std::true_type const&);
+
+        /// transpose from any other type (e.g. Slices) via the slice interface
+        template<typename DimensionType>
+        void transpose_copy(DimensionType const&, std::false_type const&);
+
         template<typename Dimension, typename SliceArgumentType>
         typename std::enable_if<has_dimension_strict<SliceArgumentType, Dimension>::value
                                && is_slice<SliceArgumentType>::value
@@ -363,11 +476,11 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
 
 
         template<typename Dimension>
-        typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, DimensionIndex<Dimension>>::type
+        typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, DimensionIndex<Dimension>>::type
         calculate_offset(std::size_t delta) const;
 
         template<typename Dimension>
-        typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, DimensionIndex<Dimension>>::type
+        typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, DimensionIndex<Dimension>>::type
         calculate_offset(std::size_t delta) const;
 
         /**
@@ -375,8 +488,30 @@ class MultiArray : MultiArray<Alloc, T, SliceMixin, OtherDimensions...>
          */
         std::size_t block_size() const;
 
+        /**
+         * @brief the offset of the element at the specified indexes from begin()
+         */
+        template<typename... Dims>
+        std::size_t index_offset(DimensionIndex<Dims> const&... indexes) const;
+
+        /**
+         * @throw std::out_of_range if any of the indexes are outside the array
+         */
+        template<typename... Dims>
+        void check_index(DimensionIndex<Dims> const&... indexes) const;
+
     private:
-        DimensionSize<FirstDimension>     _size;
+        /// append data with the same dimension ordering
+        template<typename DataT>
+        void do_append(DataT const& data, std::true_type const&);
+
+        /// append data with a different dimension ordering via a transposed copy
+        template<typename DataT>
+        void do_append(DataT const& data, std::false_type const&);
+
+    private:
+        DimensionSizeStorage<FirstDimension> _size;
+        std::size_t _stride; // the number of elements between consecutive indexes of FirstDimension
 };
 
 // allows is_multiarray to work. Has no other function
@@ -391,11 +526,10 @@ template<typename Alloc, typename T, template<typename> class SliceMixin, typena
 class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
 {
         typedef MultiArray<Alloc, T, SliceMixin, FirstDimension> SelfType;
-        typedef std::vector<T, Alloc> Container;
-        //typedef DataBuffer<T, Alloc> Container;
+        typedef DataBuffer<T, Alloc> Container;
 
     public:
-         typedef std::tuple<FirstDimension> DimensionTuple;
+         typedef std::tuple<DimensionTag<FirstDimension>> DimensionTuple;
 
         /**
           * @brief provides a template to determine the returned type of an operator[]
@@ -418,8 +552,8 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
           *  @tparam SliceInputType the type of slice used to generate the overlay slice
           *  @param type The type that will we returned by the overlap(T) method.
           */
-        typedef SliceMixin<Slice<false, SelfType, SliceMixin, FirstDimension>> SliceType;
-        typedef SliceMixin<Slice<true, SelfType, SliceMixin, FirstDimension>> ConstSliceType;
+        typedef SliceMixin<Slice<false, SelfType, SliceMixin, DimensionTag<FirstDimension>>> SliceType;
+        typedef SliceMixin<Slice<true, SelfType, SliceMixin, DimensionTag<FirstDimension>>> ConstSliceType;
         typedef typename Container::iterator iterator;
         typedef typename Container::const_iterator const_iterator;
 
@@ -432,6 +566,19 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
 
         template<typename Dim, typename... Dims>
         MultiArray(DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes);
+
+        template<typename Dim, typename... Dims>
+        MultiArray(Alloc const& allocator, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes);
+
+        /**
+         * @brief construct without initialising the data (for trivial types)
+         */
+        template<typename Dim, typename... Dims>
+        MultiArray(NoInitialisation const&, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes);
+
+        template<typename Dim, typename... Dims>
+        MultiArray(NoInitialisation const&, Alloc const& allocator, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes);
+
         explicit MultiArray(MultiArray const&) = default;
         ~MultiArray();
 
@@ -441,13 +588,32 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
          * @brief return true if this array has dimesion D
          */
         template<typename D>
-        static constexpr bool has_dimension() { return std::is_same<FirstDimension, D>::value; }
+        static constexpr bool has_dimension() { return std::is_same<DimensionTag<FirstDimension>, D>::value; }
 
         /**
          * @brief
          */
-        reference_type operator[](DimensionIndex<FirstDimension> index);
-        const_reference_type operator[](DimensionIndex<FirstDimension> index) const;
+        reference_type operator[](DimensionIndex<DimensionTag<FirstDimension>> index);
+        const_reference_type operator[](DimensionIndex<DimensionTag<FirstDimension>> index) const;
+
+        /**
+         * @brief direct access to a single element (equivalent to operator[])
+         */
+        template<typename... Dims>
+        reference_type operator()(DimensionIndex<Dims>... indexes);
+
+        template<typename... Dims>
+        const_reference_type operator()(DimensionIndex<Dims>... indexes) const;
+
+        /**
+         * @brief as operator() but with bounds checking
+         * @throw std::out_of_range if the index is outside the array
+         */
+        template<typename... Dims>
+        reference_type at(DimensionIndex<Dims>... indexes);
+
+        template<typename... Dims>
+        const_reference_type at(DimensionIndex<Dims>... indexes) const;
 
         /**
          * @brief The offset position of the beginning of the provided slice
@@ -460,19 +626,19 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
 
         /// size
         template<typename Dim>
-        typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
         size() const;
 
         template<typename Dim>
-        typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+        typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
         size() const;
 
         template<typename Dim>
-        typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
         dimension() const;
 
         template<typename Dim>
-        typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+        typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
         dimension() const;
 
         /**
@@ -480,6 +646,18 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
          */
         std::size_t data_size() const;
 
+        /**
+         * @brief call fn(begin, end) for each contiguous block of data
+         * @details All the data in a MultiArray is contiguous and so fn is called once (if the array is not empty)
+         *          with pointers to the whole data block. Provided for compatibility with the Slice interface
+         *          so that generic algorithms can be written as tight pointer loops.
+         */
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn);
+
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn) const;
+
         /**
          * @brief resize in the specified dimension
          */
@@ -492,6 +670,33 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
         template<typename Dimension>
         void resize(DimensionSize<Dimension> size, T const& value);
 
+        /**
+         * @brief resize leaving any new elements uninitialised (for trivial types)
+         */
+        template<typename... Dims>
+        void resize(NoInitialisation const&, DimensionSize<Dims>... sizes);
+
+        /**
+         * @brief reserve storage for an array of the specified size without changing its current size or data
+         */
+        template<typename... Dims>
+        void reserve(DimensionSize<Dims>... sizes);
+
+        /**
+         * @brief the size the array can grow to without reallocating
+         */
+        template<typename Dim>
+        typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
+        capacity() const;
+
+        /**
+         * @brief append the elements of data (any MultiArray or Slice of the same dimension) to the end of the array
+         * @details Storage is grown geometrically, so repeated appends have amortised constant cost per element.
+         *          data may be a view of this array.
+         */
+        template<typename DataT>
+        void append(DataT const& data);
+
         /**
          * @brief compare data in the two arrays
          */
@@ -515,7 +720,7 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
          */
         template<typename Dimension>
         constexpr
-        typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+        typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
         block_size_t() const;
 
         /**
@@ -523,7 +728,7 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
          * @details  you should be able to eliminate this call using template magic
          */
         template<typename Dimension>
-        typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+        typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
         block_size_t() const;
 
         template<typename Job>
@@ -531,28 +736,32 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
 
     protected:
         template<typename... Dims>
-        MultiArray(typename std::enable_if<arg_helper<FirstDimension, Dims...>::value, bool>::type disable_resize_tag
+        MultiArray(typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type disable_resize_tag
                   , DimensionSize<Dims> const&...);
 
+        template<typename... Dims>
+        MultiArray(typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type disable_resize_tag
+                  , Alloc const& allocator, DimensionSize<Dims> const&...);
+
         template<typename DimensionType>
-        MultiArray(typename std::enable_if<astrotypes::has_dimension<DimensionType, FirstDimension>::value, bool>::type disable_transpose_tag
+        MultiArray(typename std::enable_if<astrotypes::has_dimension<DimensionType, DimensionTag<FirstDimension>>::value, bool>::type disable_transpose_tag
                   , DimensionType const& d);
 
         /// resize
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total_size, DimensionSize<Dimension> size, DimensionSize<Dims>...);
 
         template<typename Dimension, typename... Dims>
-        typename std::enable_if<arg_helper<FirstDimension, Dimension, Dims...>::value, void>::type
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dimension, Dims...>::value, void>::type
         do_resize(std::size_t total_size, DimensionSize<Dimension> size, DimensionSize<Dims>..., T const& value);
 
         template<typename... Dims>
-        typename std::enable_if<!arg_helper<FirstDimension, Dims...>::value, void>::type
+        typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dims...>::value, void>::type
         do_resize(std::size_t total_size, DimensionSize<Dims>...);
 
         template<typename... Dims>
-        typename std::enable_if<!arg_helper<FirstDimension, Dims...>::value, void>::type
+        typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dims...>::value, void>::type
         do_resize(std::size_t total_size, DimensionSize<Dims>..., T const& value);
 
         template<typename SelfSlice, typename OtherSlice>
@@ -561,10 +770,23 @@ class MultiArray<Alloc, T, SliceMixin, FirstDimension> : public MultiArrayTag
         template<typename Dimension>
         DimensionIndex<Dimension> calculate_offset(std::size_t delta) const;
 
+        template<typename... Dims>
+        void do_reserve(std::size_t total, DimensionSize<Dims>... sizes);
+        std::size_t data_capacity() const;
+
+        template<typename... Dims>
+        void do_resize(NoInitialisation const&, std::size_t total_size, DimensionSize<Dims>... sizes);
+
         std::size_t block_size() const;
 
+        template<typename... Dims>
+        std::size_t index_offset(DimensionIndex<Dims> const&... indexes) const;
+
+        template<typename... Dims>
+        void check_index(DimensionIndex<Dims> const&... indexes) const;
+
     private:
-        DimensionSize<FirstDimension> _size;
+        DimensionSizeStorage<FirstDimension> _size;
         Container _data;
 };
 
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_PARALLELALGORITHMS_H
+#define PSS_ASTROTYPES_MULTIARRAY_PARALLELALGORITHMS_H
+
+#include "Executor.h"
+#include "DimensionSpan.h"
+#include "Transpose.h"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief The maximum number of partitions used by the parallel reductions
+ * @details Reductions partition the data independently of the executor so that
+ *          floating point results are identical whatever the number of threads.
+ */
+constexpr std::size_t parallel_reduce_partitions = 64;
+
+/**
+ * @brief split a dimension into (at most) number_of_partitions contiguous spans of near equal size
+ */
+template<typename Dimension>
+std::vector<DimensionSpan<Dimension>> partition(DimensionSize<Dimension> size, std::size_t number_of_partitions);
+
+/**
+ * @brief set every element of data to value
+ * @details The data is partitioned along its outermost dimension and each partition filled as a separate task.
+ *          Works with any MultiArray or Slice type.
+ * @code
+ *      ThreadPoolExecutor executor(4);
+ *      parallel_fill(executor, data, 0.0f);
+ * @endcode
+ */
+template<typename ExecutorT, typename DataT, typename T>
+void parallel_fill(ExecutorT& executor, DataT& data, T const& value);
+
+/**
+ * @brief copy each element of src into the corresponding element of dst
+ * @details src and dst must have the same dimensions (in the same order) and sizes.
+ */
+template<typename ExecutorT, typename SrcT, typename DstT>
+void parallel_copy(ExecutorT& executor, SrcT const& src, DstT& dst);
+
+/**
+ * @brief set each element of dst to fn(corresponding element of src)
+ * @details src and dst must have the same dimensions (in the same order) and sizes.
+ *          fn may be called concurrently from several threads.
+ */
+template<typename ExecutorT, typename SrcT, typename DstT, typename FunctionT>
+void parallel_transform(ExecutorT& executor, SrcT const& src, DstT& dst, FunctionT const& fn);
+
+/**
+ * @brief call fn on each element of a random access range, e.g. each spectrum of a TimeFrequency block
+ * @details The range is split into contiguous blocks with a task for each, so a @ref SliceRange
+ *          is walked incrementally within each block. fn may be called concurrently from several threads.
+ * @code
+ *      parallel_for_each(executor, data.spectra(), [&](TimeFrequency<float>::Spectra const& spectrum) { ... });
+ * @endcode
+ */
+template<typename ExecutorT, typename RangeT, typename FunctionT>
+void parallel_for_each(ExecutorT& executor, RangeT const& range, FunctionT const& fn);
+
+/**
+ * @brief reduce all the elements of data with the binary operator op
+ * @details op must be associative. The partitioning is fixed by the data size alone, so the result
+ *          (including floating point rounding) is the same for any executor.
+ * @code
+ *      double sum = parallel_reduce(executor, data, 0.0, std::plus<double>());
+ * @endcode
+ */
+template<typename ExecutorT, typename DataT, typename T, typename BinaryOpT>
+T parallel_reduce(ExecutorT& executor, DataT const& data, T init, BinaryOpT const& op);
+
+/**
+ * @brief reduce over all dimensions except Dimension, i.e. a value for each index of Dimension
+ * @details e.g. the bandpass of a TimeFrequency block is parallel_reduce_by<Frequency>(executor, data, 0.0, std::plus<double>()).
+ *          Note this keeps Dimension, whereas @ref reduce<Dimension> removes it.
+ *          As with the full reduction the result does not depend on the executor.
+ */
+template<typename Dimension, typename ExecutorT, typename DataT, typename T, typename BinaryOpT>
+std::vector<T> parallel_reduce_by(ExecutorT& executor, DataT const& data, T init, BinaryOpT const& op);
+
+/**
+ * @brief the multi-threaded equivalent of @ref transpose
+ * @details dst is partitioned along its outermost dimension
+ */
+template<typename ExecutorT, typename DstArrayT, typename SrcArrayT>
+void parallel_transpose(ExecutorT& executor, DstArrayT& dst, SrcArrayT const& src);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/ParallelAlgorithms.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_PARALLELALGORITHMS_H
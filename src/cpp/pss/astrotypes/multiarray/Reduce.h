@@ -0,0 +1,197 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_REDUCE_H
+#define PSS_ASTROTYPES_MULTIARRAY_REDUCE_H
+
+#include "MultiArray.h"
+#include "ArrayRef.h"
+#include "TypeTraits.h"
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief The summation algorithms available to reduce and mean
+ * @details These only change the result for floating point accumulators; integer sums are always exact
+ *          (within the range of the accumulator) and use Sum whichever is requested.
+ */
+namespace reduction {
+
+/// @brief straightforward summation. Rounding errors grow with the number of terms.
+struct Sum {};
+
+/// @brief pairwise (cascade) summation. Rounding errors grow with the log of the number of terms at a similar cost to Sum.
+struct PairwiseSum {};
+
+/// @brief Kahan compensated summation. Rounding errors independent of the number of terms, at around 4 times the arithmetic.
+struct KahanSum {};
+
+} // namespace reduction
+
+/**
+ * @brief true if T is one of the reduction:: summation types
+ */
+template<typename T>
+struct is_reduction_algorithm : std::false_type
+{
+};
+
+template<> struct is_reduction_algorithm<reduction::Sum> : std::true_type {};
+template<> struct is_reduction_algorithm<reduction::PairwiseSum> : std::true_type {};
+template<> struct is_reduction_algorithm<reduction::KahanSum> : std::true_type {};
+
+/**
+ * @brief the default accumulator type used to sum values of type T
+ * @details 8 and 16 bit integers are summed in 32 bits, 32 bit integers in 64 bits (keeping the signedness),
+ *          floating point types in their own type. A 32 bit sum of 8 bit data cannot overflow before 2^24 terms,
+ *          of 16 bit data before 2^16 terms; specify a wider accumulator for longer reductions.
+ */
+template<typename T, typename Enable=void>
+struct ReduceAccumulator
+{
+    typedef T type;
+};
+
+template<typename T>
+struct ReduceAccumulator<T, typename std::enable_if<std::is_integral<T>::value && (sizeof(T) < 4)>::type>
+{
+    typedef typename std::conditional<std::is_signed<T>::value, std::int32_t, std::uint32_t>::type type;
+};
+
+template<typename T>
+struct ReduceAccumulator<T, typename std::enable_if<std::is_integral<T>::value && (sizeof(T) == 4)>::type>
+{
+    typedef typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type type;
+};
+
+/**
+ * @brief the default value type of the result of mean for values of type T (double for double, float otherwise)
+ */
+template<typename T>
+struct ReduceMean
+{
+    typedef typename std::conditional<std::is_same<T, double>::value, double, float>::type type;
+};
+
+/**
+ * @brief the SliceMixin of a ReducedArray, it adds nothing to the Slice interface
+ */
+template<typename T>
+class ReducedArrayMixin : public T
+{
+    public:
+        ReducedArrayMixin(T const& t) : T(t) {}
+        using T::T;
+};
+
+/**
+ * @brief
+ *      The MultiArray type returned by reduce and mean
+ * @details
+ *      Holds the remaining dimensions of the reduced data, in the same order.
+ *      e.g. reduce<Frequency> of a TimeFrequency block is a ReducedArray<uint32_t, Time>
+ */
+template<typename T, typename... Dimensions>
+class ReducedArray : public MultiArray<std::allocator<T>, T, ReducedArrayMixin, Dimensions...>
+{
+        typedef MultiArray<std::allocator<T>, T, ReducedArrayMixin, Dimensions...> BaseT;
+
+    public:
+        explicit ReducedArray(DimensionSize<Dimensions>... sizes);
+        ReducedArray(NoInitialisation const&, DimensionSize<Dimensions>... sizes);
+};
+
+/**
+ * @brief the type returned by reduce<Dimension, AccT>(DataT)
+ * @tparam AccT the value type of the result, or void for the ReduceAccumulator of the data type
+ */
+template<typename Dimension, typename DataT, typename AccT=void>
+struct ReducedArrayType;
+
+/**
+ * @brief the type returned by mean<Dimension, OutT>(DataT)
+ * @tparam OutT the value type of the result, or void for the ReduceMean of the data type
+ */
+template<typename Dimension, typename DataT, typename OutT=void>
+struct MeanArrayType;
+
+/**
+ * @brief sum over Dimension, e.g. the zero-DM time series of a TimeFrequency block is reduce<Frequency>(tf)
+ * @details Works on any MultiArray or Slice. Memory is always walked along its innermost dimension,
+ *          whatever the position of Dimension, so TimeFrequency and FrequencyTime layouts are both
+ *          reduced at close to memory bandwidth. Note that parallel_reduce_by<Dimension> keeps Dimension and reduces the others.
+ * @tparam AccT the type to accumulate and return the sums in (void for the ReduceAccumulator of the data)
+ * @param algorithm one of the reduction:: summation types
+ * @code
+ *      auto zero_dm = reduce<Frequency>(tf);                                    // ReducedArray<uint32_t, Time> for uint8_t data
+ *      auto bandpass = reduce<Time, double>(tf, reduction::PairwiseSum());      // ReducedArray<double, Frequency>
+ * @endcode
+ */
+template<typename Dimension, typename AccT=void, typename DataT, typename AlgorithmT=reduction::Sum>
+typename std::enable_if<is_reduction_algorithm<AlgorithmT>::value, typename ReducedArrayType<Dimension, DataT, AccT>::type>::type
+reduce(DataT const& data, AlgorithmT const& algorithm=AlgorithmT());
+
+/**
+ * @brief reduce over Dimension with the binary operator op
+ * @details each result is op(...op(op(x0, x1), x2)..., xn) in the order of Dimension, accumulated in AccT,
+ *          with memory walked along its innermost dimension as for the sums. An empty Dimension gives AccT().
+ * @tparam AccT the type to accumulate and return the values in (void for the ReduceAccumulator of the data)
+ * @code
+ *      auto peak = reduce<Frequency>(tf, [](uint32_t a, uint32_t b) { return std::max(a, b); });
+ * @endcode
+ */
+template<typename Dimension, typename AccT=void, typename DataT, typename BinaryOpT>
+typename std::enable_if<!is_reduction_algorithm<BinaryOpT>::value && !is_multiarray<BinaryOpT>::value
+                       , typename ReducedArrayType<Dimension, DataT, AccT>::type>::type
+reduce(DataT const& data, BinaryOpT const& op);
+
+/**
+ * @brief sum over Dimension into an existing MultiArray
+ * @details out must have the dimensions of data without Dimension, in the same order, and the same sizes.
+ *          The sums are accumulated in the value type of out.
+ * @throw std::invalid_argument if the sizes of out do not match
+ */
+template<typename Dimension, typename DataT, typename OutT, typename AlgorithmT=reduction::Sum>
+typename std::enable_if<is_multiarray<OutT>::value>::type
+reduce(DataT const& data, OutT& out, AlgorithmT const& algorithm=AlgorithmT());
+
+/**
+ * @brief the mean over Dimension, e.g. the bandpass of a TimeFrequency block is mean<Time>(tf)
+ * @details The sum is made in the ReduceAccumulator of the data type and then divided by the size of Dimension.
+ * @tparam OutT the type of the result (void for double with double data, float otherwise)
+ */
+template<typename Dimension, typename OutT=void, typename DataT, typename AlgorithmT=reduction::Sum>
+typename MeanArrayType<Dimension, DataT, OutT>::type mean(DataT const& data, AlgorithmT const& algorithm=AlgorithmT());
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Reduce.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_REDUCE_H
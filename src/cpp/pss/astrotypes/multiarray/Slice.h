@@ -25,6 +25,7 @@
 #define PSS_ASTROTYPES_MULTIARRAY_SLICE_H
 #include "DimensionSpan.h"
 #include "SliceIterator.h"
+#include "StridedIterator.h"
 #include "TypeTraits.h"
 #include "detail/SliceHelpers.h"
 #include "detail/SlicePosition.h"
@@ -63,6 +64,9 @@ typename CastToConstSliceType<SliceType>::type& cast_to_const_slice(SliceType&&
 template<typename SliceType>
 typename CastToNonConstSliceType<SliceType>::type& cast_to_non_const_slice(SliceType&& slice);
 
+template<typename SliceT, typename Dimension>
+class SliceRangeIterator;
+
 /**
  * @class Slice
  * @brief
@@ -247,6 +251,25 @@ class Slice : private Slice<IsConst, InternalSliceTraits<SliceTraitsT, Dimension
         const_iterator end() const;
         const_iterator cend() const;
 
+        /**
+         * @brief call fn(begin, end) for each contiguous block of memory spanned by the slice
+         * @details blocks are visited in the same order as the slice iterators. Adjacent blocks
+         *          are merged where the slice spans the full extent of the lower dimensions.
+         *          begin and end are pointers to the underlying data type, allowing bulk
+         *          operations (e.g. I/O) on each block.
+         * @code
+         *      slice.for_each_contiguous_run([&](int const* begin, int const* end)
+         *                                    {
+         *                                        os.write(reinterpret_cast<char const*>(begin), (end - begin) * sizeof(int));
+         *                                    });
+         * @endcode
+         */
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn);
+
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn) const;
+
         /**
          * @brief return refernce to the parent object the Slice is based on
          */
@@ -276,6 +299,7 @@ class Slice : private Slice<IsConst, InternalSliceTraits<SliceTraitsT, Dimension
         template<typename T> friend struct RemoveMixinWrapper;
         template<typename T> friend struct RestoreMixinWrapper;
         template<typename T> friend struct FlipConstTypeHelper;
+        template<typename, typename> friend class SliceRangeIterator;
 
         template<typename IteratorT> bool increment_it(IteratorT& current, SlicePosition<rank>& pos) const;
         template<typename IteratorT> bool add_it(std::size_t increment, IteratorT& current, SlicePosition<rank>& pos) const;
@@ -289,6 +313,12 @@ class Slice : private Slice<IsConst, InternalSliceTraits<SliceTraitsT, Dimension
         typename std::enable_if<!std::is_same<Dim, Dimension>::value, DimensionSpan<Dim>>::type
         parent_span() const;
 
+        // true if the data spanned is a single contiguous block of memory
+        bool contiguous() const;
+
+        template<typename PointerT, typename FunctionT>
+        void do_for_each_contiguous_run(PointerT ptr, FunctionT& fn) const;
+
         // return the span of all lower dimensions than this one (i.e an index of +1 in this dimension)
         std::size_t base_span() const;
         std::size_t diff_base_span() const;
@@ -341,6 +371,20 @@ class Slice : private Slice<IsConst, InternalSliceTraits<SliceTraitsT, Dimension
         // increment pointer by a n * base span length
         SelfType& operator+=(DimensionSize<Dimension> n);
 
+        // move the slice n indices along a lower dimension, keeping its extent
+        template<typename Dim>
+        typename std::enable_if<arg_helper<Dim, Dimensions...>::value, SelfType&>::type
+        operator+=(DimensionSize<Dim> n);
+
+        // move the start of the span in Dim by n indices (pointers are updated by a subsequent call to offset())
+        template<typename Dim>
+        typename std::enable_if<std::is_same<Dim, Dimension>::value>::type
+        shift_span(DimensionSize<Dim> n);
+
+        template<typename Dim>
+        typename std::enable_if<!std::is_same<Dim, Dimension>::value>::type
+        shift_span(DimensionSize<Dim> n);
+
     protected:
         /**
          * @brief iterator pointing to the first element in the slice
@@ -406,8 +450,8 @@ class Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> : public SliceTag
         typedef typename std::conditional<IsConst, const ParentT, ParentT>::type Parent;
         typedef Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> SliceType;
         typedef Slice<true, SliceTraitsT, SliceMixin, Dimension> ConstSliceType;
-        typedef parent_iterator iterator;
-        typedef parent_const_iterator const_iterator;
+        typedef StridedIterator<parent_iterator> iterator;
+        typedef StridedIterator<parent_const_iterator> const_iterator;
 
     public:
         explicit Slice();
@@ -522,17 +566,37 @@ class Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> : public SliceTag
 
         /**
          * @brief iterator pointing to the first element in the slice
+         * @details steps through the parent data by the stride of the span
          */
-        parent_iterator begin();
-        parent_const_iterator begin() const;
-        parent_const_iterator cbegin() const;
+        iterator begin();
+        const_iterator begin() const;
+        const_iterator cbegin() const;
 
         /**
          * @brief iterator pointing to just after the last element
          */
-        parent_iterator end();
-        parent_const_iterator end() const;
-        parent_const_iterator cend() const;
+        iterator end();
+        const_iterator end() const;
+        const_iterator cend() const;
+
+        /**
+         * @brief call fn(begin, end) for each contiguous block of memory spanned by the slice
+         * @details blocks are visited in the same order as the slice iterators. Adjacent blocks
+         *          are merged where the slice spans the full extent of the lower dimensions.
+         *          begin and end are pointers to the underlying data type, allowing bulk
+         *          operations (e.g. I/O) on each block.
+         * @code
+         *      slice.for_each_contiguous_run([&](int const* begin, int const* end)
+         *                                    {
+         *                                        os.write(reinterpret_cast<char const*>(begin), (end - begin) * sizeof(int));
+         *                                    });
+         * @endcode
+         */
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn);
+
+        template<typename FunctionT>
+        void for_each_contiguous_run(FunctionT&& fn) const;
 
         /**
          * @brief compare tow arrays
@@ -555,10 +619,17 @@ class Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> : public SliceTag
         template<typename T> friend struct RemoveMixinWrapper;
         template<typename T> friend struct RestoreMixinWrapper;
         template<typename T> friend struct FlipConstTypeHelper;
+        template<typename, typename> friend class SliceRangeIterator;
 
         template<typename IteratorT> bool increment_it(IteratorT& current, SlicePosition<rank>& pos) const;
         template<typename IteratorT> bool add_it(std::size_t increment, IteratorT& current, SlicePosition<rank>& pos) const;
-        template<typename IteratorDifferenceT> static IteratorDifferenceT diff_it(IteratorDifferenceT const& diff);
+        template<typename IteratorDifferenceT> IteratorDifferenceT diff_it(IteratorDifferenceT const& diff) const;
+
+        // true if the data spanned is a single contiguous block of memory
+        bool contiguous() const;
+
+        template<typename PointerT, typename FunctionT>
+        void do_for_each_contiguous_run(PointerT ptr, FunctionT& fn) const;
 
         // same as size() - to support base_span calls from higher dimensions
         std::size_t base_span() const;
@@ -576,6 +647,11 @@ class Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> : public SliceTag
         SelfType& operator+=(DimensionSize<Dimension> const&);
         SelfType& operator+=(std::size_t n);
 
+        // move the start of the span by n indices (the pointer is updated by a subsequent call to offset())
+        template<typename Dim>
+        typename std::enable_if<std::is_same<Dim, Dimension>::value>::type
+        shift_span(DimensionSize<Dim> n);
+
         template<typename Dim>
         typename std::enable_if<std::is_same<Dim, Dimension>::value , DimensionSpan<Dim>>::type
         parent_span() const;
@@ -73,19 +73,29 @@ class SliceIteratorBase : public SliceIteratorBase<DerivedType, SliceType, is_co
         typedef typename std::iterator_traits<parent_iterator>::reference reference;
         typedef typename std::iterator_traits<parent_iterator>::pointer pointer;
         typedef typename std::iterator_traits<parent_iterator>::difference_type difference_type;
-        typedef typename std::forward_iterator_tag iterator_category;
+        typedef std::random_access_iterator_tag iterator_category;
 
     public:
         SliceIteratorBase(SliceT&);
         ~SliceIteratorBase();
 
+        using BaseT::operator++;
+        using BaseT::operator-;
+
         DerivedType& operator++();
 
+        /// the number of elements between two iterators of the same slice
         difference_type operator-(SelfType const&) const;
-        DerivedType& operator+=(std::size_t increment);
+
+        /// advance (or retreat) the iterator by the given number of elements. The cost is independent of the distance moved.
+        DerivedType& operator+=(difference_type increment);
 
         SliceT const& slice() const;
 
+    protected:
+        // the distance from the start of the slice
+        difference_type offset() const;
+
     protected:
         SliceT* _slice;
         SlicePosition<SliceT::rank>  _pos;
@@ -116,8 +126,13 @@ class SliceIteratorBase<DerivedType, SliceType, is_const, 1>
         ~SliceIteratorBase();
 
         DerivedType& operator++();
-        DerivedType& operator++(int);
-        DerivedType& operator+=(std::size_t increment);
+        DerivedType operator++(int);
+        DerivedType& operator--();
+        DerivedType operator--(int);
+        DerivedType& operator+=(difference_type increment);
+        DerivedType& operator-=(difference_type decrement);
+        DerivedType operator+(difference_type increment) const;
+        DerivedType operator-(difference_type decrement) const;
 
         template<typename D, bool const_val>
         bool operator==(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
@@ -125,9 +140,25 @@ class SliceIteratorBase<DerivedType, SliceType, is_const, 1>
         template<typename D, bool const_val>
         bool operator!=(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
 
+        /// ordering follows the position in the slice
+        template<typename D, bool const_val>
+        bool operator<(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
+
+        template<typename D, bool const_val>
+        bool operator>(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
+
+        template<typename D, bool const_val>
+        bool operator<=(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
+
+        template<typename D, bool const_val>
+        bool operator>=(SliceIteratorBase<D, SliceType, const_val, 1> const&) const;
+
         /// dereference operator
         const reference operator*() const;
 
+        /// element at the given offset from this iterator
+        reference operator[](difference_type offset) const;
+
         /** @brief return equivalent location in an alternative object to which the Slice corresponds
          *  @code
          *     DimensionSize<A> a_size(10);
@@ -210,8 +241,16 @@ class SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> : p
         SliceIterator(BaseT const& b) : ActualBaseT(b) {}
         SliceIterator(BaseT&& b) : ActualBaseT(std::forward<BaseT>(b)) {}
 
+        using ActualBaseT::operator-;
+
         SliceIterator& operator++();
-        SliceIterator& operator++(int);
+        SliceIterator operator++(int);
+        SliceIterator& operator--();
+        SliceIterator operator--(int);
+        SliceIterator& operator+=(typename ActualBaseT::difference_type);
+        SliceIterator& operator-=(typename ActualBaseT::difference_type);
+        SliceIterator operator+(typename ActualBaseT::difference_type) const;
+        SliceIterator operator-(typename ActualBaseT::difference_type) const;
 
         static SliceIterator create_end(SliceT& slice) { return SliceIterator(ActualBaseT::create_end(slice)); }
 };
@@ -234,8 +273,16 @@ class SliceIterator<Mixin<SliceType, Ts...>, is_const> : public SliceIterator<Sl
         SliceIterator(BaseT const& b) : ActualBaseT(b) {}
         SliceIterator(BaseT&& b) : ActualBaseT(std::forward<BaseT>(b)) {}
 
+        using ActualBaseT::operator-;
+
         SliceIterator& operator++();
-        SliceIterator& operator++(int);
+        SliceIterator operator++(int);
+        SliceIterator& operator--();
+        SliceIterator operator--(int);
+        SliceIterator& operator+=(typename ActualBaseT::difference_type);
+        SliceIterator& operator-=(typename ActualBaseT::difference_type);
+        SliceIterator operator+(typename ActualBaseT::difference_type) const;
+        SliceIterator operator-(typename ActualBaseT::difference_type) const;
 
         static SliceIterator create_end(SliceT& slice) { return SliceIterator(ActualBaseT::create_end(slice)); }
 };
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_SLICERANGE_H
+#define PSS_ASTROTYPES_MULTIARRAY_SLICERANGE_H
+
+#include "Slice.h"
+#include "SliceRangeIterator.h"
+#include "DimensionIndex.h"
+#include "DimensionSize.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief
+ *      The sequence of slices data[DimensionIndex<Dimension>(i)] for each i of Dimension
+ * @details
+ *      Replaces loops of the form
+ *      @code
+ *          for(DimensionIndex<Time> i(0); i < data.template dimension<Time>(); ++i) {
+ *              auto spectrum = data[i];
+ *              ...
+ *          }
+ *      @endcode
+ *      with
+ *      @code
+ *          for(auto const& spectrum : data.spectra()) { ... }
+ *      @endcode
+ *      where a single slice is moved through the data rather than a new one built for each index.
+ *      The iterators are random access, so ranges can be split between threads (see @ref parallel_for_each).
+ *      A SliceRange refers to the data it was created from and must not outlive it.
+ * @tparam SliceT the type returned by data[DimensionIndex<Dimension>]
+ */
+template<typename SliceT, typename Dimension>
+class SliceRange
+{
+    public:
+        typedef SliceRangeIterator<SliceT, Dimension> iterator;
+        typedef iterator const_iterator;
+        typedef SliceT value_type;
+
+    public:
+        /**
+         * @param first the slice at index 0 (i.e. data[DimensionIndex<Dimension>(0)])
+         * @param size  the number of slices (i.e. data.dimension<Dimension>())
+         * @param stride the stride of data's span in Dimension (see @ref slice_range_stride)
+         */
+        SliceRange(SliceT const& first, DimensionSize<Dimension> size, std::size_t stride=1);
+
+        iterator begin() const;
+        iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        /// @brief the number of slices in the range
+        DimensionSize<Dimension> size() const;
+
+        /// @brief true if there are no slices in the range
+        bool empty() const;
+
+        /// @brief a copy of the slice at the specified index
+        SliceT operator[](DimensionIndex<Dimension> index) const;
+
+    private:
+        SliceT _first;
+        DimensionSize<Dimension> _size;
+        std::size_t _stride;
+};
+
+/**
+ * @brief the number of indices of the underlying data between data[DimensionIndex<Dimension>(i)] and the next slice
+ * @details the stride of the span in Dimension for slices, 1 otherwise
+ */
+template<typename Dimension, typename DataT>
+typename std::enable_if<is_slice<DataT>::value, std::size_t>::type
+slice_range_stride(DataT const& data);
+
+template<typename Dimension, typename DataT>
+typename std::enable_if<!is_slice<DataT>::value, std::size_t>::type
+slice_range_stride(DataT const& data);
+
+/**
+ * @brief construct the range of slices of data along Dimension
+ * @details data must have at least one other dimension
+ * @code
+ *      for(auto const& channel : make_slice_range<Frequency>(data)) { ... }
+ * @endcode
+ */
+template<typename Dimension, typename DataT>
+auto make_slice_range(DataT&& data) -> SliceRange<decltype(data[DimensionIndex<Dimension>(0)]), Dimension>;
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/SliceRange.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_SLICERANGE_H
@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_SLICERANGEITERATOR_H
+#define PSS_ASTROTYPES_MULTIARRAY_SLICERANGEITERATOR_H
+
+#include "DimensionSize.h"
+#include <cstddef>
+#include <iterator>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief
+ *      Iterate over consecutive reduced rank slices of a data structure (e.g. the spectra of a TimeFrequency block)
+ * @details
+ *      The iterator holds a single slice that is moved along Dimension in place, so stepping
+ *      costs a few pointer updates and never constructs a new slice. Moving backwards rebuilds
+ *      the slice from the first one in the range, which is also a constant cost.
+ *      The reference returned by operator* refers to the slice held by the iterator
+ *      and so is only valid until the iterator is moved or destroyed.
+ * @tparam SliceT the slice type returned for each index of Dimension (e.g. TimeFrequency<T>::Spectra)
+ */
+template<typename SliceT, typename Dimension>
+class SliceRangeIterator
+{
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef SliceT value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef SliceT* pointer;
+        typedef SliceT& reference;
+
+    public:
+        /**
+         * @param first  the slice at index 0 of the range
+         * @param index  the position of this iterator in the range
+         * @param stride the number of indices of the underlying data between consecutive slices
+         *               (i.e. the stride of the span in Dimension)
+         */
+        SliceRangeIterator(SliceT const& first, std::size_t index, std::size_t stride=1);
+
+        reference operator*() const;
+        pointer operator->() const;
+
+        /// @brief a copy of the slice n steps from this one
+        value_type operator[](difference_type n) const;
+
+        SliceRangeIterator& operator++();
+        SliceRangeIterator operator++(int);
+        SliceRangeIterator& operator--();
+        SliceRangeIterator operator--(int);
+
+        SliceRangeIterator& operator+=(difference_type n);
+        SliceRangeIterator& operator-=(difference_type n);
+        SliceRangeIterator operator+(difference_type n) const;
+        SliceRangeIterator operator-(difference_type n) const;
+        difference_type operator-(SliceRangeIterator const&) const;
+
+        bool operator==(SliceRangeIterator const&) const;
+        bool operator!=(SliceRangeIterator const&) const;
+        bool operator<(SliceRangeIterator const&) const;
+        bool operator>(SliceRangeIterator const&) const;
+        bool operator<=(SliceRangeIterator const&) const;
+        bool operator>=(SliceRangeIterator const&) const;
+
+        /// @brief the index of the current slice in the range
+        std::size_t index() const;
+
+    private:
+        SliceT _first;
+        mutable SliceT _slice;
+        std::size_t _index;
+        std::size_t _stride;
+};
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> operator+(typename SliceRangeIterator<SliceT, Dimension>::difference_type n, SliceRangeIterator<SliceT, Dimension> const& it);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/SliceRangeIterator.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_SLICERANGEITERATOR_H
@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_STATICDIMENSIONSIZE_H
+#define PSS_ASTROTYPES_MULTIARRAY_STATICDIMENSIONSIZE_H
+
+#include "DimensionSize.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief
+ *      A DimensionSize whose value is known at compile time
+ *
+ * @details Can be used wherever a DimensionSize<Dimension> is expected.
+ *
+ *          The type can also be used in place of the Dimension tag in the dimension list of a
+ *          MultiArray (and so TimeFrequency etc.) to fix the size of that dimension for that type
+ *          only. The array then no longer stores the size of the dimension, and the size, and the
+ *          block sizes (strides) that depend on it, become compile time constants that the compiler
+ *          can use to unroll and vectorise loops over the data. The dimension is still referred to
+ *          by its tag (e.g. dimension<Dimension>()).
+ *
+ *          Attempting to construct or resize such an array with any other size for the
+ *          dimension will throw std::invalid_argument.
+ *
+ * @code
+ *      // a block for a 4096 channel receiver
+ *      typedef MultiArray<std::allocator<uint8_t>, uint8_t, Mixin, units::Time, StaticDimensionSize<units::Frequency, 4096>> BlockType;
+ *      BlockType data(DimensionSize<units::Time>(1024), StaticDimensionSize<units::Frequency, 4096>());
+ *      data.dimension<units::Frequency>(); // 4096
+ * @endcode
+ */
+template<typename Dimension, std::size_t N>
+class StaticDimensionSize : public DimensionSize<Dimension>
+{
+        static_assert(N != 0, "StaticDimensionSize requires a non zero size");
+
+    public:
+        static constexpr std::size_t value = N;
+
+    public:
+        StaticDimensionSize();
+};
+
+/**
+ * @brief
+ *      The Dimension tag of an entry in a MultiArray dimension list
+ * @details strips any StaticDimensionSize wrapper
+ */
+template<typename Dimension>
+struct dimension_tag
+{
+    typedef Dimension type;
+};
+
+template<typename Dimension, std::size_t N>
+struct dimension_tag<StaticDimensionSize<Dimension, N>>
+{
+    typedef Dimension type;
+};
+
+template<typename Dimension>
+using DimensionTag = typename dimension_tag<Dimension>::type;
+
+/**
+ * @brief
+ *      The compile time size of an entry in a MultiArray dimension list (0 if only known at runtime)
+ */
+template<typename Dimension>
+struct dimension_static_size : public std::integral_constant<std::size_t, 0>
+{
+};
+
+template<typename Dimension, std::size_t N>
+struct dimension_static_size<StaticDimensionSize<Dimension, N>> : public std::integral_constant<std::size_t, N>
+{
+};
+
+/**
+ * @brief
+ *      The storage for the size of an entry in a MultiArray dimension list
+ *
+ * @details Stores the size of runtime sized dimensions. Entries of the form
+ *          StaticDimensionSize<Dimension, N> take no storage and always return N.
+ */
+template<typename Dimension>
+class DimensionSizeStorage
+{
+    public:
+        DimensionSizeStorage();
+        explicit DimensionSizeStorage(DimensionSize<Dimension> const& size);
+
+        /// the size
+        DimensionSize<Dimension> get() const;
+
+        /// set the size
+        void set(DimensionSize<Dimension> const& size);
+
+    private:
+        DimensionSize<Dimension> _size;
+};
+
+/**
+ * @brief specialisation for dimensions with a static size
+ */
+template<typename Dimension, std::size_t N>
+class DimensionSizeStorage<StaticDimensionSize<Dimension, N>>
+{
+    public:
+        DimensionSizeStorage();
+
+        /**
+         * @throw std::invalid_argument if the size does not match the static size
+         */
+        explicit DimensionSizeStorage(DimensionSize<Dimension> const& size);
+
+        /// the size
+        DimensionSize<Dimension> get() const;
+
+        /**
+         * @brief set the size
+         * @throw std::invalid_argument if the size does not match the static size
+         */
+        void set(DimensionSize<Dimension> const& size);
+};
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/StaticDimensionSize.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_STATICDIMENSIONSIZE_H
@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_STRIDEDITERATOR_H
+#define PSS_ASTROTYPES_MULTIARRAY_STRIDEDITERATOR_H
+
+#include <iterator>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief
+ *      Random access iterator visiting every stride'th element of an underlying random access iterator
+ * @details
+ *      The iterator of a single dimension Slice, whose span may be strided.
+ *      With a stride of 1 it visits the same elements as the underlying iterator.
+ */
+template<typename BaseIteratorT>
+class StridedIterator
+{
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::iterator_traits<BaseIteratorT>::value_type value_type;
+        typedef typename std::iterator_traits<BaseIteratorT>::difference_type difference_type;
+        typedef typename std::iterator_traits<BaseIteratorT>::pointer pointer;
+        typedef typename std::iterator_traits<BaseIteratorT>::reference reference;
+
+    public:
+        StridedIterator();
+        StridedIterator(BaseIteratorT base, difference_type stride);
+
+        /// conversion from a non const iterator
+        template<typename OtherIteratorT, typename Enable=typename std::enable_if<std::is_convertible<OtherIteratorT, BaseIteratorT>::value>::type>
+        StridedIterator(StridedIterator<OtherIteratorT> const&);
+
+        /// the underlying iterator at the current position
+        BaseIteratorT const& base() const;
+
+        /// the number of underlying elements between consecutive elements
+        difference_type stride() const;
+
+        reference operator*() const;
+        pointer operator->() const;
+        reference operator[](difference_type n) const;
+
+        StridedIterator& operator++();
+        StridedIterator operator++(int);
+        StridedIterator& operator--();
+        StridedIterator operator--(int);
+        StridedIterator& operator+=(difference_type n);
+        StridedIterator& operator-=(difference_type n);
+        StridedIterator operator+(difference_type n) const;
+        StridedIterator operator-(difference_type n) const;
+
+        template<typename OtherIteratorT>
+        difference_type operator-(StridedIterator<OtherIteratorT> const&) const;
+
+        template<typename OtherIteratorT>
+        bool operator==(StridedIterator<OtherIteratorT> const&) const;
+        template<typename OtherIteratorT>
+        bool operator!=(StridedIterator<OtherIteratorT> const&) const;
+        template<typename OtherIteratorT>
+        bool operator<(StridedIterator<OtherIteratorT> const&) const;
+        template<typename OtherIteratorT>
+        bool operator>(StridedIterator<OtherIteratorT> const&) const;
+        template<typename OtherIteratorT>
+        bool operator<=(StridedIterator<OtherIteratorT> const&) const;
+        template<typename OtherIteratorT>
+        bool operator>=(StridedIterator<OtherIteratorT> const&) const;
+
+        friend StridedIterator operator+(difference_type n, StridedIterator const& it) { return it + n; }
+
+    private:
+        BaseIteratorT _base;
+        difference_type _stride;
+};
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/StridedIterator.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_STRIDEDITERATOR_H
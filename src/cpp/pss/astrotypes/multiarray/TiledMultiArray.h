@@ -0,0 +1,305 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_TILEDMULTIARRAY_H
+#define PSS_ASTROTYPES_MULTIARRAY_TILEDMULTIARRAY_H
+
+#include "DataBuffer.h"
+#include "DimensionIndex.h"
+#include "DimensionSize.h"
+#include "TypeTraits.h"
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief layout policy for a TiledMultiArray
+ * @details the data is stored as a sequence of OuterTileSize x InnerTileSize tiles, ordered along the
+ *          inner dimension first. Each tile is stored contiguously with the inner dimension fastest.
+ *          Tiles small enough to sit in the L1/L2 cache mean that sweeps along either dimension
+ *          touch only a few cache lines and pages at a time.
+ */
+template<std::size_t OuterTileSize, std::size_t InnerTileSize>
+struct TileLayout
+{
+    static_assert(OuterTileSize > 0 && InnerTileSize > 0, "tile sizes must be non zero");
+
+    static constexpr std::size_t outer_tile_size = OuterTileSize;
+    static constexpr std::size_t inner_tile_size = InnerTileSize;
+    static constexpr std::size_t tile_size = OuterTileSize * InnerTileSize;
+};
+
+template<std::size_t OuterTileSize, std::size_t InnerTileSize>
+constexpr std::size_t TileLayout<OuterTileSize, InnerTileSize>::outer_tile_size;
+
+template<std::size_t OuterTileSize, std::size_t InnerTileSize>
+constexpr std::size_t TileLayout<OuterTileSize, InnerTileSize>::inner_tile_size;
+
+template<std::size_t OuterTileSize, std::size_t InnerTileSize>
+constexpr std::size_t TileLayout<OuterTileSize, InnerTileSize>::tile_size;
+
+/**
+ * @brief iterator over a line of elements in a tiled layout
+ * @details steps through runs of elements inside each tile and jumps from the end of one run
+ *          to the start of the run in the next tile.
+ */
+template<typename T>
+class TiledIterator
+{
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::remove_const<T>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+    public:
+        TiledIterator(T* base, std::size_t offset, std::size_t index, std::size_t run_length, std::size_t step, std::size_t jump);
+
+        reference operator*() const;
+        pointer operator->() const;
+        TiledIterator& operator++();
+        TiledIterator operator++(int);
+
+        bool operator==(TiledIterator const&) const;
+        bool operator!=(TiledIterator const&) const;
+
+    private:
+        T* _base;
+        std::size_t _offset;
+        std::size_t _index;
+        std::size_t _run_pos;
+        std::size_t _run_length;
+        std::size_t _step;
+        std::size_t _jump;
+};
+
+/**
+ * @brief A line of elements along Dimension (e.g. a single spectrum or channel) of a TiledMultiArray
+ */
+template<typename T, typename Dimension>
+class TiledLine
+{
+    public:
+        typedef TiledIterator<T> iterator;
+        typedef TiledIterator<T const> const_iterator;
+        typedef typename std::remove_const<T>::type value_type;
+
+    public:
+        TiledLine(T* base, std::size_t offset, std::size_t size, std::size_t run_length, std::size_t step, std::size_t jump);
+
+        T& operator[](DimensionIndex<Dimension> index) const;
+
+        template<typename Dim>
+        DimensionSize<Dim> dimension() const;
+
+        iterator begin() const;
+        iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+    private:
+        T* _base;
+        std::size_t _offset;
+        std::size_t _size;
+        std::size_t _run_length;
+        std::size_t _step;
+        std::size_t _jump;
+};
+
+/**
+ * @brief direct access to a single tile of a TiledMultiArray
+ * @details rows along the inner dimension are contiguous and separated by row_stride() elements.
+ *          Tiles at the far edges may be only partially filled, as reported by dimension<>().
+ */
+template<typename T, typename OuterDimension, typename InnerDimension>
+class Tile
+{
+    public:
+        Tile(T* data, std::size_t row_stride, DimensionSize<OuterDimension> outer_size, DimensionSize<InnerDimension> inner_size);
+
+        /// pointer to the start of the row at the outer index (relative to this tile)
+        T* row(DimensionIndex<OuterDimension> index) const;
+        T& operator()(DimensionIndex<OuterDimension> outer, DimensionIndex<InnerDimension> inner) const;
+
+        T* data() const;
+        std::size_t row_stride() const;
+
+        template<typename Dim>
+        DimensionSize<Dim> dimension() const;
+
+    private:
+        T* _data;
+        std::size_t _row_stride;
+        std::size_t _outer_size;
+        std::size_t _inner_size;
+};
+
+// allows is_tiled_multiarray to work. Has no other function
+class TiledMultiArrayTag {
+    protected: // disable use as a polymorphic type base class
+        TiledMultiArrayTag() {}
+        ~TiledMultiArrayTag() {}
+};
+
+/**
+ * @brief A two dimensional array stored in tiles (see TileLayout)
+ * @details An alternative to MultiArray for algorithms that sweep both dimensions of a block,
+ *          such as dedispersion or transposes, where a pure row major layout is cache hostile
+ *          for one of the two directions.
+ *          operator[] returns a TiledLine along the other dimension with an iterator interface,
+ *          and tile aware algorithms can work directly on each Tile.
+ *          There is no Slice/SliceIterator interface: operator[] does not return a Slice, so sub-ranges,
+ *          multi-dimensional slicing and code written against MultiArray slices do not apply to this type.
+ *
+ *      @code
+ *      typedef TiledMultiArray<float, TileLayout<64, 64>, Time, Frequency> TiledType;
+ *      TiledType tiled(filterbank_data);                      // copy from a TimeFrequency (or FrequencyTime)
+ *      auto channel = tiled[DimensionIndex<Frequency>(10)];   // all the samples of channel 10
+ *      for(std::size_t t = 0; t < tiled.number_of_tiles<Time>(); ++t) {
+ *          for(std::size_t f = 0; f < tiled.number_of_tiles<Frequency>(); ++f) {
+ *              auto tile = tiled.tile(DimensionIndex<Time>(t), DimensionIndex<Frequency>(f));
+ *              ...
+ *          }
+ *      }
+ *      @endcode
+ *
+ * @tparam LayoutT : the TileLayout
+ */
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc=std::allocator<T>>
+class TiledMultiArray : public TiledMultiArrayTag
+{
+        typedef DataBuffer<T, Alloc> Container;
+
+    public:
+        typedef LayoutT LayoutType;
+        typedef T value_type;
+        typedef std::tuple<OuterDimension, InnerDimension> DimensionTuple;
+        typedef TiledLine<T, InnerDimension> OuterLineType;       // returned by operator[](DimensionIndex<OuterDimension>)
+        typedef TiledLine<T const, InnerDimension> ConstOuterLineType;
+        typedef TiledLine<T, OuterDimension> InnerLineType;       // returned by operator[](DimensionIndex<InnerDimension>)
+        typedef TiledLine<T const, OuterDimension> ConstInnerLineType;
+        typedef Tile<T, OuterDimension, InnerDimension> TileType;
+        typedef Tile<T const, OuterDimension, InnerDimension> ConstTileType;
+
+        static constexpr std::size_t rank = 2;
+
+    public:
+        TiledMultiArray();
+        TiledMultiArray(DimensionSize<OuterDimension>, DimensionSize<InnerDimension>);
+        TiledMultiArray(DimensionSize<InnerDimension>, DimensionSize<OuterDimension>);
+
+        /// @brief construct without initialising the data (for trivial types)
+        TiledMultiArray(NoInitialisation const&, DimensionSize<OuterDimension>, DimensionSize<InnerDimension>);
+
+        /**
+         * @brief copy the data from any type with the same two dimensions (in any order), e.g TimeFrequency or a Slice
+         */
+        template<typename DataT, typename Enable=typename std::enable_if<
+                    has_dimensions<DataT, OuterDimension, InnerDimension>::value
+                 && !std::is_base_of<TiledMultiArrayTag, DataT>::value>::type>
+        explicit TiledMultiArray(DataT const& data);
+
+        /**
+         * @brief return true if this array has dimesion D
+         */
+        template<typename D>
+        static constexpr bool has_dimension() { return std::is_same<D, OuterDimension>::value || std::is_same<D, InnerDimension>::value; }
+
+        template<typename Dim>
+        DimensionSize<Dim> dimension() const;
+
+        /// the number of elements (excluding any padding in the edge tiles)
+        std::size_t data_size() const;
+
+        /**
+         * @brief resize the array. Existing data is not preserved (all elements are reset to value_type())
+         */
+        void resize(DimensionSize<OuterDimension>, DimensionSize<InnerDimension>);
+
+        /// element access
+        T& operator()(DimensionIndex<OuterDimension>, DimensionIndex<InnerDimension>);
+        T const& operator()(DimensionIndex<OuterDimension>, DimensionIndex<InnerDimension>) const;
+
+        /// all the elements along the inner dimension at the outer index (e.g. a spectrum of a TimeFrequency layout)
+        OuterLineType operator[](DimensionIndex<OuterDimension>);
+        ConstOuterLineType operator[](DimensionIndex<OuterDimension>) const;
+
+        /// all the elements along the outer dimension at the inner index (e.g. a channel of a TimeFrequency layout)
+        InnerLineType operator[](DimensionIndex<InnerDimension>);
+        ConstInnerLineType operator[](DimensionIndex<InnerDimension>) const;
+
+        /**
+         * @brief the number of tiles across the specified dimension
+         */
+        template<typename Dim>
+        std::size_t number_of_tiles() const;
+
+        /**
+         * @brief direct access to a tile. The indices are in units of tiles.
+         */
+        TileType tile(DimensionIndex<OuterDimension> outer_tile, DimensionIndex<InnerDimension> inner_tile);
+        ConstTileType tile(DimensionIndex<OuterDimension> outer_tile, DimensionIndex<InnerDimension> inner_tile) const;
+
+        /**
+         * @brief copy the data from another structure with the same dimensions (in any order)
+         * @details the copy is done tile by tile so reading from e.g. a FrequencyTime stays cache friendly
+         * @throws std::invalid_argument if the sizes do not match
+         */
+        template<typename DataT>
+        void copy_from(DataT const& data);
+
+        /**
+         * @brief copy the data to another structure of the same size (in any order)
+         * @throws std::invalid_argument if the sizes do not match
+         */
+        template<typename DataT>
+        void copy_to(DataT& data) const;
+
+        bool operator==(TiledMultiArray const&) const;
+
+    private:
+        std::size_t offset(std::size_t outer, std::size_t inner) const;
+        std::size_t tile_offset(std::size_t outer_tile, std::size_t inner_tile) const;
+        void set_size(std::size_t outer, std::size_t inner);
+        template<typename DataT>
+        void check_size(DataT const& data, const char* msg) const;
+
+    private:
+        std::size_t _outer_size;
+        std::size_t _inner_size;
+        std::size_t _inner_tiles;
+        Container _data;
+};
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/TiledMultiArray.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_TILEDMULTIARRAY_H
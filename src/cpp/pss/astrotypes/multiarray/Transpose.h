@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_MULTIARRAY_TRANSPOSE_H
+#define PSS_ASTROTYPES_MULTIARRAY_TRANSPOSE_H
+
+#include <cstddef>
+#include <tuple>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+/**
+ * @brief The edge length (in elements) of the square tiles used by the blocked transpose
+ * @details chosen so that a source and destination tile together fit comfortably
+ *          inside a typical 32kB L1 data cache
+ */
+template<typename SrcT, typename DstT>
+struct TransposeTile
+{
+    static constexpr std::size_t value = (sizeof(SrcT) + sizeof(DstT) <= 2) ? 64
+                                       : (sizeof(SrcT) + sizeof(DstT) <= 8) ? 32
+                                       : 16;
+};
+
+/**
+ * @brief cache blocked transpose of a 2 dimensional block of memory
+ * @details copies size_a x size_b elements where the source is contiguous along a
+ *          (consecutive b elements are src_stride_b apart) and the destination is
+ *          contiguous along b (consecutive a elements are dst_stride_a apart).
+ *          The copy is done in TransposeTile sized tiles so that each cache line
+ *          read or written is fully used before eviction.
+ */
+template<typename SrcT, typename DstT>
+void tiled_transpose(SrcT const* src, std::size_t src_stride_b
+                   , DstT* dst, std::size_t dst_stride_a
+                   , std::size_t size_a, std::size_t size_b);
+
+/**
+ * @brief copy the data from one MultiArray to another with a different memory ordering
+ *        of the same dimensions
+ * @details dst must already be sized to match src. Both types must store their data
+ *          contiguously (i.e. be MultiArray types, not Slices).
+ *          The dimension that is contiguous in each type is found and the copy is
+ *          performed as a set of blocked 2D transposes over these two dimensions,
+ *          iterating over any remaining dimensions.
+ *          If the innermost dimension matches in both the data is copied
+ *          as contiguous runs.
+ * @code
+ *      TimeFrequency<uint8_t> tf(DimensionSize<Time>(100), DimensionSize<Frequency>(4096));
+ *      FrequencyTime<uint8_t> ft(DimensionSize<Time>(100), DimensionSize<Frequency>(4096));
+ *      transpose(ft, tf);
+ * @endcode
+ */
+template<typename DstArrayT, typename SrcArrayT>
+void transpose(DstArrayT& dst, SrcArrayT const& src);
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Transpose.cpp"
+
+#endif // PSS_ASTROTYPES_MULTIARRAY_TRANSPOSE_H
@@ -37,7 +37,7 @@ struct logical_and : public logical_and<typename logical_and<T1, T2>::type, Ts..
 {};
 
 template<typename T>
-struct logical_and<T, T> : public std::true_type
+struct logical_and<T, T> : public std::integral_constant<bool, T::value>
 {};
 
 template<typename T1, typename T2>
@@ -47,6 +47,7 @@ struct logical_and<T1, T2> : public std::false_type
 static_assert(logical_and<std::true_type, std::true_type>::value, "oh oh");
 static_assert(!logical_and<std::false_type, std::true_type>::value, "oh oh");
 static_assert(!logical_and<std::true_type, std::false_type>::value, "oh oh");
+static_assert(!logical_and<std::false_type, std::false_type>::value, "oh oh");
 static_assert(logical_and<std::true_type, std::true_type, std::true_type>::value, "oh oh");
 static_assert(!logical_and<std::false_type, std::true_type, std::true_type>::value, "oh oh");
 static_assert(!logical_and<std::true_type, std::true_type, std::false_type>::value, "oh oh");
@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -21,46 +21,164 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#ifndef PSS_ASTROTYPES_VIEW_H
-#define PSS_ASTROTYPES_VIEW_H
+#ifndef PSS_ASTROTYPES_MULTIARRAY_VIEW_H
+#define PSS_ASTROTYPES_MULTIARRAY_VIEW_H
 
+#include "IndexMapper.h"
+#include "ViewIterator.h"
+#include "DimensionIndex.h"
+#include "DimensionSize.h"
+#include "DataBuffer.h"
+#include "MultiArray.h"
+#include "TypeTraits.h"
+#include <memory>
+#include <tuple>
+#include <type_traits>
 
 namespace pss {
 namespace astrotypes {
+namespace multiarray {
 
 /**
  * @brief
+ *      A lazy view of a MultiArray or Slice with one dimension remapped through an IndexMapper
+ *
  * @details
+ *      No data is copied: indexing and iteration are passed through to the underlying data
+ *      with the indexes of the mapped dimension translated by the IndexMapper.
+ *      Use materialise() to gather the view into dense storage in a single pass.
+ *
+ *      Slices are held by value, anything else by reference, so the underlying data must
+ *      outlive the View. The IndexMapper is shared between the View, its iterators and any
+ *      sub-views, so iterators remain valid if the View itself is copied or destroyed.
+ * @code
+ *      // flip the band and drop flagged channels without copying
+ *      auto view = make_view(tf, IndexMapper<Frequency>::reverse(tf.dimension<Frequency>()));
+ *      float first_channel = view[DimensionIndex<Time>(0)][DimensionIndex<Frequency>(0)];
+ *
+ *      // and when a dense copy is needed
+ *      auto flipped = view.materialise<TimeFrequency<float>>();
+ * @endcode
  */
-
-template<typename MultiArrayType>
+template<typename DataT, typename Dimension>
 class View
 {
-        typedef View<MultiArrayType> SelfType;
+        typedef typename std::remove_const<DataT>::type BaseDataType;
+        typedef typename std::conditional<is_slice<BaseDataType>::value, BaseDataType, DataT&>::type StorageType;
+        typedef typename std::remove_reference<StorageType>::type& StorageRef;
+        typedef typename std::remove_reference<StorageType>::type const& ConstStorageRef;
+        typedef decltype(std::declval<StorageRef>().begin()) BaseIterator;
+        typedef decltype(std::declval<ConstStorageRef>().begin()) ConstBaseIterator;
 
     public:
-        typedef ViewIterator<SelfType> Iterator;
-        typedef const ViewIterator<SelfType> ConstIterator;
+        typedef typename BaseDataType::DimensionTuple DimensionTuple;
+        typedef IndexMapper<Dimension> MapperType;
+        typedef ViewIterator<BaseIterator, Dimension> iterator;
+        typedef ViewIterator<ConstBaseIterator, Dimension> const_iterator;
 
     public:
-        View(MultiArrayType&);
+        /**
+         * @throw std::invalid_argument if the mapper refers to indexes outside of the data
+         */
+        View(DataT& data, MapperType const& mapper);
         ~View();
 
-        Iterator begin();
-        Iterator end();
-        ConstIterator begin() const;
-        ConstIterator end() const;
-        ConstIterator cbegin() const;
-        ConstIterator cend() const;
+        /// @brief the mapped element or slice
+        auto operator[](DimensionIndex<Dimension> index)
+            -> decltype(std::declval<StorageRef>()[index]);
+        auto operator[](DimensionIndex<Dimension> index) const
+            -> decltype(std::declval<ConstStorageRef>()[index]);
+
+        /**
+         * @brief a View of the slice of a leading (unmapped) dimension
+         */
+        template<typename Dim>
+        typename std::enable_if<!std::is_same<Dim, Dimension>::value
+                               , View<typename std::remove_reference<decltype(std::declval<StorageRef>()[DimensionIndex<Dim>(0)])>::type, Dimension>>::type
+        operator[](DimensionIndex<Dim> index);
+
+        template<typename Dim>
+        typename std::enable_if<!std::is_same<Dim, Dimension>::value
+                               , View<typename std::remove_reference<decltype(std::declval<ConstStorageRef>()[DimensionIndex<Dim>(0)])>::type, Dimension>>::type
+        operator[](DimensionIndex<Dim> index) const;
+
+        /// @brief the size of the view in the specified dimension
+        template<typename Dim>
+        typename std::enable_if<std::is_same<Dim, Dimension>::value, DimensionSize<Dim>>::type
+        dimension() const;
+
+        template<typename Dim>
+        typename std::enable_if<!std::is_same<Dim, Dimension>::value, DimensionSize<Dim>>::type
+        dimension() const;
+
+        /// @brief the total number of elements in the view
+        std::size_t data_size() const;
+
+        /// @brief the map of the remapped dimension
+        MapperType const& mapper() const;
+
+        /// @brief iterate over the view in the order of the underlying data
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        /**
+         * @brief copy the view into dense storage of the same dimensions
+         * @details the copy is made a run of consecutive source indexes at a time
+         *          (see IndexMapper::runs), so an unmapped or simply reversed dimension
+         *          is copied in a few large blocks rather than element by element
+         * @throw std::invalid_argument if the sizes of out and the view differ
+         */
+        template<typename OutT>
+        void materialise(OutT& out) const;
 
+        /**
+         * @brief construct (without initialisation) and fill a dense copy of the view
+         * @tparam OutT a copyable type with the same dimensions as the view, providing a NoInitialisation constructor (e.g. TimeFrequency)
+         */
+        template<typename OutT>
+        OutT materialise() const;
 
     private:
-        MultiArrayType& _container;
+        template<typename, typename> friend class View;
+
+        // a sub-view sharing the (already validated) mapper
+        View(DataT& data, std::shared_ptr<MapperType const> const& mapper);
+
+        template<typename OutT, typename... Dims>
+        OutT construct(std::tuple<Dims...> const*) const;
+
+    private:
+        StorageType _data;
+        std::shared_ptr<MapperType const> _mapper;
+        std::size_t _outer_size;  // number of elements in the dimensions before Dimension
+        std::size_t _source_size; // size of Dimension in the underlying data
+        std::size_t _inner_size;  // number of elements in the dimensions after Dimension
 };
 
+/**
+ * @brief construct a View of the data with the Dimension remapped
+ * @details Slices may be passed as temporaries as they are held by value. Anything else is held
+ *          by reference and must be an lvalue that outlives the View.
+ */
+template<typename DataT, typename Dimension>
+typename std::enable_if<std::is_lvalue_reference<DataT>::value || is_slice<typename std::decay<DataT>::type>::value
+                       , View<typename std::remove_reference<DataT>::type, Dimension>>::type
+make_view(DataT&& data, IndexMapper<Dimension> const& mapper);
+
+/**
+ * @brief a View of a temporary MultiArray would refer to destroyed data
+ */
+template<typename DataT, typename Dimension>
+typename std::enable_if<!std::is_lvalue_reference<DataT>::value && !is_slice<typename std::decay<DataT>::type>::value>::type
+make_view(DataT&& data, IndexMapper<Dimension> const& mapper) = delete;
 
+} // namespace multiarray
 } // namespace astrotypes
 } // namespace pss
 #include "detail/View.cpp"
 
-#endif // PSS_ASTROTYPES_VIEW_H
+#endif // PSS_ASTROTYPES_MULTIARRAY_VIEW_H
@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -24,31 +24,71 @@
 #ifndef PSS_ASTROTYPES_MULTIARRAY_VIEWITERATOR_H
 #define PSS_ASTROTYPES_MULTIARRAY_VIEWITERATOR_H
 
+#include "IndexMapper.h"
+#include <cstddef>
+#include <iterator>
+#include <memory>
 
 namespace pss {
 namespace astrotypes {
+namespace multiarray {
 
 /**
  * @brief
- *      Iterate over a view
+ *      Iterate over a View
  * @details
+ *      Walks the view in the same order as the underlying data, with the indexes of the mapped
+ *      dimension passed through its IndexMapper. The underlying (random access) iterator is
+ *      repositioned once for each block of elements inside the mapped dimension, and simply incremented within it.
  */
-
-template<typename ViewType>
+template<typename BaseIteratorT, typename Dimension>
 class ViewIterator
 {
     public:
-        ViewIterator(ViewType&);
-        ~ViewIterator();
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::iterator_traits<BaseIteratorT>::value_type value_type;
+        typedef typename std::iterator_traits<BaseIteratorT>::difference_type difference_type;
+        typedef typename std::iterator_traits<BaseIteratorT>::pointer pointer;
+        typedef typename std::iterator_traits<BaseIteratorT>::reference reference;
+
+    public:
+        /**
+         * @param base          the begin iterator of the underlying data
+         * @param mapper        the map of the mapped dimension (shared so the iterator does not depend on the lifetime of the View)
+         * @param outer_size    the number of elements of the dimensions before the mapped dimension
+         * @param source_size   the size of the mapped dimension in the underlying data
+         * @param inner_size    the number of elements of the dimensions after the mapped dimension
+         * @param end           construct the end iterator
+         */
+        ViewIterator(BaseIteratorT base, std::shared_ptr<IndexMapper<Dimension> const> const& mapper
+                    , std::size_t outer_size, std::size_t source_size, std::size_t inner_size, bool end);
+
+        reference operator*() const;
+        pointer operator->() const;
 
         ViewIterator& operator++();
-        ViewIterator& operator++(int);
+        ViewIterator operator++(int);
+
+        bool operator==(ViewIterator const&) const;
+        bool operator!=(ViewIterator const&) const;
 
     private:
-        ViewType& _view;
-};
+        void reposition();
 
+    private:
+        BaseIteratorT _base;
+        BaseIteratorT _current;
+        std::shared_ptr<IndexMapper<Dimension> const> _mapper;
+        std::size_t _outer_size;
+        std::size_t _source_size;
+        std::size_t _inner_size;
+        std::size_t _size;
+        std::size_t _outer;
+        std::size_t _index;
+        std::size_t _inner;
+};
 
+} // namespace multiarray
 } // namespace astrotypes
 } // namespace pss
 #include "detail/ViewIterator.cpp"
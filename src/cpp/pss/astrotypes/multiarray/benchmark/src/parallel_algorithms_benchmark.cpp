@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include "pss/astrotypes/multiarray/ParallelAlgorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+/**
+ * Measures the scaling of the parallel MultiArray algorithms with the number of threads.
+ * Each algorithm is timed with a ThreadPoolExecutor of 1..max_threads threads and
+ * the speed up relative to a single thread reported.
+ *
+ * usage: parallel_algorithms_benchmark [spectra] [channels] [repeats] [max_threads]
+ */
+
+using namespace pss::astrotypes;
+
+namespace {
+
+struct Time {};
+struct Frequency {};
+
+template<typename T>
+class Mixin : public T
+{
+    public:
+        using T::T;
+        Mixin(T const& t) : T(t) {}
+};
+
+typedef multiarray::MultiArray<std::allocator<float>, float, Mixin, Time, Frequency> TfType;
+typedef multiarray::MultiArray<std::allocator<float>, float, Mixin, Frequency, Time> FtType;
+typedef std::chrono::high_resolution_clock ClockType;
+
+template<typename FnT>
+double time_it(unsigned repeats, FnT const& fn)
+{
+    fn(); // warm up (and start the threads)
+    auto start = ClockType::now();
+    for(unsigned i = 0; i < repeats; ++i) {
+        fn();
+    }
+    std::chrono::duration<double> elapsed = ClockType::now() - start;
+    return elapsed.count() / repeats;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t const spectra = argc > 1 ? std::atoi(argv[1]) : 16384;
+    std::size_t const channels = argc > 2 ? std::atoi(argv[2]) : 1024;
+    unsigned const repeats = argc > 3 ? std::atoi(argv[3]) : 5;
+    std::size_t const max_threads = argc > 4 ? std::atoi(argv[4]) : std::max(1U, std::thread::hardware_concurrency());
+
+    TfType tf{DimensionSize<Time>(spectra), DimensionSize<Frequency>(channels)};
+    TfType tf_copy{DimensionSize<Time>(spectra), DimensionSize<Frequency>(channels)};
+    FtType ft{DimensionSize<Frequency>(channels), DimensionSize<Time>(spectra)};
+    std::size_t const elements = tf.data_size();
+
+    std::cout << spectra << " spectra x " << channels << " channels (ms, speed up in brackets)\n";
+    std::cout << std::setw(8) << "threads";
+    for(auto name : { "fill", "copy", "transform", "reduce", "bandpass", "transpose" }) {
+        std::cout << std::setw(19) << name;
+    }
+    std::cout << "\n";
+
+    double baseline[6];
+    double check = 0;
+    for(std::size_t threads = 1; threads <= max_threads; ++threads) {
+        multiarray::ThreadPoolExecutor executor(threads);
+        double times[6];
+        times[0] = time_it(repeats, [&]() { multiarray::parallel_fill(executor, tf, 1.0f); });
+        times[1] = time_it(repeats, [&]() { multiarray::parallel_copy(executor, tf, tf_copy); });
+        times[2] = time_it(repeats, [&]() { multiarray::parallel_transform(executor, tf, tf_copy, [](float v) { return 2.0f * v + 1.0f; }); });
+        times[3] = time_it(repeats, [&]() { check += multiarray::parallel_reduce(executor, tf_copy, 0.0, std::plus<double>()); });
+        times[4] = time_it(repeats, [&]() { check += multiarray::parallel_reduce_by<Frequency>(executor, tf_copy, 0.0, std::plus<double>())[0]; });
+        times[5] = time_it(repeats, [&]() { multiarray::parallel_transpose(executor, ft, tf_copy); });
+        if(threads == 1) std::copy(times, times + 6, baseline);
+
+        std::cout << std::setw(8) << threads;
+        for(unsigned i = 0; i < 6; ++i) {
+            std::cout << std::setw(11) << std::fixed << std::setprecision(2) << times[i] * 1e3
+                      << " (" << std::setw(5) << baseline[i] / times[i] << ")";
+        }
+        std::cout << "\n";
+    }
+    std::cout << "checksum " << check / elements << "\n";
+
+    return 0;
+}
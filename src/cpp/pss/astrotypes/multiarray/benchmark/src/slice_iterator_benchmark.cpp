@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/**
+ * Compares traversal of a 2D slice of a MultiArray using the slice iterators against
+ * a raw pointer loop over the same elements, both sequentially and with random access.
+ * Also times a decimated (every 4th row) strided slice of the whole array.
+ *
+ * usage: slice_iterator_benchmark [size] [repeats]
+ */
+
+using namespace pss::astrotypes;
+
+namespace {
+
+struct DimensionA {};
+struct DimensionB {};
+
+template<typename T>
+class Mixin : public T
+{
+    public:
+        using T::T;
+        Mixin(T const& t) : T(t) {}
+};
+
+typedef multiarray::MultiArray<std::allocator<float>, float, Mixin, DimensionA, DimensionB> DataType;
+typedef std::chrono::high_resolution_clock ClockType;
+
+template<typename FnT>
+double time_it(unsigned repeats, FnT const& fn)
+{
+    auto start = ClockType::now();
+    for(unsigned i = 0; i < repeats; ++i) {
+        fn();
+    }
+    std::chrono::duration<double> elapsed = ClockType::now() - start;
+    return elapsed.count() / repeats;
+}
+
+void report(const char* name, double seconds, std::size_t elements, double check)
+{
+    std::cout << std::setw(34) << name
+              << std::setw(16) << seconds * 1e9 / elements
+              << std::setw(16) << check
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t const size = argc > 1 ? std::atoi(argv[1]) : 4096;
+    unsigned const repeats = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    DataType data{DimensionSize<DimensionA>(size), DimensionSize<DimensionB>(size)};
+    std::fill(data.begin(), data.end(), 1.0f);
+
+    // the central half of the array in each dimension
+    std::size_t const offset = size / 4;
+    std::size_t const width = size / 2;
+    auto slice = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(offset), DimensionSize<DimensionA>(width))
+                          , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(offset), DimensionSize<DimensionB>(width)));
+    std::size_t const elements = width * width;
+    float const* const base = &*data.cbegin();
+
+    std::cout << "slice of " << width << "x" << width << " elements (ns per element)\n";
+    std::cout << std::setw(34) << "method"
+              << std::setw(16) << "time"
+              << std::setw(16) << "check"
+              << "\n";
+
+    double sum = 0;
+    double t = time_it(repeats, [&]() {
+        sum = 0;
+        float const* row = base + offset * size + offset;
+        for(std::size_t i = 0; i < width; ++i, row += size) {
+            for(std::size_t j = 0; j < width; ++j) sum += row[j];
+        }
+    });
+    report("raw pointer", t, elements, sum);
+
+    t = time_it(repeats, [&]() {
+        sum = std::accumulate(slice.cbegin(), slice.cend(), 0.0);
+    });
+    report("slice iterator", t, elements, sum);
+
+    t = time_it(repeats, [&]() {
+        sum = 0;
+        slice.for_each_contiguous_run([&](float* begin, float* end) { sum = std::accumulate(begin, end, sum); });
+    });
+    report("for_each_contiguous_run", t, elements, sum);
+
+    t = time_it(repeats, [&]() {
+        sum = static_cast<double>(std::distance(slice.begin(), slice.end()));
+    });
+    report("std::distance", t, elements, sum);
+
+    // every 4th row of the whole array
+    std::size_t const decimation = 4;
+    auto strided = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(0), DimensionSize<DimensionA>(size / decimation), decimation));
+    std::size_t const strided_elements = strided.data_size();
+
+    t = time_it(repeats, [&]() {
+        sum = 0;
+        for(float const* row = base; row < base + (size / decimation) * decimation * size; row += decimation * size) {
+            for(std::size_t j = 0; j < size; ++j) sum += row[j];
+        }
+    });
+    report("strided raw pointer", t, strided_elements, sum);
+
+    t = time_it(repeats, [&]() {
+        sum = std::accumulate(strided.cbegin(), strided.cend(), 0.0);
+    });
+    report("strided slice iterator", t, strided_elements, sum);
+
+    t = time_it(repeats, [&]() {
+        sum = 0;
+        strided.for_each_contiguous_run([&](float* begin, float* end) { sum = std::accumulate(begin, end, sum); });
+    });
+    report("strided for_each_contiguous_run", t, strided_elements, sum);
+
+    // random access
+    std::vector<std::size_t> indices(elements / 16);
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<std::size_t> distribution(0, elements - 1);
+    std::generate(indices.begin(), indices.end(), [&]() { return distribution(generator); });
+
+    t = time_it(repeats, [&]() {
+        sum = 0;
+        float const* start = base + offset * size + offset;
+        for(std::size_t index : indices) sum += start[(index / width) * size + index % width];
+    });
+    report("raw pointer random", t, indices.size(), sum);
+
+    t = time_it(repeats, [&]() {
+        sum = 0;
+        auto const begin = slice.cbegin();
+        for(std::size_t index : indices) sum += begin[index];
+    });
+    report("slice iterator random", t, indices.size(), sum);
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <vector>
+
+/**
+ * Compares typical per spectrum kernels on a MultiArray whose channel dimension has a
+ * StaticDimensionSize with the same kernels on an identically sized runtime dimension.
+ * Each kernel is run both on raw row pointers and through the Slice/SliceIterator interface.
+ *
+ * usage: static_dimension_size_benchmark [spectra] [repeats]
+ */
+
+struct Time {};
+struct Frequency {};
+
+using namespace pss::astrotypes;
+
+typedef StaticDimensionSize<Frequency, 4096> StaticFrequency;
+
+namespace {
+
+template<typename T>
+class Mixin : public T
+{
+    public:
+        using T::T;
+        Mixin(T const& t) : T(t) {}
+};
+
+typedef multiarray::MultiArray<std::allocator<float>, float, Mixin, Time, Frequency> DynamicType;
+typedef multiarray::MultiArray<std::allocator<float>, float, Mixin, Time, StaticFrequency> StaticType;
+typedef std::chrono::high_resolution_clock ClockType;
+
+template<typename FnT>
+double time_it(unsigned repeats, FnT const& fn)
+{
+    fn(); // warm up
+    auto start = ClockType::now();
+    for(unsigned i = 0; i < repeats; ++i) {
+        fn();
+    }
+    std::chrono::duration<double> elapsed = ClockType::now() - start;
+    return elapsed.count() / repeats;
+}
+
+// sum each spectrum with the row length and stride taken from the array
+template<typename DataT>
+void spectrum_sums(DataT const& data, std::vector<float>& sums)
+{
+    std::size_t const spectra = data.template dimension<Time>();
+    for(std::size_t t = 0; t < spectra; ++t) {
+        float const* row = &*data.cbegin() + t * data.template block_size_t<Time>();
+        float sum = 0;
+        for(std::size_t c = 0; c < data.template dimension<Frequency>(); ++c) {
+            sum += row[c];
+        }
+        sums[t] = sum;
+    }
+}
+
+// subtract a bandpass from every spectrum
+template<typename DataT>
+void subtract_bandpass(DataT& data, std::vector<float> const& bandpass)
+{
+    std::size_t const spectra = data.template dimension<Time>();
+    for(std::size_t t = 0; t < spectra; ++t) {
+        float* row = &*data.begin() + t * data.template block_size_t<Time>();
+        for(std::size_t c = 0; c < data.template dimension<Frequency>(); ++c) {
+            row[c] -= bandpass[c];
+        }
+    }
+}
+
+// sum each spectrum through its Slice
+template<typename DataT>
+void slice_spectrum_sums(DataT const& data, std::vector<float>& sums)
+{
+    std::size_t const spectra = data.template dimension<Time>();
+    for(std::size_t t = 0; t < spectra; ++t) {
+        auto const spectrum = data[DimensionIndex<Time>(t)];
+        sums[t] = std::accumulate(spectrum.begin(), spectrum.end(), 0.0f);
+    }
+}
+
+// subtract a bandpass from every spectrum through its Slice
+template<typename DataT>
+void slice_subtract_bandpass(DataT& data, std::vector<float> const& bandpass)
+{
+    std::size_t const spectra = data.template dimension<Time>();
+    for(std::size_t t = 0; t < spectra; ++t) {
+        auto spectrum = data[DimensionIndex<Time>(t)];
+        auto bandpass_it = bandpass.begin();
+        for(float& value : spectrum) {
+            value -= *bandpass_it++;
+        }
+    }
+}
+
+// sum a two dimensional Slice (every spectrum but the first and last) with its SliceIterator
+template<typename DataT>
+float sub_slice_sum(DataT const& data)
+{
+    std::size_t const spectra = data.template dimension<Time>();
+    auto const block = data.slice(DimensionSpan<Time>(DimensionIndex<Time>(1), DimensionSize<Time>(spectra - 2)));
+    return std::accumulate(block.begin(), block.end(), 0.0f);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t const spectra = std::max(argc > 1 ? std::atoi(argv[1]) : 8192, 3);
+    unsigned const repeats = argc > 2 ? std::atoi(argv[2]) : 10;
+    std::size_t const channels = StaticFrequency::value;
+
+    DynamicType dynamic_data((DimensionSize<Time>(spectra)), DimensionSize<Frequency>(channels));
+    StaticType static_data((DimensionSize<Time>(spectra)), StaticFrequency());
+    std::iota(dynamic_data.begin(), dynamic_data.end(), 0.0f);
+    std::iota(static_data.begin(), static_data.end(), 0.0f);
+
+    std::vector<float> sums(spectra);
+    std::vector<float> bandpass(channels, 1.0f);
+
+    std::cout << "spectra=" << spectra << " channels=" << channels << " repeats=" << repeats << "\n";
+    std::cout << std::setw(24) << "kernel" << std::setw(16) << "dynamic (s)" << std::setw(16) << "static (s)" << std::setw(12) << "speedup" << "\n";
+
+    auto report = [&](std::string const& name, double dynamic_time, double static_time)
+    {
+        std::cout << std::setw(24) << name << std::setw(16) << dynamic_time << std::setw(16) << static_time
+                  << std::setw(12) << dynamic_time / static_time << "\n";
+    };
+
+    report("spectrum sums"
+          , time_it(repeats, [&]() { spectrum_sums(dynamic_data, sums); })
+          , time_it(repeats, [&]() { spectrum_sums(static_data, sums); }));
+
+    report("subtract bandpass"
+          , time_it(repeats, [&]() { subtract_bandpass(dynamic_data, bandpass); })
+          , time_it(repeats, [&]() { subtract_bandpass(static_data, bandpass); }));
+
+    report("slice spectrum sums"
+          , time_it(repeats, [&]() { slice_spectrum_sums(dynamic_data, sums); })
+          , time_it(repeats, [&]() { slice_spectrum_sums(static_data, sums); }));
+
+    report("slice subtract bandpass"
+          , time_it(repeats, [&]() { slice_subtract_bandpass(dynamic_data, bandpass); })
+          , time_it(repeats, [&]() { slice_subtract_bandpass(static_data, bandpass); }));
+
+    float volatile total = 0; // keep the sums from being optimised away
+    report("sub-slice iteration"
+          , time_it(repeats, [&]() { total = sub_slice_sum(dynamic_data); })
+          , time_it(repeats, [&]() { total = sub_slice_sum(static_data); }));
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+/// the type pointed to by the runs of a MultiArray or Slice (const if the object is const)
+template<typename DataT>
+using RunValueType = typename std::remove_reference<decltype(*std::declval<DataT&>().begin())>::type;
+
+/**
+ * @brief the position and shape of the contiguous runs of a MultiArray or Slice
+ * @details the runs of a Slice are all the same length (a run per row), uniform is false if this is not the case
+ */
+template<typename ValueT>
+struct RunLayout
+{
+    ValueT* first;
+    std::size_t count;
+    std::size_t length;
+    bool uniform;
+};
+
+template<typename DataT>
+RunLayout<RunValueType<DataT>> run_layout(DataT&& data)
+{
+    typedef RunValueType<DataT> ValueT;
+    RunLayout<ValueT> layout{nullptr, 0, 0, true};
+    data.for_each_contiguous_run([&](ValueT* begin, ValueT* end)
+                                 {
+                                     std::size_t const n = static_cast<std::size_t>(end - begin);
+                                     if(layout.count++ == 0) {
+                                         layout.first = begin;
+                                         layout.length = n;
+                                     }
+                                     else if(n != layout.length) {
+                                         layout.uniform = false;
+                                     }
+                                 });
+    return layout;
+}
+
+/**
+ * @brief call fn(dst_ptr, src_ptr, n) for matching contiguous runs of dst and src
+ * @details the runs of the two objects can differ in length (e.g. a MultiArray is one run, whereas a Slice
+ *          is a run per row) so they are split at the boundaries of either.
+ *          The src runs are walked in step with the dst runs using the src iterator, so nothing is allocated.
+ *          fn returns false to stop the walk early.
+ * @return false if fn stopped the walk
+ */
+template<typename DstT, typename SrcT, typename FunctionT>
+bool for_each_run_pair(DstT&& dst, SrcT&& src, FunctionT&& fn)
+{
+    typedef RunValueType<SrcT> SrcValueT;
+    typedef RunValueType<DstT> DstValueT;
+
+    auto const src_layout = run_layout(src);
+    if(src_layout.count == 0) return true;
+
+    bool more = true;
+    if(src_layout.count == 1) {
+        // src is a single block so follows the dst runs with a plain pointer
+        // (and if dst is also a single block fn is called just once)
+        SrcValueT* src_ptr = src_layout.first;
+        dst.for_each_contiguous_run([&](DstValueT* begin, DstValueT* end)
+                                    {
+                                        if(!more) return;
+                                        std::size_t const n = static_cast<std::size_t>(end - begin);
+                                        more = fn(begin, src_ptr, n);
+                                        src_ptr += n;
+                                    });
+        return more;
+    }
+
+    // step the src iterator a run at a time (an element at a time if the runs differ in length)
+    typedef decltype(src.begin()) SrcIteratorT;
+    typedef typename std::iterator_traits<SrcIteratorT>::difference_type DifferenceT;
+    std::size_t const src_run_length = src_layout.uniform ? src_layout.length : 1;
+    SrcIteratorT src_it = src.begin();
+    SrcValueT* src_ptr = src_layout.first;
+    std::size_t src_remaining = src_run_length;
+    src_it += static_cast<DifferenceT>(src_run_length);
+    dst.for_each_contiguous_run([&](DstValueT* begin, DstValueT* end)
+                                {
+                                    while(more && begin != end) {
+                                        if(src_remaining == 0) {
+                                            src_ptr = &*src_it;
+                                            src_it += static_cast<DifferenceT>(src_run_length);
+                                            src_remaining = src_run_length;
+                                        }
+                                        std::size_t const n = std::min(static_cast<std::size_t>(end - begin), src_remaining);
+                                        more = fn(begin, src_ptr, n);
+                                        begin += n;
+                                        src_ptr += n;
+                                        src_remaining -= n;
+                                    }
+                                });
+    return more;
+}
+
+#if defined(__SSE2__)
+// copy with non-temporal stores, 64 bytes at a time once the destination is 16 byte aligned
+inline void streaming_copy(void* dst, void const* src, std::size_t bytes)
+{
+    char* d = static_cast<char*>(dst);
+    char const* s = static_cast<char const*>(src);
+    std::size_t const head = (16 - reinterpret_cast<std::uintptr_t>(d) % 16) % 16;
+    if(bytes < head + 64) {
+        std::memcpy(d, s, bytes);
+        return;
+    }
+    std::memcpy(d, s, head);
+    d += head;
+    s += head;
+    bytes -= head;
+    for(; bytes >= 64; bytes -= 64, d += 64, s += 64) {
+        __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s));
+        __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + 16));
+        __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + 32));
+        __m128i const e = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), e);
+    }
+    std::memcpy(d, s, bytes);
+}
+
+// fill with non-temporal stores. sizeof(T) must divide 16
+template<typename T>
+void streaming_fill(T* dst, std::size_t n, T const& value)
+{
+    static_assert(16 % sizeof(T) == 0, "element size must divide 16");
+    constexpr std::size_t per_vector = 16 / sizeof(T);
+    while(n > 0 && reinterpret_cast<std::uintptr_t>(dst) % 16 != 0) {
+        *dst++ = value;
+        --n;
+    }
+    if(reinterpret_cast<std::uintptr_t>(dst) % 16 != 0) {
+        // elements are not aligned to their own size
+        std::fill(dst, dst + n, value);
+        return;
+    }
+    T pattern[per_vector];
+    std::fill(pattern, pattern + per_vector, value);
+    __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern));
+    for(; n >= per_vector; n -= per_vector, dst += per_vector) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+    std::fill(dst, dst + n, value);
+}
+
+// make the streaming stores visible before anything that follows
+inline void streaming_fence()
+{
+    _mm_sfence();
+}
+#else
+inline void streaming_copy(void* dst, void const* src, std::size_t bytes)
+{
+    std::memcpy(dst, src, bytes);
+}
+
+template<typename T>
+void streaming_fill(T* dst, std::size_t n, T const& value)
+{
+    std::fill(dst, dst + n, value);
+}
+
+inline void streaming_fence()
+{
+}
+#endif
+
+// -------- copy a single run ------------
+template<typename DstT, typename SrcT>
+void copy_run(DstT* dst, SrcT const* src, std::size_t n, bool)
+{
+    std::copy(src, src + n, dst);
+}
+
+template<typename T>
+typename std::enable_if<std::is_trivially_copyable<T>::value>::type
+copy_run(T* dst, T const* src, std::size_t n, bool streaming)
+{
+    if(streaming) {
+        streaming_copy(dst, src, n * sizeof(T));
+    }
+    else {
+        std::memcpy(dst, src, n * sizeof(T));
+    }
+}
+
+// -------- fill a single run ------------
+template<typename T, typename ValueT>
+void fill_run(T* dst, std::size_t n, ValueT const& value, bool, std::false_type)
+{
+    std::fill(dst, dst + n, value);
+}
+
+template<typename T>
+void fill_run(T* dst, std::size_t n, T const& value, bool streaming, std::true_type)
+{
+    if(streaming) {
+        streaming_fill(dst, n, value);
+    }
+    else if(sizeof(T) == 1) {
+        std::memset(dst, *reinterpret_cast<unsigned char const*>(&value), n);
+    }
+    else {
+        std::fill(dst, dst + n, value);
+    }
+}
+
+template<typename T>
+struct is_streamable : public std::integral_constant<bool, std::is_trivially_copyable<T>::value && 16 % sizeof(T) == 0>
+{};
+
+// -------- compare a single run ------------
+template<typename T1, typename T2>
+bool equal_run(T1 const* a, T2 const* b, std::size_t n)
+{
+    return std::equal(a, a + n, b);
+}
+
+// integer representations have no padding, and no values that compare equal with different bit patterns
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type
+equal_run(T const* a, T const* b, std::size_t n)
+{
+    return std::memcmp(a, b, n * sizeof(T)) == 0;
+}
+
+} // namespace detail
+
+template<typename SrcT, typename DstT>
+void bulk_copy(SrcT const& src, DstT&& dst)
+{
+    typedef detail::RunValueType<DstT> DstValueT;
+    typedef detail::RunValueType<SrcT const> SrcValueT;
+    if(src.data_size() != dst.data_size()) {
+        throw std::invalid_argument("bulk_copy: src and dst sizes differ");
+    }
+    bool const streaming = dst.data_size() * sizeof(DstValueT) >= streaming_store_bytes;
+    detail::for_each_run_pair(dst, src, [&](DstValueT* d, SrcValueT* s, std::size_t n)
+                                        {
+                                            detail::copy_run(d, s, n, streaming);
+                                            return true;
+                                        });
+    if(streaming) detail::streaming_fence();
+}
+
+template<typename DataT, typename T>
+void bulk_fill(DataT&& data, T const& value)
+{
+    typedef detail::RunValueType<DataT> ValueT;
+    typedef detail::is_streamable<ValueT> Streamable;
+    ValueT const v = static_cast<ValueT>(value);
+    bool const streaming = Streamable::value && data.data_size() * sizeof(ValueT) >= streaming_store_bytes;
+    data.for_each_contiguous_run([&](ValueT* begin, ValueT* end)
+                                 {
+                                     detail::fill_run(begin, static_cast<std::size_t>(end - begin), v, streaming, Streamable());
+                                 });
+    if(streaming) detail::streaming_fence();
+}
+
+template<typename DataA, typename DataB>
+bool bulk_equal(DataA const& a, DataB const& b)
+{
+    typedef detail::RunValueType<DataA const> ValueA;
+    typedef detail::RunValueType<DataB const> ValueB;
+    if(a.data_size() != b.data_size()) return false;
+    // stops at the first run pair that differs
+    return detail::for_each_run_pair(a, b, [](ValueA* pa, ValueB* pb, std::size_t n)
+                                           {
+                                               return detail::equal_run(pa, pb, n);
+                                           });
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,213 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <utility>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+template<typename ValueT, typename DimensionTuple>
+struct ArrayRefTypeHelper;
+
+template<typename ValueT, typename... Dimensions>
+struct ArrayRefTypeHelper<ValueT, std::tuple<Dimensions...>>
+{
+    typedef ArrayRef<ValueT, Dimensions...> type;
+};
+
+template<std::size_t Rank>
+std::array<std::size_t, Rank> contiguous_strides(std::array<std::size_t, Rank> const& extents)
+{
+    std::array<std::size_t, Rank> strides;
+    std::size_t stride = 1;
+    for(std::size_t i = Rank; i > 0; --i) {
+        strides[i - 1] = stride;
+        stride *= extents[i - 1];
+    }
+    return strides;
+}
+
+/**
+ * @brief the stride of Dimension in a Slice, measured as the distance to the first element at index 1
+ */
+template<typename Dimension, typename SliceT>
+std::size_t slice_stride(SliceT const& slice, std::size_t default_stride)
+{
+    if(static_cast<std::size_t>(slice.template dimension<Dimension>()) < 2) return default_stride;
+    SliceT copy(slice); // sub slices are taken from a non const copy as the const slice() is not available for all reduced slices
+    auto const next = copy.slice(DimensionSpan<Dimension>(DimensionIndex<Dimension>(1), DimensionSize<Dimension>(1)));
+    return static_cast<std::size_t>(&*next.begin() - &*slice.begin());
+}
+
+template<typename RefT, typename DataT, typename... Dimensions>
+RefT make_array_ref(DataT& data, std::tuple<Dimensions...> const*, std::true_type const&) // MultiArray
+{
+    typename RefT::ExtentsType const extents = {{ static_cast<std::size_t>(data.template dimension<Dimensions>())... }};
+    return RefT(data.data_size() == 0 ? nullptr : &*data.begin(), extents, contiguous_strides(extents));
+}
+
+template<typename RefT, typename DataT, typename... Dimensions>
+RefT make_array_ref(DataT& data, std::tuple<Dimensions...> const*, std::false_type const&) // Slice
+{
+    typedef std::tuple<Dimensions...> DimensionTuple;
+    typename RefT::ExtentsType const extents = {{ static_cast<std::size_t>(data.template dimension<Dimensions>())... }};
+    if(data.data_size() == 0) return RefT(nullptr, extents, contiguous_strides(extents));
+
+    typename RefT::ExtentsType const defaults = contiguous_strides(extents);
+    typename RefT::ExtentsType const strides = {{ slice_stride<Dimensions>(static_cast<typename std::remove_const<DataT>::type const&>(data), defaults[find_type<DimensionTuple, Dimensions>::value])... }};
+    return RefT(&*data.begin(), extents, strides);
+}
+
+} // namespace detail
+
+template<typename DataT>
+struct ArrayRefType
+{
+    private:
+        typedef typename std::remove_reference<DataT>::type BaseT;
+        typedef typename std::remove_reference<decltype(*std::declval<BaseT&>().begin())>::type ValueT;
+
+    public:
+        typedef typename detail::ArrayRefTypeHelper<ValueT, typename std::decay<DataT>::type::DimensionTuple>::type type;
+};
+
+template<typename T, typename... Dimensions>
+ArrayRef<T, Dimensions...>::ArrayRef()
+    : _data(nullptr)
+    , _extents()
+    , _strides()
+{
+}
+
+template<typename T, typename... Dimensions>
+ArrayRef<T, Dimensions...>::ArrayRef(T* data, DimensionSize<Dimensions>... extents)
+    : _data(data)
+    , _extents{{ static_cast<std::size_t>(extents)... }}
+    , _strides(detail::contiguous_strides(_extents))
+{
+}
+
+template<typename T, typename... Dimensions>
+ArrayRef<T, Dimensions...>::ArrayRef(T* data, ExtentsType const& extents, ExtentsType const& strides)
+    : _data(data)
+    , _extents(extents)
+    , _strides(strides)
+{
+}
+
+template<typename T, typename... Dimensions>
+template<typename OtherT, typename Enable>
+ArrayRef<T, Dimensions...>::ArrayRef(ArrayRef<OtherT, Dimensions...> const& other)
+    : _data(other._data)
+    , _extents(other._extents)
+    , _strides(other._strides)
+{
+}
+
+template<typename T, typename... Dimensions>
+inline T* ArrayRef<T, Dimensions...>::data() const
+{
+    return _data;
+}
+
+template<typename T, typename... Dimensions>
+inline std::size_t const* ArrayRef<T, Dimensions...>::extents() const
+{
+    return _extents.data();
+}
+
+template<typename T, typename... Dimensions>
+inline std::size_t const* ArrayRef<T, Dimensions...>::strides() const
+{
+    return _strides.data();
+}
+
+template<typename T, typename... Dimensions>
+template<typename Dim>
+inline DimensionSize<Dim> ArrayRef<T, Dimensions...>::dimension() const
+{
+    return DimensionSize<Dim>(_extents[find_type<DimensionTuple, Dim>::value]);
+}
+
+template<typename T, typename... Dimensions>
+template<typename Dim>
+inline std::size_t ArrayRef<T, Dimensions...>::stride() const
+{
+    return _strides[find_type<DimensionTuple, Dim>::value];
+}
+
+template<typename T, typename... Dimensions>
+std::size_t ArrayRef<T, Dimensions...>::data_size() const
+{
+    std::size_t size = 1;
+    for(std::size_t extent : _extents) size *= extent;
+    return size;
+}
+
+template<typename T, typename... Dimensions>
+bool ArrayRef<T, Dimensions...>::is_contiguous() const
+{
+    std::size_t expected = 1;
+    for(std::size_t i = rank; i > 0; --i) {
+        if(_extents[i - 1] > 1 && _strides[i - 1] != expected) return false;
+        expected *= _extents[i - 1];
+    }
+    return true;
+}
+
+template<typename T, typename... Dimensions>
+template<typename Dim, typename... Dims>
+inline std::size_t ArrayRef<T, Dimensions...>::offset(DimensionIndex<Dim> const& index, DimensionIndex<Dims> const&... indexes) const
+{
+    return static_cast<std::size_t>(index) * _strides[find_type<DimensionTuple, Dim>::value] + offset(indexes...);
+}
+
+template<typename T, typename... Dimensions>
+inline std::size_t ArrayRef<T, Dimensions...>::offset() const
+{
+    return 0;
+}
+
+template<typename T, typename... Dimensions>
+template<typename... Dims>
+inline T& ArrayRef<T, Dimensions...>::operator()(DimensionIndex<Dims>... indexes) const
+{
+    static_assert(sizeof...(Dims) == rank, "an index must be provided for every dimension");
+    return _data[offset(indexes...)];
+}
+
+template<typename DataT>
+typename ArrayRefType<DataT>::type make_array_ref(DataT&& data)
+{
+    typedef typename std::decay<DataT>::type BaseT;
+    typedef typename ArrayRefType<DataT>::type RefT;
+    return detail::make_array_ref<RefT>(data
+                                       , static_cast<typename BaseT::DimensionTuple const*>(nullptr)
+                                       , std::integral_constant<bool, is_multiarray<BaseT>::value>());
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -23,6 +23,7 @@
  */
 
 #include <algorithm>
+#include <memory>
 
 namespace pss {
 namespace astrotypes {
@@ -31,7 +32,7 @@ namespace detail {
 template<typename T, typename Alloc>
 DataBufferImplAllocator<T, Alloc>::AllocatedMemory::AllocatedMemory(Alloc& alloc, std::size_t capacity)
     : _alloc(&alloc)
-    , _m_start(alloc.allocate(capacity))
+    , _m_start(capacity ? alloc.allocate(capacity) : nullptr)
     , _m_end_of_storage(_m_start + capacity)
 {
 }
@@ -53,6 +54,15 @@ DataBufferImplAllocator<T, Alloc>::AllocatedMemory::AllocatedMemory(AllocatedMem
     mem._m_start = nullptr;
 }
 
+template<typename T, typename Alloc>
+DataBufferImplAllocator<T, Alloc>::AllocatedMemory::AllocatedMemory(AllocatedMemory&& mem, Alloc& alloc)
+    : _alloc(&alloc)
+    , _m_start(mem._m_start)
+    , _m_end_of_storage(mem._m_end_of_storage)
+{
+    mem._m_start = nullptr;
+}
+
 template<typename T, typename Alloc>
 DataBufferImplAllocator<T, Alloc>::AllocatedMemory::~AllocatedMemory()
 {
@@ -122,7 +132,7 @@ DataBufferImpl<T, Alloc, false>::DataBufferImpl(std::size_t size, T const& val,
 
 template<typename T, typename Alloc>
 DataBufferImpl<T, Alloc, false>::DataBufferImpl(DataBufferImpl const& vec)
-    : _allocator(vec._allocator)
+    : _allocator(std::allocator_traits<Alloc>::select_on_container_copy_construction(static_cast<Alloc const&>(vec._allocator)))
     , _m_alloc(_allocator.allocate(vec.size()))
     , _m_finish(_m_alloc.end())
 {
@@ -152,7 +162,7 @@ DataBufferImpl<T, Alloc, false>::DataBufferImpl(std::vector<T, OtherAlloc> const
 template<typename T, typename Alloc>
 DataBufferImpl<T, Alloc, false>::DataBufferImpl(DataBufferImpl&& vec)
     : _allocator(vec._allocator)
-    , _m_alloc(std::move(vec._m_alloc))
+    , _m_alloc(std::move(vec._m_alloc), _allocator)
     , _m_finish(vec._m_finish)
 {
     vec._m_finish = nullptr;
@@ -252,9 +262,27 @@ std::size_t DataBufferImpl<T, Alloc, false>::size() const
 }
 
 template<typename T, typename Alloc>
-std::size_t DataBufferImpl<T, Alloc, false>::max_size()
+T* DataBufferImpl<T, Alloc, false>::data()
+{
+    return this->_m_alloc.start();
+}
+
+template<typename T, typename Alloc>
+T const* DataBufferImpl<T, Alloc, false>::data() const
+{
+    return this->_m_alloc.start();
+}
+
+template<typename T, typename Alloc>
+std::size_t DataBufferImpl<T, Alloc, false>::max_size() const
+{
+    return std::allocator_traits<Alloc>::max_size(static_cast<Alloc const&>(this->_allocator));
+}
+
+template<typename T, typename Alloc>
+bool DataBufferImpl<T, Alloc, false>::empty() const
 {
-    return this->_allocator.max_size();
+    return this->_m_finish == this->_m_alloc.start();
 }
 
 template<typename T, typename Alloc>
@@ -266,9 +294,9 @@ std::size_t DataBufferImpl<T, Alloc, false>::capacity() const
 template<typename T, typename Alloc>
 void DataBufferImpl<T, Alloc, false>::resize(std::size_t size, T const& val)
 {
-    std::size_t last_index = this->size() - 1;
+    std::size_t const old_size = this->size();
     this->resize(size);
-    std::fill(this->begin() + last_index, end(), val);
+    if(size > old_size) std::fill(this->begin() + old_size, end(), val);
 }
 
 template<typename T, typename Alloc>
@@ -276,11 +304,26 @@ void DataBufferImpl<T, Alloc, false>::resize(std::size_t size)
 {
     if(size < this->size())
         this->_m_finish = this->_m_alloc.start() + size;
-    else if( size > this->size())
+    else if(size > this->capacity())
     {
         this->m_extend(size);
         _m_finish = this->_m_alloc.end();
     }
+    else {
+        // grow within existing storage
+        this->_m_finish = this->_m_alloc.start() + size;
+    }
+}
+
+template<typename T, typename Alloc>
+void DataBufferImpl<T, Alloc, false>::resize_initialised(std::size_t size)
+{
+    std::size_t const old_size = this->size();
+    this->resize(size);
+    Alloc& allocator = _allocator;
+    for(T* it = this->begin() + std::min(old_size, size); it != this->end(); ++it) {
+        std::allocator_traits<Alloc>::construct(allocator, it);
+    }
 }
 
 template<typename T, typename Alloc>
@@ -335,7 +378,10 @@ void DataBufferImpl<T, Alloc, false>::m_extend(std::size_t len)
 {
     AllocatedMemory new_mem = _allocator.allocate(len);
     T* new_start=new_mem.start();
-    std::copy(cbegin(), cend(), new_start);
+    // zero sized allocations are skipped, so new_start may be null when there is nothing to copy
+    if(new_start != nullptr && this->_m_finish != this->_m_alloc.start()) {
+        std::copy(cbegin(), cend(), new_start);
+    }
     this->_m_alloc = std::move(new_mem);
 }
 
@@ -364,6 +410,18 @@ DataBuffer<T, Alloc>::DataBuffer(Args&&... args)
 {
 }
 
+template<typename T, typename Alloc>
+DataBuffer<T, Alloc>::DataBuffer(DataBuffer const& other)
+    : BaseT(static_cast<BaseT const&>(other))
+{
+}
+
+template<typename T, typename Alloc>
+DataBuffer<T, Alloc>::DataBuffer(DataBuffer&& other)
+    : BaseT(std::move(static_cast<BaseT&>(other)))
+{
+}
+
 template<typename T, typename Alloc>
 DataBuffer<T, Alloc>::~DataBuffer()
 {
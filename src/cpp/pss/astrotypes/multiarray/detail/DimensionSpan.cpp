@@ -22,6 +22,8 @@
  * SOFTWARE.
  */
 
+#include <stdexcept>
+
 namespace pss {
 namespace astrotypes {
 
@@ -29,6 +31,7 @@ template<typename Dimension>
 DimensionSpan<Dimension>::DimensionSpan(DimensionIndex<Dimension> start_index, DimensionIndex<Dimension> end_index)
     : _start_index(start_index)
     , _span(end_index - start_index + 1)
+    , _stride(1)
 {
 }
 
@@ -36,14 +39,32 @@ template<typename Dimension>
 DimensionSpan<Dimension>::DimensionSpan(DimensionIndex<Dimension> start_index, DimensionSize<Dimension> size)
     : _start_index(start_index)
     , _span(size)
+    , _stride(1)
 {
 }
 
+template<typename Dimension>
+DimensionSpan<Dimension>::DimensionSpan(DimensionIndex<Dimension> start_index, DimensionSize<Dimension> size, std::size_t stride)
+    : _start_index(start_index)
+    , _span(size)
+    , _stride(stride)
+{
+    if(stride == 0) throw std::invalid_argument("DimensionSpan: stride must be non zero");
+}
+
 template<typename Dimension>
 DimensionSpan<Dimension>::DimensionSpan(DimensionSize<Dimension> size)
     : _start_index(0)
     , _span(size)
+    , _stride(1)
+{
+}
+
+template<typename Dimension>
+void DimensionSpan<Dimension>::stride(std::size_t s)
 {
+    if(s == 0) throw std::invalid_argument("DimensionSpan: stride must be non zero");
+    _stride = s;
 }
 
 template<typename Dimension>
@@ -54,15 +75,16 @@ DimensionSpan<Dimension>& DimensionSpan<Dimension>::trim(DimensionSize<Dimension
         _span = DimensionSize<Dimension>(0);
         return *this;
     }
-    DimensionSize<Dimension> delta = bounds - _start_index;
-    if(_span > delta) _span = delta;
+    // the number of indices available from the start
+    std::size_t const available = (static_cast<std::size_t>(bounds - _start_index) - 1) / _stride + 1;
+    if(static_cast<std::size_t>(_span) > available) _span = DimensionSize<Dimension>(available);
     return *this;
 }
 
 template<typename Dimension>
 bool DimensionSpan<Dimension>::operator==(DimensionSpan<Dimension> const& span) const
 {
-    return _start_index == span._start_index && _span == span._span;
+    return _start_index == span._start_index && _span == span._span && (_stride == span._stride || static_cast<std::size_t>(_span) <= 1);
 }
 
 template<typename Dimension>
@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+inline std::size_t SerialExecutor::concurrency() const
+{
+    return 1;
+}
+
+template<typename FunctionT>
+void SerialExecutor::parallel_for(std::size_t number_of_tasks, FunctionT const& fn)
+{
+    for(std::size_t task = 0; task < number_of_tasks; ++task) {
+        fn(task);
+    }
+}
+
+inline ThreadPoolExecutor::ThreadPoolExecutor(std::size_t number_of_threads)
+    : _task(nullptr)
+    , _number_of_tasks(0)
+    , _next_task(0)
+    , _tasks_completed(0)
+    , _active_threads(0)
+    , _generation(0)
+    , _stop(false)
+{
+    for(std::size_t i = 1; i < number_of_threads; ++i) {
+        _threads.emplace_back(&ThreadPoolExecutor::worker, this);
+    }
+}
+
+inline ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start_condition.notify_all();
+    for(auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+inline ThreadPoolExecutor::TaskScope::TaskScope(ThreadPoolExecutor const* executor)
+    : _executor(executor)
+    , _previous(current())
+{
+    current() = this;
+}
+
+inline ThreadPoolExecutor::TaskScope::~TaskScope()
+{
+    current() = _previous;
+}
+
+inline ThreadPoolExecutor::TaskScope const*& ThreadPoolExecutor::TaskScope::current()
+{
+    static thread_local TaskScope const* scope = nullptr;
+    return scope;
+}
+
+inline bool ThreadPoolExecutor::TaskScope::running(ThreadPoolExecutor const* executor)
+{
+    for(TaskScope const* scope = current(); scope != nullptr; scope = scope->_previous) {
+        if(scope->_executor == executor) return true;
+    }
+    return false;
+}
+
+inline bool ThreadPoolExecutor::TaskScope::running()
+{
+    return current() != nullptr;
+}
+
+inline std::size_t ThreadPoolExecutor::concurrency() const
+{
+    return _threads.size() + 1;
+}
+
+template<typename FunctionT>
+void ThreadPoolExecutor::parallel_for(std::size_t number_of_tasks, FunctionT const& fn)
+{
+    if(number_of_tasks == 0) return;
+    if(number_of_tasks == 1 || _threads.empty() || TaskScope::running(this)) {
+        for(std::size_t task = 0; task < number_of_tasks; ++task) {
+            fn(task);
+        }
+        return;
+    }
+    execute(number_of_tasks, std::function<void(std::size_t)>(std::cref(fn)));
+}
+
+inline void ThreadPoolExecutor::execute(std::size_t number_of_tasks, std::function<void(std::size_t)> const& fn)
+{
+    std::unique_lock<std::mutex> call_lock(_call_mutex, std::defer_lock);
+    if(TaskScope::running()) {
+        // blocking here from within a task of another pool could deadlock
+        if(!call_lock.try_lock()) {
+            for(std::size_t task = 0; task < number_of_tasks; ++task) {
+                fn(task);
+            }
+            return;
+        }
+    }
+    else {
+        call_lock.lock();
+    }
+    std::size_t generation;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _task = &fn;
+        _number_of_tasks = number_of_tasks;
+        _next_task = 0;
+        _tasks_completed = 0;
+        _exception = nullptr;
+        generation = ++_generation;
+    }
+    _start_condition.notify_all();
+
+    run_tasks(generation);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    // wait for stragglers too so no thread can pick up an index belonging to the next call
+    _done_condition.wait(lock, [this]() { return _tasks_completed == _number_of_tasks && _active_threads == 0; });
+    _task = nullptr;
+    if(_exception) {
+        std::exception_ptr exception = _exception;
+        _exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+inline void ThreadPoolExecutor::run_tasks(std::size_t generation)
+{
+    std::function<void(std::size_t)> const* task;
+    std::size_t number_of_tasks;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(generation != _generation || _task == nullptr) return;
+        task = _task;
+        number_of_tasks = _number_of_tasks;
+        ++_active_threads;
+    }
+
+    std::size_t completed = 0;
+    std::exception_ptr exception;
+    TaskScope const scope(this);
+    while(true) {
+        std::size_t const index = _next_task++;
+        if(index >= number_of_tasks) break;
+        try {
+            (*task)(index);
+        }
+        catch(...) {
+            if(!exception) exception = std::current_exception();
+        }
+        ++completed;
+    }
+
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(exception && !_exception) _exception = exception;
+        _tasks_completed += completed;
+        --_active_threads;
+        done = (_tasks_completed == _number_of_tasks && _active_threads == 0);
+    }
+    if(done) _done_condition.notify_all();
+}
+
+inline void ThreadPoolExecutor::worker()
+{
+    std::size_t generation = 0;
+    while(true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _start_condition.wait(lock, [&]() { return _stop || _generation != generation; });
+            if(_stop) return;
+            generation = _generation;
+        }
+        run_tasks(generation);
+    }
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,501 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+// ------------------------------------------------------------------
+// --------------- element wise operations --------------------------
+// ------------------------------------------------------------------
+struct Add
+{
+    template<typename T1, typename T2>
+    auto operator()(T1 const& a, T2 const& b) const -> decltype(a + b) { return a + b; }
+};
+
+struct Subtract
+{
+    template<typename T1, typename T2>
+    auto operator()(T1 const& a, T2 const& b) const -> decltype(a - b) { return a - b; }
+};
+
+struct Multiply
+{
+    template<typename T1, typename T2>
+    auto operator()(T1 const& a, T2 const& b) const -> decltype(a * b) { return a * b; }
+};
+
+struct Divide
+{
+    template<typename T1, typename T2>
+    auto operator()(T1 const& a, T2 const& b) const -> decltype(a / b) { return a / b; }
+};
+
+struct Negate
+{
+    template<typename T>
+    auto operator()(T const& a) const -> decltype(-a) { return -a; }
+};
+
+// ------------------------------------------------------------------
+// --------------- operator argument helpers ------------------------
+// ------------------------------------------------------------------
+template<typename T>
+struct Operand<T, typename std::enable_if<is_expression<T>::value>::type>
+{
+    typedef typename std::decay<T>::type type;
+    static type const& make(T const& expression) { return expression; }
+};
+
+template<typename T>
+struct Operand<T, typename std::enable_if<is_expression_array<T>::value>::type>
+{
+    typedef ArrayOperand<typename std::decay<T>::type> type;
+    static type make(T const& array) { return type(array); }
+};
+
+template<typename T>
+struct Operand<T, typename std::enable_if<!is_expression<T>::value && !is_expression_array<T>::value>::type>
+{
+    typedef ScalarOperand<typename std::decay<T>::type> type;
+    static type make(T const& value) { return type(value); }
+};
+
+template<typename LhsT, typename RhsT>
+struct is_expression_arguments : public std::integral_constant<bool, is_expression<LhsT>::value || is_expression_array<LhsT>::value
+                                                                  || is_expression<RhsT>::value || is_expression_array<RhsT>::value>
+{
+};
+
+// true if every dimension in SubTupleT is also in TupleT
+template<typename TupleT, typename SubTupleT>
+struct has_all_dimensions;
+
+template<typename TupleT, typename Dimension, typename... Dimensions>
+struct has_all_dimensions<TupleT, std::tuple<Dimension, Dimensions...>>
+    : public std::integral_constant<bool, has_type<TupleT, Dimension>::value && has_all_dimensions<TupleT, std::tuple<Dimensions...>>::value>
+{
+};
+
+template<typename TupleT>
+struct has_all_dimensions<TupleT, std::tuple<>> : public std::true_type
+{
+};
+
+// ------------------------------------------------------------------
+// --------------- mapping operands onto the destination ------------
+// ------------------------------------------------------------------
+// the number of elements between consecutive indices of Dimension
+template<typename Dimension, typename ArrayT>
+std::size_t element_stride(ArrayT const& array, std::true_type /* is a slice */)
+{
+    return array.parent().template block_size_t<Dimension>() * array.template span<Dimension>().stride();
+}
+
+template<typename Dimension, typename ArrayT>
+std::size_t element_stride(ArrayT const& array, std::false_type /* is a slice */)
+{
+    return array.template block_size_t<Dimension>();
+}
+
+template<typename Dimension, typename ArrayT>
+std::size_t operand_stride(ArrayT const& array, std::size_t size, std::true_type /* has Dimension */)
+{
+    if(static_cast<std::size_t>(array.template dimension<Dimension>()) != size) {
+        throw std::invalid_argument("expression operand dimension size does not match the destination");
+    }
+    return element_stride<Dimension>(array, std::integral_constant<bool, is_slice<ArrayT>::value>());
+}
+
+template<typename Dimension, typename ArrayT>
+std::size_t operand_stride(ArrayT const&, std::size_t, std::false_type /* has Dimension */)
+{
+    // broadcast along the missing dimension
+    return 0;
+}
+
+// the strides of array for each of DstDimensions, in the order of DstDimensions
+template<typename ArrayT, typename... DstDimensions>
+std::array<std::size_t, sizeof...(DstDimensions)> operand_strides(ArrayT const& array
+                                                                 , std::array<std::size_t, sizeof...(DstDimensions)> const& sizes)
+{
+    typedef std::tuple<DstDimensions...> DstDimensionTuple;
+    typedef typename ArrayT::DimensionTuple DimensionTuple;
+    return {{ operand_stride<DstDimensions>(array
+                                           , sizes[find_type<DstDimensionTuple, DstDimensions>::value]
+                                           , std::integral_constant<bool, has_type<DimensionTuple, DstDimensions>::value>())... }};
+}
+
+// ------------------------------------------------------------------
+// --------------- evaluators ---------------------------------------
+// ------------------------------------------------------------------
+/*
+ * Evaluators walk the destination one row (i.e. run of the innermost destination dimension) at a time.
+ * row() is called with the index of each of the destination dimensions at the start of the row, and
+ * at<UnitStride>(i) then provides the value for the i'th element of that row.
+ * UnitStride=true may only be used when unit_stride() is true.
+ */
+template<typename PointerT, std::size_t Rank>
+class ArrayEvaluator
+{
+    public:
+        typedef typename std::iterator_traits<PointerT>::reference reference;
+
+    public:
+        ArrayEvaluator(PointerT base, std::array<std::size_t, Rank> const& strides)
+            : _base(base)
+            , _row(base)
+            , _strides(strides)
+        {
+        }
+
+        void row(std::array<std::size_t, Rank> const& index)
+        {
+            std::size_t offset = 0;
+            for(std::size_t i = 0; i + 1 < Rank; ++i) {
+                offset += index[i] * _strides[i];
+            }
+            _row = _base + offset;
+        }
+
+        template<bool UnitStride>
+        reference at(std::size_t i) const
+        {
+            return UnitStride ? _row[i] : _row[i * _strides[Rank - 1]];
+        }
+
+        bool unit_stride() const
+        {
+            return _strides[Rank - 1] == 1;
+        }
+
+    private:
+        PointerT _base;
+        PointerT _row;
+        std::array<std::size_t, Rank> _strides;
+};
+
+template<typename OpT, typename EvaluatorT>
+class UnaryEvaluator
+{
+    public:
+        explicit UnaryEvaluator(EvaluatorT const& evaluator)
+            : _evaluator(evaluator)
+        {
+        }
+
+        template<std::size_t Rank>
+        void row(std::array<std::size_t, Rank> const& index)
+        {
+            _evaluator.row(index);
+        }
+
+        template<bool UnitStride>
+        auto at(std::size_t i) const -> decltype(std::declval<OpT const&>()(std::declval<EvaluatorT const&>().template at<UnitStride>(i)))
+        {
+            return _op(_evaluator.template at<UnitStride>(i));
+        }
+
+        bool unit_stride() const
+        {
+            return _evaluator.unit_stride();
+        }
+
+    private:
+        OpT _op;
+        EvaluatorT _evaluator;
+};
+
+template<typename OpT, typename LhsEvaluatorT, typename RhsEvaluatorT>
+class BinaryEvaluator
+{
+    public:
+        BinaryEvaluator(LhsEvaluatorT const& lhs, RhsEvaluatorT const& rhs)
+            : _lhs(lhs)
+            , _rhs(rhs)
+        {
+        }
+
+        template<std::size_t Rank>
+        void row(std::array<std::size_t, Rank> const& index)
+        {
+            _lhs.row(index);
+            _rhs.row(index);
+        }
+
+        template<bool UnitStride>
+        auto at(std::size_t i) const -> decltype(std::declval<OpT const&>()(std::declval<LhsEvaluatorT const&>().template at<UnitStride>(i)
+                                                                          , std::declval<RhsEvaluatorT const&>().template at<UnitStride>(i)))
+        {
+            return _op(_lhs.template at<UnitStride>(i), _rhs.template at<UnitStride>(i));
+        }
+
+        bool unit_stride() const
+        {
+            return _lhs.unit_stride() && _rhs.unit_stride();
+        }
+
+    private:
+        OpT _op;
+        LhsEvaluatorT _lhs;
+        RhsEvaluatorT _rhs;
+};
+
+// ------------------------------------------------------------------
+// --------------- assignment ---------------------------------------
+// ------------------------------------------------------------------
+template<bool UnitStride, typename DstEvaluatorT, typename EvaluatorT>
+void assign_row(DstEvaluatorT const& dst, EvaluatorT const& expression, std::size_t begin, std::size_t end)
+{
+    typedef typename std::decay<typename DstEvaluatorT::reference>::type ValueT;
+    for(std::size_t i = begin; i < end; ++i) {
+        dst.template at<true>(i) = static_cast<ValueT>(expression.template at<UnitStride>(i));
+    }
+}
+
+template<typename DstEvaluatorT, typename EvaluatorT>
+void evaluate_row(DstEvaluatorT const& dst, EvaluatorT const& expression, std::size_t begin, std::size_t end)
+{
+    if(expression.unit_stride()) {
+        assign_row<true>(dst, expression, begin, end);
+    }
+    else {
+        assign_row<false>(dst, expression, begin, end);
+    }
+}
+
+// evaluate all the elements with an outermost index in [outer_begin, outer_end)
+// n.b. evaluators are taken by value as they track the current row
+template<typename DstEvaluatorT, typename EvaluatorT, std::size_t Rank>
+void assign_rows(DstEvaluatorT dst, EvaluatorT expression, std::array<std::size_t, Rank> const& sizes
+                , std::size_t outer_begin, std::size_t outer_end)
+{
+    std::array<std::size_t, Rank> index;
+    index.fill(0);
+
+    if(Rank == 1) {
+        dst.row(index);
+        expression.row(index);
+        evaluate_row(dst, expression, outer_begin, outer_end);
+        return;
+    }
+
+    index[0] = outer_begin;
+    while(index[0] < outer_end) {
+        dst.row(index);
+        expression.row(index);
+        evaluate_row(dst, expression, 0, sizes[Rank - 1]);
+
+        // move to the next row
+        std::size_t dim = Rank - 1;
+        while(dim > 0) {
+            --dim;
+            if(++index[dim] < sizes[dim] || dim == 0) break;
+            index[dim] = 0;
+        }
+    }
+}
+
+template<typename DstT, typename DimensionTuple>
+struct ExpressionAssigner;
+
+template<typename DstT, typename... Dimensions>
+struct ExpressionAssigner<DstT, std::tuple<Dimensions...>>
+{
+    static constexpr std::size_t rank = sizeof...(Dimensions);
+    typedef std::tuple<Dimensions...> DimensionTuple;
+    typedef std::array<std::size_t, rank> SizesType;
+    typedef typename std::remove_reference<decltype(*std::declval<DstT&>().begin())>::type ValueT;
+    typedef ArrayEvaluator<ValueT*, rank> DstEvaluatorT;
+
+    template<typename ExpressionT, typename ExecutorT>
+    static void exec(DstT& dst, ExpressionT const& expression, ExecutorT* executor)
+    {
+        static_assert(has_all_dimensions<DimensionTuple, typename ExpressionT::DimensionTuple>::value
+                     , "expression has dimensions that are not in the destination");
+
+        SizesType const sizes{{ static_cast<std::size_t>(dst.template dimension<Dimensions>())... }};
+        auto const evaluator = expression.evaluator(static_cast<DimensionTuple const*>(nullptr), sizes);
+        for(auto size : sizes) {
+            if(size == 0) return;
+        }
+        DstEvaluatorT const dst_evaluator(&*dst.begin(), operand_strides<DstT, Dimensions...>(dst, sizes));
+
+        if(executor == nullptr) {
+            assign_rows(dst_evaluator, evaluator, sizes, 0, sizes[0]);
+            return;
+        }
+
+        typedef typename std::tuple_element<0, DimensionTuple>::type Outer;
+        auto const spans = partition(DimensionSize<Outer>(sizes[0]), elementwise_partitions(*executor));
+        executor->parallel_for(spans.size(), [&](std::size_t task)
+                              {
+                                  std::size_t const start = static_cast<std::size_t>(spans[task].start());
+                                  assign_rows(dst_evaluator, evaluator, sizes, start, start + static_cast<std::size_t>(spans[task].span()));
+                              });
+    }
+};
+
+} // namespace detail
+
+// ------------------------------------------------------------------
+// --------------- ArrayOperand -------------------------------------
+// ------------------------------------------------------------------
+template<typename ArrayT>
+ArrayOperand<ArrayT>::ArrayOperand(ArrayT const& array)
+    : _array(array)
+{
+}
+
+template<typename ArrayT>
+template<typename... DstDimensions>
+typename ArrayOperand<ArrayT>::template Evaluator<sizeof...(DstDimensions)> ArrayOperand<ArrayT>::evaluator(std::tuple<DstDimensions...> const*
+                                              , std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const
+{
+    auto const strides = detail::operand_strides<ArrayT, DstDimensions...>(_array, sizes);
+    for(auto size : sizes) {
+        // nothing will be read, so do not touch the data
+        if(size == 0) return Evaluator<sizeof...(DstDimensions)>(nullptr, strides);
+    }
+    return Evaluator<sizeof...(DstDimensions)>(&*_array.begin(), strides);
+}
+
+// ------------------------------------------------------------------
+// --------------- ScalarOperand ------------------------------------
+// ------------------------------------------------------------------
+template<typename T>
+ScalarOperand<T>::ScalarOperand(T const& value)
+    : _value(value)
+{
+}
+
+template<typename T>
+template<typename... DstDimensions>
+ScalarOperand<T> ScalarOperand<T>::evaluator(std::tuple<DstDimensions...> const*
+                                            , std::array<std::size_t, sizeof...(DstDimensions)> const&) const
+{
+    return *this;
+}
+
+// ------------------------------------------------------------------
+// --------------- UnaryExpression ----------------------------------
+// ------------------------------------------------------------------
+template<typename OpT, typename ExpressionT>
+UnaryExpression<OpT, ExpressionT>::UnaryExpression(ExpressionT const& expression)
+    : _expression(expression)
+{
+}
+
+template<typename OpT, typename ExpressionT>
+template<typename... DstDimensions>
+typename UnaryExpression<OpT, ExpressionT>::template Evaluator<sizeof...(DstDimensions)> UnaryExpression<OpT, ExpressionT>::evaluator(
+                                                std::tuple<DstDimensions...> const* tag
+                                              , std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const
+{
+    return Evaluator<sizeof...(DstDimensions)>(_expression.evaluator(tag, sizes));
+}
+
+// ------------------------------------------------------------------
+// --------------- BinaryExpression ---------------------------------
+// ------------------------------------------------------------------
+template<typename OpT, typename LhsT, typename RhsT>
+BinaryExpression<OpT, LhsT, RhsT>::BinaryExpression(LhsT const& lhs, RhsT const& rhs)
+    : _lhs(lhs)
+    , _rhs(rhs)
+{
+}
+
+template<typename OpT, typename LhsT, typename RhsT>
+template<typename... DstDimensions>
+typename BinaryExpression<OpT, LhsT, RhsT>::template Evaluator<sizeof...(DstDimensions)> BinaryExpression<OpT, LhsT, RhsT>::evaluator(
+                                                std::tuple<DstDimensions...> const* tag
+                                              , std::array<std::size_t, sizeof...(DstDimensions)> const& sizes) const
+{
+    return Evaluator<sizeof...(DstDimensions)>(_lhs.evaluator(tag, sizes), _rhs.evaluator(tag, sizes));
+}
+
+// ------------------------------------------------------------------
+// --------------- operators ----------------------------------------
+// ------------------------------------------------------------------
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, AddExpression<LhsT, RhsT>>::type
+operator+(LhsT const& lhs, RhsT const& rhs)
+{
+    return AddExpression<LhsT, RhsT>(detail::Operand<LhsT>::make(lhs), detail::Operand<RhsT>::make(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, SubtractExpression<LhsT, RhsT>>::type
+operator-(LhsT const& lhs, RhsT const& rhs)
+{
+    return SubtractExpression<LhsT, RhsT>(detail::Operand<LhsT>::make(lhs), detail::Operand<RhsT>::make(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, MultiplyExpression<LhsT, RhsT>>::type
+operator*(LhsT const& lhs, RhsT const& rhs)
+{
+    return MultiplyExpression<LhsT, RhsT>(detail::Operand<LhsT>::make(lhs), detail::Operand<RhsT>::make(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+typename std::enable_if<detail::is_expression_arguments<LhsT, RhsT>::value, DivideExpression<LhsT, RhsT>>::type
+operator/(LhsT const& lhs, RhsT const& rhs)
+{
+    return DivideExpression<LhsT, RhsT>(detail::Operand<LhsT>::make(lhs), detail::Operand<RhsT>::make(rhs));
+}
+
+template<typename T>
+typename std::enable_if<is_expression<T>::value || is_expression_array<T>::value, NegateExpression<T>>::type
+operator-(T const& operand)
+{
+    return NegateExpression<T>(detail::Operand<T>::make(operand));
+}
+
+// ------------------------------------------------------------------
+// --------------- assign -------------------------------------------
+// ------------------------------------------------------------------
+template<typename DstT, typename ExpressionT>
+void assign(DstT&& dst, ExpressionT const& expression)
+{
+    typedef typename std::remove_reference<DstT>::type DataT;
+    detail::ExpressionAssigner<DataT, typename DataT::DimensionTuple>::exec(dst, detail::Operand<ExpressionT>::make(expression)
+                                                                          , static_cast<SerialExecutor*>(nullptr));
+}
+
+template<typename ExecutorT, typename DstT, typename ExpressionT>
+void parallel_assign(ExecutorT& executor, DstT&& dst, ExpressionT const& expression)
+{
+    typedef typename std::remove_reference<DstT>::type DataT;
+    detail::ExpressionAssigner<DataT, typename DataT::DimensionTuple>::exec(dst, detail::Operand<ExpressionT>::make(expression), &executor);
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdlib>
+#include <new>
+#if defined(__unix__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace pss {
+namespace astrotypes {
+namespace detail {
+
+// heap allocation for blocks too small to benefit from huge pages
+inline void* heap_allocate(std::size_t bytes)
+{
+    void* pointer = nullptr;
+    if(::posix_memalign(&pointer, 64, bytes) != 0) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+#if defined(MAP_ANONYMOUS)
+
+// map an anonymous block of length bytes aligned to a multiple of alignment bytes
+inline void* map_aligned(std::size_t length, std::size_t alignment, int extra_flags)
+{
+    // over allocate so that we can trim to an aligned start
+    std::size_t const mapped_length = length + alignment;
+    void* base = ::mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+    if(base == MAP_FAILED) return nullptr;
+
+    char* const start = static_cast<char*>(base);
+    char* const aligned = start + ((alignment - reinterpret_cast<std::size_t>(start) % alignment) % alignment);
+    if(aligned != start) ::munmap(start, aligned - start);
+    char* const end = aligned + length;
+    if(end != start + mapped_length) ::munmap(end, start + mapped_length - end);
+    return aligned;
+}
+
+// bind the (untouched) pages to a NUMA node. Best effort only.
+inline void bind_to_numa_node(void* pointer, std::size_t length, int node)
+{
+#if defined(SYS_mbind)
+    if(node < 0 || node >= static_cast<int>(8 * sizeof(unsigned long))) return;
+    static const int mpol_bind = 2; // MPOL_BIND from numaif.h (avoids a libnuma dependency)
+    unsigned long const node_mask = 1UL << node;
+    ::syscall(SYS_mbind, pointer, length, mpol_bind, &node_mask, 8 * sizeof(unsigned long), 0);
+#else
+    (void)pointer; (void)length; (void)node;
+#endif
+}
+
+inline void* huge_page_allocate(std::size_t bytes, std::size_t huge_page_size, HugePagePolicy policy, int numa_node)
+{
+    std::size_t const length = ((bytes + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    void* pointer = nullptr;
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if(policy == HugePagePolicy::HugeTlb) {
+        // ask for pages of huge_page_size explicitly. Otherwise the system default is used (e.g. 1GB)
+        // and the kernel rounds the mapping up to that, so munmap of length would not release it.
+        // hugetlb mappings are always aligned to the huge page size
+        int page_shift = 0;
+        while((std::size_t(1) << page_shift) < huge_page_size) ++page_shift;
+        pointer = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT), -1, 0);
+        if(pointer == MAP_FAILED) pointer = nullptr;
+    }
+#else
+    (void)policy;
+#endif
+    if(!pointer) {
+        pointer = map_aligned(length, huge_page_size, 0);
+        if(!pointer) throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+        ::madvise(pointer, length, MADV_HUGEPAGE);
+#endif
+    }
+    bind_to_numa_node(pointer, length, numa_node);
+    return pointer;
+}
+
+inline void huge_page_deallocate(void* pointer, std::size_t bytes, std::size_t huge_page_size)
+{
+    std::size_t const length = ((bytes + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    ::munmap(pointer, length);
+}
+
+#else // MAP_ANONYMOUS
+
+inline void* huge_page_allocate(std::size_t bytes, std::size_t, HugePagePolicy, int)
+{
+    return heap_allocate(bytes);
+}
+
+inline void huge_page_deallocate(void* pointer, std::size_t, std::size_t)
+{
+    ::free(pointer);
+}
+
+#endif // MAP_ANONYMOUS
+
+} // namespace detail
+
+template<typename LocalType>
+constexpr std::size_t HugePageAllocator<LocalType>::huge_page_size;
+
+template<typename LocalType>
+constexpr int HugePageAllocator<LocalType>::any_numa_node;
+
+template<typename LocalType>
+HugePageAllocator<LocalType>::HugePageAllocator(HugePagePolicy policy, int numa_node) noexcept
+    : _policy(policy)
+    , _numa_node(numa_node)
+{
+}
+
+template<typename LocalType>
+template<typename OtherType>
+HugePageAllocator<LocalType>::HugePageAllocator(HugePageAllocator<OtherType> const& other) noexcept
+    : _policy(other.policy())
+    , _numa_node(other.numa_node())
+{
+}
+
+template<typename LocalType>
+typename HugePageAllocator<LocalType>::value_type* HugePageAllocator<LocalType>::allocate(std::size_t size)
+{
+    std::size_t const bytes = size * sizeof(value_type);
+    if(bytes < huge_page_size) {
+        return static_cast<value_type*>(detail::heap_allocate(bytes));
+    }
+    return static_cast<value_type*>(detail::huge_page_allocate(bytes, huge_page_size, _policy, _numa_node));
+}
+
+template<typename LocalType>
+void HugePageAllocator<LocalType>::deallocate(value_type* pointer, std::size_t size) noexcept
+{
+    std::size_t const bytes = size * sizeof(value_type);
+    if(bytes < huge_page_size) {
+        ::free(pointer);
+        return;
+    }
+    detail::huge_page_deallocate(pointer, bytes, huge_page_size);
+}
+
+template<typename LocalType>
+HugePagePolicy HugePageAllocator<LocalType>::policy() const
+{
+    return _policy;
+}
+
+template<typename LocalType>
+int HugePageAllocator<LocalType>::numa_node() const
+{
+    return _numa_node;
+}
+
+template<typename FirstType, typename SecondType>
+bool operator==(HugePageAllocator<FirstType> const& a, HugePageAllocator<SecondType> const& b) noexcept
+{
+    return a.policy() == b.policy() && a.numa_node() == b.numa_node();
+}
+
+template<typename FirstType, typename SecondType>
+bool operator!=(HugePageAllocator<FirstType> const& a, HugePageAllocator<SecondType> const& b) noexcept
+{
+    return !(a == b);
+}
+
+} // namespace astrotypes
+} // namespace pss
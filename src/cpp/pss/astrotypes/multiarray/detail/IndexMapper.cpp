@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -21,20 +21,130 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "astrotypes/multiarray/IndexMapper.h"
-
+#include <utility>
 
 namespace pss {
 namespace astrotypes {
 namespace multiarray {
 
+template<typename Dimension>
+IndexMapper<Dimension>::IndexMapper(DimensionSize<Dimension> size)
+    : _size(size)
+    , _start(0)
+    , _step(1)
+{
+    add_runs();
+}
+
+template<typename Dimension>
+IndexMapper<Dimension>::IndexMapper(DimensionIndex<Dimension> start, long step, DimensionSize<Dimension> size)
+    : _size(size)
+    , _start(start)
+    , _step(step)
+{
+    add_runs();
+}
+
+template<typename Dimension>
+IndexMapper<Dimension>::IndexMapper(std::vector<std::size_t> table)
+    : _size(table.size())
+    , _start(0)
+    , _step(1)
+    , _table(std::move(table))
+{
+    add_runs();
+}
+
+template<typename Dimension>
+IndexMapper<Dimension>::~IndexMapper()
+{
+}
+
+template<typename Dimension>
+IndexMapper<Dimension> IndexMapper<Dimension>::reverse(DimensionSize<Dimension> size)
+{
+    return IndexMapper(DimensionIndex<Dimension>(size == DimensionSize<Dimension>(0) ? 0 : static_cast<std::size_t>(size) - 1), -1, size);
+}
+
+template<typename Dimension>
+template<typename FlagsT>
+IndexMapper<Dimension> IndexMapper<Dimension>::exclude_flagged(FlagsT const& flags)
+{
+    std::vector<std::size_t> table;
+    std::size_t index = 0;
+    for(auto const& flag : flags) {
+        if(!static_cast<bool>(flag)) table.push_back(index);
+        ++index;
+    }
+    return IndexMapper(std::move(table));
+}
+
+template<typename Dimension>
+inline std::size_t IndexMapper<Dimension>::operator()(std::size_t index) const
+{
+    if(_table.empty()) return static_cast<std::size_t>(static_cast<long>(_start) + static_cast<long>(index) * _step);
+    return _table[index];
+}
+
+template<typename Dimension>
+inline DimensionIndex<Dimension> IndexMapper<Dimension>::operator()(DimensionIndex<Dimension> index) const
+{
+    return DimensionIndex<Dimension>((*this)(static_cast<std::size_t>(index)));
+}
+
+template<typename Dimension>
+DimensionSize<Dimension> IndexMapper<Dimension>::size() const
+{
+    return DimensionSize<Dimension>(_size);
+}
+
+template<typename Dimension>
+bool IndexMapper<Dimension>::fits(DimensionSize<Dimension> source_size) const
+{
+    std::size_t const limit = source_size;
+    for(Run const& run : _runs) {
+        if(run.reversed) {
+            if(run.source_start >= limit || run.source_start + 1 < run.length) return false;
+        }
+        else if(run.source_start + run.length > limit) {
+            return false;
+        }
+    }
+    return true;
+}
 
-IndexMapper::IndexMapper()
+template<typename Dimension>
+std::vector<typename IndexMapper<Dimension>::Run> const& IndexMapper<Dimension>::runs() const
 {
+    return _runs;
 }
 
-IndexMapper::~IndexMapper()
+template<typename Dimension>
+void IndexMapper<Dimension>::add_runs()
 {
+    _runs.clear();
+    if(_table.empty() && (_step == 1 || _step == -1)) {
+        if(_size != 0) _runs.push_back(Run{0, _start, _size, _step == -1});
+        return;
+    }
+    for(std::size_t i = 0; i < _size; ++i) {
+        std::size_t const source = (*this)(i);
+        if(!_runs.empty()) {
+            Run& run = _runs.back();
+            std::size_t const last = run.reversed ? run.source_start - (run.length - 1) : run.source_start + (run.length - 1);
+            if(source == last + 1 && (!run.reversed || run.length == 1)) {
+                run.reversed = false;
+                ++run.length;
+                continue;
+            }
+            if(source + 1 == last && (run.reversed || run.length == 1)) {
+                run.reversed = true;
+                ++run.length;
+                continue;
+            }
+        }
+        _runs.push_back(Run{i, source, 1, false});
+    }
 }
 
 } // namespace multiarray
@@ -21,7 +21,10 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <algorithm>
 #include <functional>
+#include <initializer_list>
+#include <stdexcept>
 
 namespace pss {
 namespace astrotypes {
@@ -49,6 +52,35 @@ struct enabler2<has_exact_dimensions, T, DimensionTuple, typename std::enable_if
 // type deduction helpers
 // /////////////////////////////////////////////
 namespace multiarray {
+namespace detail {
+
+// the size requested for Dimension if it is in the list of sizes, otherwise its current size
+template<typename Dimension, typename... Dims>
+typename std::enable_if<arg_helper<Dimension, Dims...>::value, std::size_t>::type
+requested_size(DimensionSize<Dimension> const&, DimensionSize<Dims>... sizes)
+{
+    return static_cast<std::size_t>(arg_helper<DimensionSize<Dimension>, DimensionSize<Dims>...>::arg(std::move(sizes)...));
+}
+
+template<typename Dimension, typename... Dims>
+typename std::enable_if<!arg_helper<Dimension, Dims...>::value, std::size_t>::type
+requested_size(DimensionSize<Dimension> const& current_size, DimensionSize<Dims>...)
+{
+    return static_cast<std::size_t>(current_size);
+}
+
+// true if the elements of data lie within [begin, end) i.e. data is a view of that range
+template<typename DataT, typename IteratorT>
+bool is_view_of(DataT const& data, IteratorT const& begin, IteratorT const& end)
+{
+    if(data.cbegin() == data.cend() || begin == end) return false;
+    std::less<void const*> less;
+    void const* const first = &*data.cbegin();
+    return !less(first, &*begin) && less(first, &*(end - 1) + 1);
+}
+
+} // namespace detail
+
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
 struct MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::OperatorSliceType
@@ -84,37 +116,73 @@ struct MultiArray<Alloc, T, SliceMixin, Dimension>::ConstOperatorSliceType
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray()
     : BaseT()
-    , _size(DimensionSize<FirstDimension>(0))
+    , _size()
+    , _stride(BaseT::block_size())
 {
+    // static sized lower dimensions start with a non zero size, so size the data to match
+    do_resize(1);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim, typename... Dims>
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
     : BaseT(false, size, sizes...)
-    , _size(arg_helper<DimensionSize<FirstDimension> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _stride(BaseT::block_size())
+{
+    resize(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(Alloc const& allocator, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
+    : BaseT(false, allocator, size, sizes...)
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _stride(BaseT::block_size())
+{
+    resize(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(NoInitialisation const& tag, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
+    : BaseT(false, size, sizes...)
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _stride(BaseT::block_size())
 {
-    resize(arg_helper<DimensionSize<FirstDimension> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...));
+    do_resize(tag, 1);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(NoInitialisation const& tag, Alloc const& allocator, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
+    : BaseT(false, allocator, size, sizes...)
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _stride(BaseT::block_size())
+{
+    do_resize(tag, 1);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename DimensionType, typename Enable>
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(DimensionType const& d)
     : BaseT(false, d)
-    , _size(d.template dimension<FirstDimension>())
+    , _size(d.template dimension<DimensionTag<FirstDimension>>())
+    , _stride(BaseT::block_size())
 {
-    resize(d.template dimension<FirstDimension>());
-    do_transpose(*this, d);
+    resize(d.template dimension<DimensionTag<FirstDimension>>());
+    transpose_copy(d, std::integral_constant<bool, is_multiarray<DimensionType>::value && DimensionType::rank == rank>());
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename DimensionType>
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(
-      typename std::enable_if<has_dimensions<DimensionType, FirstDimension, Dimensions...>::value, bool>::type
+      typename std::enable_if<has_dimensions<DimensionType, DimensionTag<FirstDimension>, DimensionTag<Dimensions>...>::value, bool>::type
     , DimensionType const& d
     )
     : BaseT(false, d)
-    , _size(d.template dimension<FirstDimension>())
+    , _size(d.template dimension<DimensionTag<FirstDimension>>())
+    , _stride(BaseT::block_size())
 {
 }
 
@@ -122,21 +190,48 @@ template<typename Alloc, typename T, template<typename> class SliceMixin, typena
 template<typename MultiArrayType, typename DimensionType>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_transpose(MultiArrayType& ma, DimensionType const& d)
 {
-    for(DimensionIndex<FirstDimension> i(0); i < _size; ++i) {
+    for(DimensionIndex<DimensionTag<FirstDimension>> i(0); i < _size.get(); ++i) {
         auto slice = ma[i];
         BaseT::do_transpose(slice, d[i]);
     }
 }
 
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename DimensionType>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::transpose_copy(DimensionType const& d, std::true_type const&)
+{
+    multiarray::transpose(*this, d);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename DimensionType>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::transpose_copy(DimensionType const& d, std::false_type const&)
+{
+    do_transpose(*this, d);
+}
+
 
 // private interface for constructing in an inheritance stack
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename... Dims>
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(
-                                  typename std::enable_if<arg_helper<FirstDimension, Dims...>::value, bool>::type
+                                  typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type
                                 , DimensionSize<Dims> const&... sizes)
     : BaseT(false, sizes...)
-    , _size(arg_helper<DimensionSize<FirstDimension> const&, DimensionSize<Dims> const&...>::arg(sizes...))
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dims> const&...>::arg(sizes...))
+    , _stride(BaseT::block_size())
+{
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::MultiArray(
+                                  typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type
+                                , Alloc const& allocator
+                                , DimensionSize<Dims> const&... sizes)
+    : BaseT(false, allocator, sizes...)
+    , _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dims> const&...>::arg(sizes...))
+    , _stride(BaseT::block_size())
 {
 }
 
@@ -177,23 +272,23 @@ typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::const_
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ReducedDimensionSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<FirstDimension> index)
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ReducedDimensionSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<DimensionTag<FirstDimension>> index)
 {
-    return SliceType(*this, DimensionSpan<FirstDimension>(index, DimensionSize<FirstDimension>(1))
-                          , DimensionSpan<Dimensions>(DimensionIndex<Dimensions>(0), DimensionSize<Dimensions>(this->template dimension<Dimensions>()))...)[DimensionIndex<FirstDimension>(0)];
+    return SliceType(*this, DimensionSpan<DimensionTag<FirstDimension>>(index, DimensionSize<DimensionTag<FirstDimension>>(1))
+                          , DimensionSpan<DimensionTag<Dimensions>>(DimensionIndex<DimensionTag<Dimensions>>(0), DimensionSize<DimensionTag<Dimensions>>(this->template dimension<DimensionTag<Dimensions>>()))...)[DimensionIndex<DimensionTag<FirstDimension>>(0)];
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ConstReducedDimensionSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<FirstDimension> index) const
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ConstReducedDimensionSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<DimensionTag<FirstDimension>> index) const
 {
-    return ConstSliceType(*this, DimensionSpan<FirstDimension>(index, DimensionSize<FirstDimension>(1))
-                          , DimensionSpan<Dimensions>(DimensionIndex<Dimensions>(0), DimensionSize<Dimensions>(this->template dimension<Dimensions>()))...)[DimensionIndex<FirstDimension>(0)];
+    return ConstSliceType(*this, DimensionSpan<DimensionTag<FirstDimension>>(index, DimensionSize<DimensionTag<FirstDimension>>(1))
+                          , DimensionSpan<DimensionTag<Dimensions>>(DimensionIndex<DimensionTag<Dimensions>>(0), DimensionSize<DimensionTag<Dimensions>>(this->template dimension<DimensionTag<Dimensions>>()))...)[DimensionIndex<DimensionTag<FirstDimension>>(0)];
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
 typename std::enable_if<has_dimension<MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>, Dim>::value
-&& !std::is_same<Dim, FirstDimension>::value, typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::template ConstOperatorSliceType<Dim>::type>::type
+&& !std::is_same<Dim, DimensionTag<FirstDimension>>::value, typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::template ConstOperatorSliceType<Dim>::type>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<Dim> const& index) const
 {
    return ConstSliceType(*this, DimensionSpan<Dim>(index, DimensionSize<Dim>(1)));
@@ -220,7 +315,7 @@ struct MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ConstSli
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
 typename std::enable_if<has_dimension<MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>, Dim>::value
-&& !std::is_same<Dim, FirstDimension>::value, typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::template OperatorSliceType<Dim>::type>::type
+&& !std::is_same<Dim, DimensionTag<FirstDimension>>::value, typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::template OperatorSliceType<Dim>::type>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator[](DimensionIndex<Dim> const& index)
 {
    return SliceType(*this, DimensionSpan<Dim>(index, DimensionSize<Dim>(1)));
@@ -242,21 +337,21 @@ typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::SliceT
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::SliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, Dimensions...>> const& slice)
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::SliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<Dimensions>...>> const& slice)
 {
     return SliceType(*this, slice);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::SliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, Dimensions...> const& slice)
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::SliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<Dimensions>...> const& slice)
 {
     return SliceType(*this, slice);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<bool is_const, typename SliceTraitsT, template<typename> class SliceMixin2>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ConstSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, FirstDimension, Dimensions...>> const& slice) const
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::ConstSliceType MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::overlay(SliceMixin2<Slice<is_const, SliceTraitsT, SliceMixin2, DimensionTag<FirstDimension>, DimensionTag<Dimensions>...>> const& slice) const
 {
     return ConstSliceType(*this, slice);
 }
@@ -312,7 +407,7 @@ template<typename Alloc, typename T, template<typename> class SliceMixin, typena
 template<typename Job>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::for_each_dimension(Job& job) const
 {
-    job.template exec<FirstDimension>(*this);
+    job.template exec<DimensionTag<FirstDimension>>(*this);
     BaseT::for_each_dimension(job);
 }
 
@@ -325,7 +420,7 @@ inline DimensionIndex<Dimension> MultiArray<Alloc, T, SliceMixin, FirstDimension
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dimension>
-typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, DimensionIndex<Dimension>>::type
+typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, DimensionIndex<Dimension>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::calculate_offset(std::size_t delta) const
 {
     return DimensionIndex<Dimension>(delta / (std::size_t)this->BaseT::block_size());
@@ -333,7 +428,7 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::calculate_offse
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dimension>
-typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, DimensionIndex<Dimension>>::type
+typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, DimensionIndex<Dimension>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::calculate_offset(std::size_t delta) const
 {
     return BaseT::template calculate_offset<Dimension>(delta % (std::size_t)this->BaseT::block_size());
@@ -342,7 +437,61 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::calculate_offse
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::block_size() const
 {
-    return this->template dimension<FirstDimension>() * BaseT::block_size();
+    return static_cast<std::size_t>(_size.get()) * _stride;
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+inline std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::index_offset(DimensionIndex<Dims> const&... indexes) const
+{
+    return static_cast<std::size_t>(arg_helper<DimensionIndex<DimensionTag<FirstDimension>> const&, DimensionIndex<Dims> const&...>::arg(indexes...)) * _stride
+           + BaseT::index_offset(indexes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::check_index(DimensionIndex<Dims> const&... indexes) const
+{
+    if(!(arg_helper<DimensionIndex<DimensionTag<FirstDimension>> const&, DimensionIndex<Dims> const&...>::arg(indexes...) < _size.get())) {
+        throw std::out_of_range("MultiArray: index out of range");
+    }
+    BaseT::check_index(indexes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+inline typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator()(DimensionIndex<Dims>... indexes)
+{
+    static_assert(sizeof...(Dims) == rank, "an index must be provided for every dimension");
+    return *(begin() + index_offset(indexes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+inline typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::const_reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator()(DimensionIndex<Dims>... indexes) const
+{
+    static_assert(sizeof...(Dims) == rank, "an index must be provided for every dimension");
+    return *(cbegin() + index_offset(indexes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::at(DimensionIndex<Dims>... indexes)
+{
+    check_index(indexes...);
+    return (*this)(indexes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::const_reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::at(DimensionIndex<Dims>... indexes) const
+{
+    check_index(indexes...);
+    return (*this)(indexes...);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
@@ -361,7 +510,7 @@ void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::resize(Dim
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
-typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::size() const
 {
     return BaseT::template dimension<Dim>();
@@ -369,15 +518,15 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::size() const
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
-typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::size() const
 {
-    return _size;
+    return _size.get();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
-typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::dimension() const
 {
     return BaseT::template dimension<Dim>();
@@ -385,56 +534,156 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::dimension() con
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim>
-typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::dimension() const
 {
-    return _size;
+    return _size.get();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim, typename... Dims>
-typename std::enable_if<!arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
 {
-    BaseT::do_resize(total * static_cast<std::size_t>(_size), size, std::forward<DimensionSize<Dims>>(sizes)...);
+    BaseT::do_resize(total * static_cast<std::size_t>(_size.get()), size, std::forward<DimensionSize<Dims>>(sizes)...);
+    _stride = BaseT::block_size();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim, typename... Dims>
-typename std::enable_if<!arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes, T const& value)
 {
-    BaseT::do_resize(total * static_cast<std::size_t>(_size), size, std::forward<DimensionSize<Dims>>(sizes)..., value);
+    BaseT::do_resize(total * static_cast<std::size_t>(_size.get()), size, std::forward<DimensionSize<Dims>>(sizes)..., value);
+    _stride = BaseT::block_size();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim, typename... Dims>
-typename std::enable_if<arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
 {
-    _size = arg_helper<DimensionSize<FirstDimension>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...);
-    BaseT::do_resize(total * static_cast<std::size_t>(_size), size, std::forward<DimensionSize<Dims>>(sizes)...);
+    _size.set(arg_helper<DimensionSize<DimensionTag<FirstDimension>>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...));
+    BaseT::do_resize(total * static_cast<std::size_t>(_size.get()), size, std::forward<DimensionSize<Dims>>(sizes)...);
+    _stride = BaseT::block_size();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dim, typename... Dims>
-typename std::enable_if<arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes, T const& value)
 {
-    _size = arg_helper<DimensionSize<FirstDimension>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...);
-    BaseT::template do_resize<Dim, Dims...>(total * static_cast<std::size_t>(_size), size, std::forward<DimensionSize<Dims>>(sizes)..., value);
+    _size.set(arg_helper<DimensionSize<DimensionTag<FirstDimension>>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...));
+    BaseT::template do_resize<Dim, Dims...>(total * static_cast<std::size_t>(_size.get()), size, std::forward<DimensionSize<Dims>>(sizes)..., value);
+    _stride = BaseT::block_size();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total)
 {
-    BaseT::do_resize(total * static_cast<std::size_t>(_size));
+    BaseT::do_resize(total * static_cast<std::size_t>(_size.get()));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(std::size_t total, T const& value)
 {
-    BaseT::do_resize(total * static_cast<std::size_t>(_size), value);
+    BaseT::do_resize(total * static_cast<std::size_t>(_size.get()), value);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::resize(NoInitialisation const& tag, DimensionSize<Dims>... sizes)
+{
+    this->do_resize(tag, 1, sizes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_resize(NoInitialisation const& tag, std::size_t total, DimensionSize<Dims>... sizes)
+{
+    _size.set(DimensionSize<DimensionTag<FirstDimension>>(detail::requested_size(_size.get(), sizes...)));
+    BaseT::do_resize(tag, total * static_cast<std::size_t>(_size.get()), sizes...);
+    _stride = BaseT::block_size();
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::reserve(DimensionSize<Dims>... sizes)
+{
+    this->do_reserve(1, sizes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_reserve(std::size_t total, DimensionSize<Dims>... sizes)
+{
+    BaseT::do_reserve(total * detail::requested_size(_size.get(), sizes...), sizes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::data_capacity() const
+{
+    return BaseT::data_capacity();
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename Dim>
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
+MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::capacity() const
+{
+    std::size_t const block = BaseT::block_size();
+    if(block == 0) return _size.get();
+    return DimensionSize<DimensionTag<FirstDimension>>(data_capacity() / block);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename DataT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::append(DataT const& data)
+{
+    do_append(data, std::integral_constant<bool, std::is_same<typename DataT::DimensionTuple, DimensionTuple>::value
+                                              || std::is_same<typename DataT::DimensionTuple, std::tuple<DimensionTag<Dimensions>...>>::value>());
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename DataT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_append(DataT const& data, std::false_type const&)
+{
+    static_assert(std::tuple_size<typename DataT::DimensionTuple>::value == rank
+                 , "append: data with the outermost dimension reduced must have the same dimension ordering");
+    do_append(MultiArray(data), std::true_type());
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename DataT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::do_append(DataT const& data, std::true_type const&)
+{
+    if(static_cast<std::size_t>(_size.get()) == 0) {
+        resize(DimensionSize<DimensionTag<FirstDimension>>(0), data.template dimension<DimensionTag<Dimensions>>()...);
+    }
+    else {
+        bool matched = true;
+        (void)std::initializer_list<bool>{ (matched = matched && (this->template dimension<DimensionTag<Dimensions>>() == data.template dimension<DimensionTag<Dimensions>>()))... };
+        if(!matched) {
+            throw std::invalid_argument("MultiArray::append: data dimensions do not match");
+        }
+    }
+
+    std::size_t const block = BaseT::block_size();
+    std::size_t const old_size = _size.get();
+    std::size_t const new_size = old_size + static_cast<std::size_t>(data.template dimension<DimensionTag<FirstDimension>>());
+    if(new_size * block > data_capacity()) {
+        if(detail::is_view_of(data, cbegin(), cend())) {
+            // data would be invalidated by the reallocation
+            std::vector<T> const copy(data.cbegin(), data.cend());
+            do_reserve(1, DimensionSize<DimensionTag<FirstDimension>>(std::max(new_size, 2 * old_size)));
+            resize(NoInitialisation(), DimensionSize<DimensionTag<FirstDimension>>(new_size));
+            std::copy(copy.begin(), copy.end(), begin() + old_size * block);
+            return;
+        }
+        do_reserve(1, DimensionSize<DimensionTag<FirstDimension>>(std::max(new_size, 2 * old_size)));
+    }
+    resize(NoInitialisation(), DimensionSize<DimensionTag<FirstDimension>>(new_size));
+    std::copy(data.cbegin(), data.cend(), begin() + old_size * block);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
@@ -443,10 +692,24 @@ std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::dat
     return BaseT::data_size();
 }
 
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename FunctionT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::for_each_contiguous_run(FunctionT&& fn)
+{
+    BaseT::for_each_contiguous_run(std::forward<FunctionT>(fn));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
+template<typename FunctionT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::for_each_contiguous_run(FunctionT&& fn) const
+{
+    BaseT::for_each_contiguous_run(std::forward<FunctionT>(fn));
+}
+
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 bool MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::equal_size(MultiArray const& o) const
 {
-    return _size == o.dimension<FirstDimension>() && BaseT::equal_size(static_cast<BaseT const&>(o));
+    return _size.get() == o.dimension<DimensionTag<FirstDimension>>() && BaseT::equal_size(static_cast<BaseT const&>(o));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
@@ -457,7 +720,7 @@ bool MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::operator==
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dimension>
-typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::block_size_t() const
 {
     return this->BaseT::block_size();
@@ -465,7 +728,7 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::block_size_t()
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension, typename... Dimensions>
 template<typename Dimension>
-typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::block_size_t() const
 {
     return BaseT::template block_size_t<Dimension>();
@@ -476,35 +739,72 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension, Dimensions...>::block_size_t()
 /////////////////////////////////////////////////////////////
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray()
-    : _size(DimensionSize<FirstDimension>(0))
+    : _size()
 {
-    _data.resize(static_cast<std::size_t>(_size));
+    _data.resize_initialised(static_cast<std::size_t>(_size.get()));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim, typename... Dims>
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes)
-    : _size(arg_helper<DimensionSize<FirstDimension> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+{
+    _data.resize_initialised(static_cast<std::size_t>(_size.get()));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(Alloc const& allocator, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes)
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _data(allocator)
+{
+    _data.resize_initialised(static_cast<std::size_t>(_size.get()));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(NoInitialisation const&, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes)
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+{
+    _data.resize(static_cast<std::size_t>(_size.get()));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename Dim, typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(NoInitialisation const&, Alloc const& allocator, DimensionSize<Dim> const& size, DimensionSize<Dims> const&... sizes)
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dim> const&, DimensionSize<Dims> const&...>::arg(size, sizes...))
+    , _data(allocator)
+{
+    _data.resize(static_cast<std::size_t>(_size.get()));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type
+        , DimensionSize<Dims> const&... sizes)
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dims> const&...>::arg(sizes...))
 {
-    _data.resize(static_cast<std::size_t>(_size));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename... Dims>
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(
-        typename std::enable_if<arg_helper<FirstDimension, Dims...>::value, bool>::type
+        typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dims...>::value, bool>::type
+        , Alloc const& allocator
         , DimensionSize<Dims> const&... sizes)
-    : _size(arg_helper<DimensionSize<FirstDimension> const&, DimensionSize<Dims> const&...>::arg(sizes...))
+    : _size(arg_helper<DimensionSize<DimensionTag<FirstDimension>> const&, DimensionSize<Dims> const&...>::arg(sizes...))
+    , _data(allocator)
 {
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename DimensionType>
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::MultiArray(
-      typename std::enable_if<astrotypes::has_dimension<DimensionType, FirstDimension>::value, bool>::type
+      typename std::enable_if<astrotypes::has_dimension<DimensionType, DimensionTag<FirstDimension>>::value, bool>::type
     , DimensionType const& d
     )
-    : _size(d.template dimension<FirstDimension>())
+    : _size(d.template dimension<DimensionTag<FirstDimension>>())
 {
 }
 
@@ -515,7 +815,7 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension>::~MultiArray()
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim>
-typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::size() const
 {
     return DimensionSize<Dim>(0);
@@ -523,15 +823,15 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension>::size() const
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim>
-typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::size() const
 {
-    return _size;
+    return _size.get();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim>
-typename std::enable_if<!std::is_same<Dim, FirstDimension>::value, DimensionSize<Dim>>::type
+typename std::enable_if<!std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<Dim>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::dimension() const
 {
     return DimensionSize<Dim>(0);
@@ -539,10 +839,10 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension>::dimension() const
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim>
-typename std::enable_if<std::is_same<Dim, FirstDimension>::value, DimensionSize<FirstDimension>>::type
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::dimension() const
 {
-    return _size;
+    return _size.get();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
@@ -551,6 +851,20 @@ std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension>::data_size() const
     return this->_data.size();
 }
 
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename FunctionT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::for_each_contiguous_run(FunctionT&& fn)
+{
+    if(!_data.empty()) fn(_data.data(), _data.data() + _data.size());
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename FunctionT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::for_each_contiguous_run(FunctionT&& fn) const
+{
+    if(!_data.empty()) fn(_data.data(), _data.data() + _data.size());
+}
+
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension>::resize(DimensionSize<Dim> size)
@@ -567,48 +881,113 @@ void MultiArray<Alloc, T, SliceMixin, FirstDimension>::resize(DimensionSize<Dim>
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename... Dims>
-typename std::enable_if<!arg_helper<FirstDimension, Dims...>::value, void>::type
+typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_resize(std::size_t total, DimensionSize<Dims>...)
 {
-    _data.resize(total * static_cast<std::size_t>(_size));
+    _data.resize_initialised(total * static_cast<std::size_t>(_size.get()));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename... Dims>
-typename std::enable_if<!arg_helper<FirstDimension, Dims...>::value, void>::type
+typename std::enable_if<!arg_helper<DimensionTag<FirstDimension>, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_resize(std::size_t total, DimensionSize<Dims>..., T const& value)
 {
-    _data.resize(total * static_cast<std::size_t>(_size), value);
+    _data.resize(total * static_cast<std::size_t>(_size.get()), value);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim, typename... Dims>
-typename std::enable_if<arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes)
 {
-    _size = arg_helper<DimensionSize<FirstDimension>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...);
-    _data.resize(total * static_cast<std::size_t>(_size));
+    _size.set(arg_helper<DimensionSize<DimensionTag<FirstDimension>>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...));
+    _data.resize_initialised(total * static_cast<std::size_t>(_size.get()));
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dim, typename... Dims>
-typename std::enable_if<arg_helper<FirstDimension, Dim, Dims...>::value, void>::type
+typename std::enable_if<arg_helper<DimensionTag<FirstDimension>, Dim, Dims...>::value, void>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_resize(std::size_t total, DimensionSize<Dim> size, DimensionSize<Dims>... sizes, T const& value)
 {
-    _size = arg_helper<DimensionSize<FirstDimension>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...);
-    _data.resize(total * static_cast<std::size_t>(_size), value);
+    _size.set(arg_helper<DimensionSize<DimensionTag<FirstDimension>>, DimensionSize<Dim>, DimensionSize<Dims>...>::arg(std::forward<DimensionSize<Dim>>(size), std::forward<DimensionSize<Dims>>(sizes)...));
+    _data.resize(total * static_cast<std::size_t>(_size.get()), value);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::resize(NoInitialisation const& tag, DimensionSize<Dims>... sizes)
+{
+    this->do_resize(tag, 1, sizes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_resize(NoInitialisation const&, std::size_t total, DimensionSize<Dims>... sizes)
+{
+    _size.set(DimensionSize<DimensionTag<FirstDimension>>(detail::requested_size(_size.get(), sizes...)));
+    _data.resize(total * static_cast<std::size_t>(_size.get()));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::reserve(DimensionSize<Dims>... sizes)
+{
+    this->do_reserve(1, sizes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_reserve(std::size_t total, DimensionSize<Dims>... sizes)
+{
+    _data.reserve(total * detail::requested_size(_size.get(), sizes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension>::data_capacity() const
+{
+    return _data.capacity();
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename Dim>
+typename std::enable_if<std::is_same<Dim, DimensionTag<FirstDimension>>::value, DimensionSize<DimensionTag<FirstDimension>>>::type
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::capacity() const
+{
+    return DimensionSize<DimensionTag<FirstDimension>>(_data.capacity());
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename DataT>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::append(DataT const& data)
+{
+    static_assert(std::is_same<typename DataT::DimensionTuple, DimensionTuple>::value, "append: data must have the same dimension");
+    std::size_t const old_size = _size.get();
+    std::size_t const new_size = old_size + static_cast<std::size_t>(data.template dimension<DimensionTag<FirstDimension>>());
+    if(new_size > _data.capacity()) {
+        if(detail::is_view_of(data, cbegin(), cend())) {
+            // data would be invalidated by the reallocation
+            std::vector<T> const copy(data.cbegin(), data.cend());
+            _data.reserve(std::max(new_size, 2 * old_size));
+            resize(NoInitialisation(), DimensionSize<DimensionTag<FirstDimension>>(new_size));
+            std::copy(copy.begin(), copy.end(), begin() + old_size);
+            return;
+        }
+        _data.reserve(std::max(new_size, 2 * old_size));
+    }
+    resize(NoInitialisation(), DimensionSize<DimensionTag<FirstDimension>>(new_size));
+    std::copy(data.cbegin(), data.cend(), begin() + old_size);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dimension>
 DimensionIndex<Dimension> MultiArray<Alloc, T, SliceMixin, FirstDimension>::calculate_offset(std::size_t delta) const
 {
-    static_assert(std::is_same<Dimension, FirstDimension>::value, "Request for offset for a dimension not supported by this structure");
-    return DimensionIndex<Dimension>(delta / (std::size_t)this->template dimension<FirstDimension>());
+    static_assert(std::is_same<Dimension, DimensionTag<FirstDimension>>::value, "Request for offset for a dimension not supported by this structure");
+    return DimensionIndex<Dimension>(delta / (std::size_t)this->template dimension<DimensionTag<FirstDimension>>());
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
-typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::reference_type MultiArray<Alloc, T, SliceMixin, FirstDimension>::operator[](DimensionIndex<FirstDimension> index)
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::reference_type MultiArray<Alloc, T, SliceMixin, FirstDimension>::operator[](DimensionIndex<DimensionTag<FirstDimension>> index)
 {
     return *(begin() + static_cast<std::size_t>(index));
 }
@@ -652,20 +1031,20 @@ typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::const_iterator MultiA
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 bool MultiArray<Alloc, T, SliceMixin, FirstDimension>::operator==(MultiArray const& o) const
 {
-    return _size == o.dimension<FirstDimension>()
+    return _size.get() == o.dimension<DimensionTag<FirstDimension>>()
            && std::equal(o.cbegin(), o.cend(), cbegin());
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 bool MultiArray<Alloc, T, SliceMixin, FirstDimension>::equal_size(MultiArray const& o) const
 {
-    return _size == o.dimension<FirstDimension>();
+    return _size.get() == o.dimension<DimensionTag<FirstDimension>>();
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dimension>
 constexpr
-typename std::enable_if<std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+typename std::enable_if<std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::block_size_t() const
 {
     return 1;
@@ -673,24 +1052,24 @@ MultiArray<Alloc, T, SliceMixin, FirstDimension>::block_size_t() const
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Dimension>
-typename std::enable_if<!std::is_same<Dimension, FirstDimension>::value, std::size_t>::type
+typename std::enable_if<!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, std::size_t>::type
 MultiArray<Alloc, T, SliceMixin, FirstDimension>::block_size_t() const
 {
-    static_assert(!std::is_same<Dimension, FirstDimension>::value, "programming error - you shouldn't be calling this");
+    static_assert(!std::is_same<Dimension, DimensionTag<FirstDimension>>::value, "programming error - you shouldn't be calling this");
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename Job>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension>::for_each_dimension(Job& job) const
 {
-    job.template exec<FirstDimension>(*this);
+    job.template exec<DimensionTag<FirstDimension>>(*this);
 }
 
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 template<typename MultiArrayType, typename DimensionType>
 void MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_transpose(MultiArrayType& ma, DimensionType const& d)
 {
-    for(DimensionIndex<FirstDimension> i(0); i < _size; ++i) {
+    for(DimensionIndex<DimensionTag<FirstDimension>> i(0); i < _size.get(); ++i) {
         ma[i] = d[i];
     }
 }
@@ -698,7 +1077,59 @@ void MultiArray<Alloc, T, SliceMixin, FirstDimension>::do_transpose(MultiArrayTy
 template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
 std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension>::block_size() const
 {
-    return static_cast<std::size_t>(_size);
+    return static_cast<std::size_t>(_size.get());
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+inline std::size_t MultiArray<Alloc, T, SliceMixin, FirstDimension>::index_offset(DimensionIndex<Dims> const&... indexes) const
+{
+    return static_cast<std::size_t>(arg_helper<DimensionIndex<DimensionTag<FirstDimension>> const&, DimensionIndex<Dims> const&...>::arg(indexes...));
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+void MultiArray<Alloc, T, SliceMixin, FirstDimension>::check_index(DimensionIndex<Dims> const&... indexes) const
+{
+    if(!(arg_helper<DimensionIndex<DimensionTag<FirstDimension>> const&, DimensionIndex<Dims> const&...>::arg(indexes...) < _size.get())) {
+        throw std::out_of_range("MultiArray: index out of range");
+    }
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+inline typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::operator()(DimensionIndex<Dims>... indexes)
+{
+    static_assert(sizeof...(Dims) == 1, "an index must be provided for every dimension");
+    return _data[index_offset(indexes...)];
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+inline typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::const_reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::operator()(DimensionIndex<Dims>... indexes) const
+{
+    static_assert(sizeof...(Dims) == 1, "an index must be provided for every dimension");
+    return _data[index_offset(indexes...)];
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::at(DimensionIndex<Dims>... indexes)
+{
+    check_index(indexes...);
+    return (*this)(indexes...);
+}
+
+template<typename Alloc, typename T, template<typename> class SliceMixin, typename FirstDimension>
+template<typename... Dims>
+typename MultiArray<Alloc, T, SliceMixin, FirstDimension>::const_reference_type
+MultiArray<Alloc, T, SliceMixin, FirstDimension>::at(DimensionIndex<Dims>... indexes) const
+{
+    check_index(indexes...);
+    return (*this)(indexes...);
 }
 
 } // namespace multiarray
@@ -0,0 +1,307 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/multiarray/TypeTraits.h"
+#include "pss/astrotypes/multiarray/Algorithms.h"
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+template<typename DataT>
+using OuterDimension = typename std::tuple_element<0, typename std::decay<DataT>::type::DimensionTuple>::type;
+
+/// the element type of a MultiArray or Slice
+template<typename DataT>
+using ElementType = typename std::decay<decltype(*std::declval<DataT&>().begin())>::type;
+
+/// the number of partitions to use for operations where the result does not depend on the partitioning
+template<typename ExecutorT>
+std::size_t elementwise_partitions(ExecutorT const& executor)
+{
+    // a few tasks per thread to even out the load
+    return std::max<std::size_t>(1, 4 * executor.concurrency());
+}
+
+/**
+ * @brief a partial reduction that remembers if it has seen any data
+ * @details allows reductions to start from the first element of a partition rather than
+ *          requiring an identity value for the operator
+ */
+template<typename T>
+struct PartialReduction
+{
+    PartialReduction() : valid(false) {}
+
+    template<typename BinaryOpT, typename ValueT>
+    void add(ValueT const* begin, ValueT const* end, BinaryOpT const& op)
+    {
+        if(begin == end) return;
+        if(!valid) {
+            value = static_cast<T>(*begin++);
+            valid = true;
+        }
+        value = std::accumulate(begin, end, value, op);
+    }
+
+    template<typename BinaryOpT>
+    void add(T const& v, BinaryOpT const& op)
+    {
+        value = valid ? op(value, v) : v;
+        valid = true;
+    }
+
+    template<typename BinaryOpT>
+    void merge_into(T& result, BinaryOpT const& op) const
+    {
+        if(valid) result = op(result, value);
+    }
+
+    T value;
+    bool valid;
+};
+
+/// the product of the sizes of all dimensions after Dimension (i.e. the stride of Dimension in contiguous data)
+template<typename Dimension, typename DataT, typename... Dimensions>
+std::size_t inner_block_size(DataT const& data, std::tuple<Dimensions...> const*)
+{
+    std::size_t const sizes[] = { static_cast<std::size_t>(data.template dimension<Dimensions>())... };
+    std::size_t block = 1;
+    for(std::size_t i = find_type<std::tuple<Dimensions...>, Dimension>::value + 1; i < sizeof...(Dimensions); ++i) {
+        block *= sizes[i];
+    }
+    return block;
+}
+
+/**
+ * @brief reduce a single partition into a partial value for each index of Dimension
+ * @details block is the stride of Dimension, so that elements [k * block, (k+1) * block) (in iteration order)
+ *          belong to index k % partials.size()
+ */
+template<typename SliceT, typename T, typename BinaryOpT>
+void reduce_partition(SliceT&& chunk, std::size_t block, std::vector<PartialReduction<T>>& partials, BinaryOpT const& op)
+{
+    typedef ElementType<SliceT> ValueT;
+    std::size_t const size = partials.size();
+    if(block == 1) {
+        // Dimension is the innermost: consecutive elements belong to consecutive indices
+        std::size_t index = 0;
+        chunk.for_each_contiguous_run([&](ValueT const* begin, ValueT const* end)
+                                      {
+                                          for(; begin != end; ++begin) {
+                                              partials[index].add(static_cast<T>(*begin), op);
+                                              if(++index == size) index = 0;
+                                          }
+                                      });
+        return;
+    }
+
+    std::size_t position = 0; // position in the chunk, in iteration order
+    chunk.for_each_contiguous_run([&](ValueT const* begin, ValueT const* end)
+                                  {
+                                      while(begin != end) {
+                                          std::size_t const offset = position % block;
+                                          std::size_t const n = std::min(block - offset, static_cast<std::size_t>(end - begin));
+                                          partials[(position / block) % size].add(begin, begin + n, op);
+                                          begin += n;
+                                          position += n;
+                                      }
+                                  });
+}
+
+} // namespace detail
+
+template<typename Dimension>
+std::vector<DimensionSpan<Dimension>> partition(DimensionSize<Dimension> size, std::size_t number_of_partitions)
+{
+    std::size_t const total = static_cast<std::size_t>(size);
+    std::size_t const n = std::min(total, std::max<std::size_t>(1, number_of_partitions));
+    std::vector<DimensionSpan<Dimension>> spans;
+    spans.reserve(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        std::size_t const start = (i * total) / n;
+        std::size_t const end = ((i + 1) * total) / n;
+        spans.emplace_back(DimensionIndex<Dimension>(start), DimensionSize<Dimension>(end - start));
+    }
+    return spans;
+}
+
+template<typename ExecutorT, typename DataT, typename T>
+void parallel_fill(ExecutorT& executor, DataT& data, T const& value)
+{
+    typedef detail::OuterDimension<DataT> Outer;
+    typedef detail::ElementType<DataT> ValueT;
+    auto const spans = partition(data.template dimension<Outer>(), detail::elementwise_partitions(executor));
+    executor.parallel_for(spans.size(), [&](std::size_t task)
+                          {
+                              data.slice(spans[task]).for_each_contiguous_run([&](ValueT* begin, ValueT* end)
+                                                                             {
+                                                                                 std::fill(begin, end, value);
+                                                                             });
+                          });
+}
+
+template<typename ExecutorT, typename SrcT, typename DstT>
+void parallel_copy(ExecutorT& executor, SrcT const& src, DstT& dst)
+{
+    typedef detail::ElementType<SrcT> SrcValueT;
+    typedef detail::ElementType<DstT> DstValueT;
+    parallel_transform(executor, src, dst, [](SrcValueT const& value) { return static_cast<DstValueT>(value); });
+}
+
+template<typename ExecutorT, typename SrcT, typename DstT, typename FunctionT>
+void parallel_transform(ExecutorT& executor, SrcT const& src, DstT& dst, FunctionT const& fn)
+{
+    typedef detail::OuterDimension<DstT> Outer;
+    static_assert(std::is_same<Outer, detail::OuterDimension<SrcT>>::value, "src and dst must have the same outer dimension");
+    typedef detail::ElementType<SrcT> SrcValueT;
+    typedef detail::ElementType<DstT> DstValueT;
+    if(src.data_size() != dst.data_size()) {
+        throw std::invalid_argument("parallel_transform: src and dst sizes differ");
+    }
+    auto const spans = partition(dst.template dimension<Outer>(), detail::elementwise_partitions(executor));
+    executor.parallel_for(spans.size(), [&](std::size_t task)
+                          {
+                              detail::for_each_run_pair(dst.slice(spans[task]), src.slice(spans[task])
+                                                       , [&](DstValueT* d, SrcValueT const* s, std::size_t n)
+                                                         {
+                                                             std::transform(s, s + n, d, fn);
+                                                             return true;
+                                                         });
+                          });
+}
+
+template<typename ExecutorT, typename RangeT, typename FunctionT>
+void parallel_for_each(ExecutorT& executor, RangeT const& range, FunctionT const& fn)
+{
+    typedef decltype(range.begin()) IteratorT;
+    typedef typename std::iterator_traits<IteratorT>::difference_type DifferenceT;
+    std::size_t const total = static_cast<std::size_t>(std::distance(range.begin(), range.end()));
+    std::size_t const n = std::min(total, detail::elementwise_partitions(executor));
+    executor.parallel_for(n, [&](std::size_t task)
+                          {
+                              std::size_t const start = (task * total) / n;
+                              std::size_t count = ((task + 1) * total) / n - start;
+                              IteratorT it = range.begin() + static_cast<DifferenceT>(start);
+                              while(count--) {
+                                  fn(*it);
+                                  ++it;
+                              }
+                          });
+}
+
+template<typename ExecutorT, typename DataT, typename T, typename BinaryOpT>
+T parallel_reduce(ExecutorT& executor, DataT const& data, T init, BinaryOpT const& op)
+{
+    typedef detail::OuterDimension<DataT> Outer;
+    typedef detail::ElementType<DataT> ValueT;
+    auto const spans = partition(data.template dimension<Outer>(), parallel_reduce_partitions);
+    std::vector<detail::PartialReduction<T>> partials(spans.size());
+    executor.parallel_for(spans.size(), [&](std::size_t task)
+                          {
+                              detail::PartialReduction<T>& partial = partials[task];
+                              data.slice(spans[task]).for_each_contiguous_run([&](ValueT const* begin, ValueT const* end)
+                                                                             {
+                                                                                 partial.add(begin, end, op);
+                                                                             });
+                          });
+
+    // combine in a fixed order
+    for(auto const& partial : partials) {
+        partial.merge_into(init, op);
+    }
+    return init;
+}
+
+template<typename Dimension, typename ExecutorT, typename DataT, typename T, typename BinaryOpT>
+std::vector<T> parallel_reduce_by(ExecutorT& executor, DataT const& data, T init, BinaryOpT const& op)
+{
+    typedef detail::OuterDimension<DataT> Outer;
+    typedef typename DataT::DimensionTuple DimensionTuple;
+    static_assert(has_type<DimensionTuple, Dimension>::value, "Dimension is not a dimension of the data");
+
+    std::size_t const size = static_cast<std::size_t>(data.template dimension<Dimension>());
+    std::size_t const block = detail::inner_block_size<Dimension>(data, static_cast<DimensionTuple const*>(nullptr));
+    auto const spans = partition(data.template dimension<Outer>(), parallel_reduce_partitions);
+    std::vector<T> result(size, init);
+
+    if(std::is_same<Dimension, Outer>::value) {
+        // each index of Dimension lies in a single partition so we can reduce directly into the result
+        executor.parallel_for(spans.size(), [&](std::size_t task)
+                              {
+                                  std::size_t const start = static_cast<std::size_t>(spans[task].start());
+                                  std::vector<detail::PartialReduction<T>> partials(static_cast<std::size_t>(spans[task].span()));
+                                  detail::reduce_partition(data.slice(spans[task]), block, partials, op);
+                                  for(std::size_t i = 0; i < partials.size(); ++i) {
+                                      partials[i].merge_into(result[start + i], op);
+                                  }
+                              });
+        return result;
+    }
+
+    std::vector<std::vector<detail::PartialReduction<T>>> partials(spans.size(), std::vector<detail::PartialReduction<T>>(size));
+    executor.parallel_for(spans.size(), [&](std::size_t task)
+                          {
+                              detail::reduce_partition(data.slice(spans[task]), block, partials[task], op);
+                          });
+
+    // combine in a fixed order
+    for(auto const& partial : partials) {
+        for(std::size_t i = 0; i < size; ++i) {
+            partial[i].merge_into(result[i], op);
+        }
+    }
+    return result;
+}
+
+template<typename ExecutorT, typename DstArrayT, typename SrcArrayT>
+void parallel_transpose(ExecutorT& executor, DstArrayT& dst, SrcArrayT const& src)
+{
+    static_assert(DstArrayT::rank == SrcArrayT::rank, "transpose requires types with the same dimensions");
+    typedef detail::OuterDimension<DstArrayT> Outer;
+    if(dst.data_size() == 0) return;
+    detail::TransposeLayout<typename DstArrayT::DimensionTuple> const layout(dst, src);
+    detail::ElementType<SrcArrayT> const* const src_ptr = &*src.begin();
+    detail::ElementType<DstArrayT>* const dst_ptr = &*dst.begin();
+    auto const spans = partition(dst.template dimension<Outer>(), detail::elementwise_partitions(executor));
+    executor.parallel_for(spans.size(), [&](std::size_t task)
+                          {
+                              std::size_t const start = static_cast<std::size_t>(spans[task].start());
+                              detail::TransposeLayout<typename DstArrayT::DimensionTuple> chunk_layout(layout);
+                              chunk_layout.sizes[0] = static_cast<std::size_t>(spans[task].span());
+                              detail::transpose(chunk_layout
+                                              , src_ptr + start * layout.src_strides[0]
+                                              , dst_ptr + start * layout.dst_strides[0]);
+                          });
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
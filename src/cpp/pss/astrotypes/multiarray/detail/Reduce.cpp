@@ -0,0 +1,449 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+/// the value type of a MultiArray or Slice
+template<typename DataT>
+using ReduceValueType = typename std::decay<decltype(*std::declval<DataT const&>().begin())>::type;
+
+template<typename T, typename DimensionTuple>
+struct ReducedArrayHelper;
+
+template<typename T, typename... Dimensions>
+struct ReducedArrayHelper<T, std::tuple<Dimensions...>>
+{
+    typedef ReducedArray<T, Dimensions...> type;
+};
+
+// integer sums are exact, so the compensated algorithms are only used for floating point
+template<typename AccT, typename AlgorithmT>
+using ReduceAlgorithm = typename std::conditional<std::is_floating_point<AccT>::value, AlgorithmT, reduction::Sum>::type;
+
+/// the number of independent partial sums kept along a contiguous run, enough to fill a vector register
+constexpr std::size_t reduce_lanes = 16;
+
+/// the number of accumulators updated by each pass over the rows (small enough to stay in L1 cache)
+constexpr std::size_t reduce_tile = 1024;
+
+/// the number of terms summed directly before pairwise summation splits them
+constexpr std::size_t pairwise_block = 128;
+
+template<typename AccT>
+inline void kahan_add(AccT& sum, AccT& compensation, AccT const value)
+{
+    AccT const y = value - compensation;
+    AccT const t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
+// ---------------------------------------------------------------------------------------------
+// sum_run: the sum of n values, stride apart (i.e. reducing the innermost dimension)
+// ---------------------------------------------------------------------------------------------
+template<typename AccT, typename T>
+AccT sum_run(T const* data, std::size_t n, std::size_t stride, reduction::Sum const&)
+{
+    AccT total = 0;
+    std::size_t i = 0;
+    if(stride == 1 && std::is_floating_point<AccT>::value) {
+        // independent partial sums so that floating point additions can be vectorised
+        // (the compiler is free to do this itself for integers)
+        AccT lanes[reduce_lanes] = {};
+        for(; i + reduce_lanes <= n; i += reduce_lanes) {
+            for(std::size_t j = 0; j < reduce_lanes; ++j) {
+                lanes[j] += static_cast<AccT>(data[i + j]);
+            }
+        }
+        for(std::size_t j = 0; j < reduce_lanes; ++j) {
+            total += lanes[j];
+        }
+    }
+    if(stride == 1) {
+        for(; i < n; ++i) {
+            total += static_cast<AccT>(data[i]);
+        }
+    }
+    else {
+        for(; i < n; ++i) {
+            total += static_cast<AccT>(data[i * stride]);
+        }
+    }
+    return total;
+}
+
+template<typename AccT, typename T>
+AccT sum_run(T const* data, std::size_t n, std::size_t stride, reduction::KahanSum const&)
+{
+    AccT sum = 0;
+    AccT compensation = 0;
+    std::size_t i = 0;
+    if(stride == 1) {
+        AccT lanes[reduce_lanes] = {};
+        AccT lane_compensations[reduce_lanes] = {};
+        for(; i + reduce_lanes <= n; i += reduce_lanes) {
+            for(std::size_t j = 0; j < reduce_lanes; ++j) {
+                kahan_add(lanes[j], lane_compensations[j], static_cast<AccT>(data[i + j]));
+            }
+        }
+        for(std::size_t j = 0; j < reduce_lanes; ++j) {
+            kahan_add(sum, compensation, lanes[j]);
+            kahan_add(sum, compensation, -lane_compensations[j]);
+        }
+    }
+    for(; i < n; ++i) {
+        kahan_add(sum, compensation, static_cast<AccT>(data[i * stride]));
+    }
+    return sum - compensation;
+}
+
+template<typename AccT, typename T>
+AccT sum_run(T const* data, std::size_t n, std::size_t stride, reduction::PairwiseSum const& algorithm)
+{
+    if(n <= pairwise_block) return sum_run<AccT>(data, n, stride, reduction::Sum());
+    std::size_t const half = (n / 2) / reduce_lanes * reduce_lanes;
+    return sum_run<AccT>(data, half, stride, algorithm) + sum_run<AccT>(data + half * stride, n - half, stride, algorithm);
+}
+
+// ---------------------------------------------------------------------------------------------
+// sum_rows: out[i] = the sum over r < rows of data[r * row_stride + i * stride], for i < n
+//           The rows are walked a tile of n at a time so the partial sums stay in cache.
+// ---------------------------------------------------------------------------------------------
+template<typename AccT, typename T>
+void sum_rows(T const* data, std::size_t rows, std::size_t row_stride, std::size_t n, std::size_t stride, AccT* out, reduction::Sum const&)
+{
+    for(std::size_t start = 0; start < n; start += reduce_tile) {
+        std::size_t const count = std::min(reduce_tile, n - start);
+        AccT* const acc = out + start;
+        std::fill(acc, acc + count, AccT(0));
+        T const* row = data + start * stride;
+        for(std::size_t r = 0; r < rows; ++r, row += row_stride) {
+            if(stride == 1) {
+                for(std::size_t i = 0; i < count; ++i) {
+                    acc[i] += static_cast<AccT>(row[i]);
+                }
+            }
+            else {
+                for(std::size_t i = 0; i < count; ++i) {
+                    acc[i] += static_cast<AccT>(row[i * stride]);
+                }
+            }
+        }
+    }
+}
+
+template<typename AccT, typename T>
+void sum_rows(T const* data, std::size_t rows, std::size_t row_stride, std::size_t n, std::size_t stride, AccT* out, reduction::KahanSum const&)
+{
+    AccT compensation[reduce_tile];
+    for(std::size_t start = 0; start < n; start += reduce_tile) {
+        std::size_t const count = std::min(reduce_tile, n - start);
+        AccT* const acc = out + start;
+        std::fill(acc, acc + count, AccT(0));
+        std::fill(compensation, compensation + count, AccT(0));
+        T const* row = data + start * stride;
+        for(std::size_t r = 0; r < rows; ++r, row += row_stride) {
+            for(std::size_t i = 0; i < count; ++i) {
+                kahan_add(acc[i], compensation[i], static_cast<AccT>(row[i * stride]));
+            }
+        }
+        for(std::size_t i = 0; i < count; ++i) {
+            acc[i] -= compensation[i];
+        }
+    }
+}
+
+template<typename AccT, typename T>
+void sum_rows(T const* data, std::size_t rows, std::size_t row_stride, std::size_t n, std::size_t stride, AccT* out, reduction::PairwiseSum const&)
+{
+    if(rows <= pairwise_block) {
+        sum_rows<AccT>(data, rows, row_stride, n, stride, out, reduction::Sum());
+        return;
+    }
+
+    // blocks of rows are summed directly and the block sums combined pairwise, like the digits of a binary counter
+    std::vector<AccT> levels;        // a tile of partial sums for each level
+    std::vector<std::size_t> blocks; // the number of blocks summed into each level
+    for(std::size_t start = 0; start < n; start += reduce_tile) {
+        std::size_t const count = std::min(reduce_tile, n - start);
+        std::size_t depth = 0;
+        for(std::size_t r = 0; r < rows; r += pairwise_block) {
+            if(levels.size() < (depth + 1) * reduce_tile) {
+                levels.resize((depth + 1) * reduce_tile);
+                blocks.resize(depth + 1);
+            }
+            sum_rows<AccT>(data + r * row_stride + start * stride, std::min(pairwise_block, rows - r), row_stride
+                          , count, stride, &levels[depth * reduce_tile], reduction::Sum());
+            blocks[depth] = 1;
+            ++depth;
+            while(depth > 1 && blocks[depth - 1] == blocks[depth - 2]) {
+                AccT* const a = &levels[(depth - 2) * reduce_tile];
+                AccT const* const b = &levels[(depth - 1) * reduce_tile];
+                for(std::size_t i = 0; i < count; ++i) {
+                    a[i] += b[i];
+                }
+                blocks[depth - 2] += blocks[depth - 1];
+                --depth;
+            }
+        }
+        for(; depth > 1; --depth) {
+            AccT* const a = &levels[(depth - 2) * reduce_tile];
+            AccT const* const b = &levels[(depth - 1) * reduce_tile];
+            for(std::size_t i = 0; i < count; ++i) {
+                a[i] += b[i];
+            }
+        }
+        std::copy(levels.begin(), levels.begin() + count, out + start);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// a user supplied binary operator in place of the summation algorithms
+// ---------------------------------------------------------------------------------------------
+template<typename BinaryOpT>
+struct BinaryOpReduction
+{
+    BinaryOpT const& op;
+};
+
+template<typename AccT, typename T, typename BinaryOpT>
+AccT sum_run(T const* data, std::size_t n, std::size_t stride, BinaryOpReduction<BinaryOpT> const& reduction)
+{
+    AccT total = static_cast<AccT>(data[0]);
+    for(std::size_t i = 1; i < n; ++i) {
+        total = reduction.op(total, static_cast<AccT>(data[i * stride]));
+    }
+    return total;
+}
+
+template<typename AccT, typename T, typename BinaryOpT>
+void sum_rows(T const* data, std::size_t rows, std::size_t row_stride, std::size_t n, std::size_t stride, AccT* out, BinaryOpReduction<BinaryOpT> const& reduction)
+{
+    for(std::size_t start = 0; start < n; start += reduce_tile) {
+        std::size_t const count = std::min(reduce_tile, n - start);
+        AccT* const acc = out + start;
+        T const* row = data + start * stride;
+        for(std::size_t i = 0; i < count; ++i) {
+            acc[i] = static_cast<AccT>(row[i * stride]);
+        }
+        row += row_stride;
+        for(std::size_t r = 1; r < rows; ++r, row += row_stride) {
+            for(std::size_t i = 0; i < count; ++i) {
+                acc[i] = reduction.op(acc[i], static_cast<AccT>(row[i * stride]));
+            }
+        }
+    }
+}
+
+/**
+ * @brief reduce the dimension at position of a strided array into out (dense, the remaining dimensions in order)
+ * @details when the reduced dimension is the innermost each output value is the sum of a single run,
+ *          otherwise whole rows of the innermost dimension are added together. Either way memory is
+ *          read along the innermost dimension.
+ */
+template<typename AccT, typename AlgorithmT, typename T, std::size_t Rank>
+void reduce_strided(T const* data, std::array<std::size_t, Rank> const& extents, std::array<std::size_t, Rank> const& strides
+                   , std::size_t position, AccT* out, AlgorithmT const& algorithm)
+{
+    bool const innermost = (position == Rank - 1);
+    std::size_t const size = extents[position];
+    std::size_t const run = innermost ? 1 : extents[Rank - 1];
+
+    // the dimensions to step through here, leaving the others to the kernels
+    std::array<std::size_t, Rank> loop_extents;
+    std::array<std::size_t, Rank> loop_strides;
+    std::size_t loop_rank = 0;
+    std::size_t total = 1;
+    for(std::size_t d = 0; d < Rank; ++d) {
+        if(d == position || (!innermost && d == Rank - 1)) continue;
+        loop_extents[loop_rank] = extents[d];
+        loop_strides[loop_rank] = strides[d];
+        total *= extents[d];
+        ++loop_rank;
+    }
+    if(total == 0 || run == 0) return;
+    if(size == 0) {
+        std::fill(out, out + total * run, AccT());
+        return;
+    }
+
+    std::array<std::size_t, Rank> index;
+    std::fill(index.begin(), index.end(), 0);
+    std::size_t offset = 0;
+    for(std::size_t n = 0; n < total; ++n) {
+        if(innermost) {
+            out[n] = sum_run<AccT>(data + offset, size, strides[position], algorithm);
+        }
+        else {
+            sum_rows<AccT>(data + offset, size, strides[position], run, strides[Rank - 1], out + n * run, algorithm);
+        }
+
+        for(std::size_t d = loop_rank; d > 0; --d) {
+            if(++index[d - 1] < loop_extents[d - 1]) {
+                offset += loop_strides[d - 1];
+                break;
+            }
+            offset -= (loop_extents[d - 1] - 1) * loop_strides[d - 1];
+            index[d - 1] = 0;
+        }
+    }
+}
+
+template<typename DataT, typename OutT, typename... Dimensions>
+bool same_sizes(DataT const& data, OutT const& out, std::tuple<Dimensions...> const*)
+{
+    bool const same[] = { true, (static_cast<std::size_t>(data.template dimension<Dimensions>()) == static_cast<std::size_t>(out.template dimension<Dimensions>()))... };
+    return std::all_of(std::begin(same), std::end(same), [](bool b) { return b; });
+}
+
+template<typename ResultT, typename DataT, typename... Dimensions>
+ResultT make_reduced_array(DataT const& data, std::tuple<Dimensions...> const*)
+{
+    return ResultT(NoInitialisation(), data.template dimension<Dimensions>()...);
+}
+
+} // namespace detail
+
+template<typename T, typename... Dimensions>
+ReducedArray<T, Dimensions...>::ReducedArray(DimensionSize<Dimensions>... sizes)
+    : BaseT(sizes...)
+{
+}
+
+template<typename T, typename... Dimensions>
+ReducedArray<T, Dimensions...>::ReducedArray(NoInitialisation const&, DimensionSize<Dimensions>... sizes)
+    : BaseT(NoInitialisation(), sizes...)
+{
+}
+
+template<typename Dimension, typename DataT, typename AccT>
+struct ReducedArrayType
+{
+    private:
+        typedef detail::ReduceValueType<DataT> ValueT;
+        typedef typename std::conditional<std::is_void<AccT>::value, typename ReduceAccumulator<ValueT>::type, AccT>::type ResultValueT;
+        typedef typename tuple_diff<typename std::decay<DataT>::type::DimensionTuple, std::tuple<Dimension>>::type DimensionTuple;
+
+    public:
+        typedef typename detail::ReducedArrayHelper<ResultValueT, DimensionTuple>::type type;
+};
+
+template<typename Dimension, typename DataT, typename OutT>
+struct MeanArrayType
+{
+    private:
+        typedef detail::ReduceValueType<DataT> ValueT;
+
+    public:
+        typedef typename ReducedArrayType<Dimension, DataT
+                                         , typename std::conditional<std::is_void<OutT>::value, typename ReduceMean<ValueT>::type, OutT>::type
+                                         >::type type;
+};
+
+namespace detail {
+
+template<typename Dimension, typename DataT, typename OutT, typename AlgorithmT>
+void reduce_into(DataT const& data, OutT& out, AlgorithmT const& algorithm)
+{
+    typedef typename std::decay<DataT>::type::DimensionTuple DimensionTuple;
+    typedef typename tuple_diff<DimensionTuple, std::tuple<Dimension>>::type RemainingTuple;
+    typedef typename std::decay<decltype(*out.begin())>::type AccT;
+    static constexpr std::size_t rank = std::tuple_size<DimensionTuple>::value;
+    static_assert(has_type<DimensionTuple, Dimension>::value, "Dimension is not a dimension of the data");
+    static_assert(rank > 1, "reduce needs at least two dimensions, use std::accumulate for a single dimension");
+    static_assert(std::is_same<typename OutT::DimensionTuple, RemainingTuple>::value, "out must have the dimensions of data without Dimension, in the same order");
+
+    if(!detail::same_sizes(data, out, static_cast<RemainingTuple const*>(nullptr))) {
+        throw std::invalid_argument("reduce: out does not match the size of the data");
+    }
+
+    auto const ref = make_array_ref(data);
+    std::array<std::size_t, rank> extents;
+    std::array<std::size_t, rank> strides;
+    std::copy(ref.extents(), ref.extents() + rank, extents.begin());
+    std::copy(ref.strides(), ref.strides() + rank, strides.begin());
+    reduce_strided<AccT>(ref.data(), extents, strides, find_type<DimensionTuple, Dimension>::value
+                        , out.data_size() == 0 ? nullptr : &*out.begin(), algorithm);
+}
+
+} // namespace detail
+
+template<typename Dimension, typename DataT, typename OutT, typename AlgorithmT>
+typename std::enable_if<is_multiarray<OutT>::value>::type
+reduce(DataT const& data, OutT& out, AlgorithmT const&)
+{
+    typedef typename std::decay<decltype(*out.begin())>::type AccT;
+    detail::reduce_into<Dimension>(data, out, detail::ReduceAlgorithm<AccT, AlgorithmT>());
+}
+
+template<typename Dimension, typename AccT, typename DataT, typename AlgorithmT>
+typename std::enable_if<is_reduction_algorithm<AlgorithmT>::value, typename ReducedArrayType<Dimension, DataT, AccT>::type>::type
+reduce(DataT const& data, AlgorithmT const& algorithm)
+{
+    typedef typename ReducedArrayType<Dimension, DataT, AccT>::type ResultT;
+    ResultT result = detail::make_reduced_array<ResultT>(data, static_cast<typename ResultT::DimensionTuple const*>(nullptr));
+    reduce<Dimension>(data, result, algorithm);
+    return result;
+}
+
+template<typename Dimension, typename AccT, typename DataT, typename BinaryOpT>
+typename std::enable_if<!is_reduction_algorithm<BinaryOpT>::value && !is_multiarray<BinaryOpT>::value
+                       , typename ReducedArrayType<Dimension, DataT, AccT>::type>::type
+reduce(DataT const& data, BinaryOpT const& op)
+{
+    typedef typename ReducedArrayType<Dimension, DataT, AccT>::type ResultT;
+    ResultT result = detail::make_reduced_array<ResultT>(data, static_cast<typename ResultT::DimensionTuple const*>(nullptr));
+    detail::reduce_into<Dimension>(data, result, detail::BinaryOpReduction<BinaryOpT>{op});
+    return result;
+}
+
+template<typename Dimension, typename OutT, typename DataT, typename AlgorithmT>
+typename MeanArrayType<Dimension, DataT, OutT>::type mean(DataT const& data, AlgorithmT const& algorithm)
+{
+    typedef typename MeanArrayType<Dimension, DataT, OutT>::type ResultT;
+    typedef typename std::decay<decltype(*std::declval<ResultT&>().begin())>::type ValueT;
+    auto const sums = reduce<Dimension>(data, algorithm);
+    ResultT result = detail::make_reduced_array<ResultT>(data, static_cast<typename ResultT::DimensionTuple const*>(nullptr));
+    std::size_t const size = static_cast<std::size_t>(data.template dimension<Dimension>());
+    if(size == 0) {
+        std::fill(result.begin(), result.end(), ValueT(0));
+        return result;
+    }
+    std::transform(sums.begin(), sums.end(), result.begin(), [size](typename std::decay<decltype(*sums.begin())>::type const& sum)
+                   {
+                       return static_cast<ValueT>(sum) / static_cast<ValueT>(size);
+                   });
+    return result;
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
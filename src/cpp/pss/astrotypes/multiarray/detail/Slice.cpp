@@ -23,6 +23,7 @@
  */
 #include "ReducedRankSlice.h"
 #include "pss/astrotypes/multiarray/Slice.h"
+#include "pss/astrotypes/multiarray/Algorithms.h"
 #include <iostream>
 
 namespace pss {
@@ -262,7 +263,7 @@ Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::Slice( copy_
     , _base_span(copy._base_span) // not used (yet) so don't bother calculating it
     , _ptr(copy._ptr)
 {
-    _ptr = BaseT::offset(_ptr);
+    BaseT::offset(_ptr);
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
@@ -285,13 +286,11 @@ Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::Slice(copy_r
                                                         , DimensionSpan<Dims> const&... spans
                                               )
     : BaseT(copy_resize_construct_base_tag(), static_cast<BaseT const&>(copy), spans...)
-    , _span(DimensionSpan<Dimension>(DimensionIndex<Dimension>(copy._span.start()
-                           + arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...).start())
-                           , arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...).span()))
+    , _span(sub_span(copy._span, arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...)))
     , _base_span(copy._base_span) // not used (yet) so don't bother calculating it
     , _ptr(copy._ptr + static_cast<std::size_t>(
                            arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...).start())
-                     * BaseT::_base_span)
+                     * copy._span.stride() * BaseT::_base_span)
 {
     BaseT::offset(_ptr);
 }
@@ -303,7 +302,7 @@ Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::Slice( copy_
                                                         , DimensionSpan<Dims> const&... spans
                                                         )
     : BaseT(copy_resize_construct_base_tag(), static_cast<BaseT const&>(copy), spans...)
-    , _span(arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...))
+    , _span(sub_span(copy._span, arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...)))
     , _base_span(copy._base_span) // not used (yet) so don't bother calculating it
 {
 }
@@ -351,13 +350,13 @@ typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::par
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
 std::size_t Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::base_span() const
 {
-    return static_cast<std::size_t>(BaseT::_base_span * (_span.span() - 1)) + BaseT::base_span();
+    return static_cast<std::size_t>(BaseT::_base_span * (_span.span() - 1)) * _span.stride() + BaseT::base_span();
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
 std::size_t Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::diff_base_span() const
 {
-    return static_cast<std::size_t>(BaseT::_base_span) * (_span.span() - 1);
+    return static_cast<std::size_t>(BaseT::_base_span) * _span.stride() * (_span.span() - 1);
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
@@ -447,7 +446,7 @@ typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::tem
 Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::operator[](DimensionIndex<Dimension> offset)
 {
     typedef typename OperatorSliceType<Dimension>::type ReducedSliceType;
-    return ReducedSliceType(static_cast<BaseT const&>(*this)) += static_cast<std::size_t>(offset);
+    return ReducedSliceType(static_cast<BaseT const&>(*this)) += static_cast<std::size_t>(offset) * _span.stride();
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
@@ -455,7 +454,7 @@ typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::tem
 Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::operator[](DimensionIndex<Dimension> offset) const
 {
     typedef typename ConstOperatorSliceType<Dimension>::type ReturnSliceType;
-    return ReturnSliceType(reinterpret_cast<ReturnSliceType const&>(*this)) += static_cast<std::size_t>(offset);
+    return ReturnSliceType(reinterpret_cast<ReturnSliceType const&>(*this)) += static_cast<std::size_t>(offset) * _span.stride();
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
@@ -494,10 +493,37 @@ template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixi
 Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>& Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::operator+=(DimensionSize<Dimension> offset)
 {
     _ptr += (offset * BaseT::_base_span);
+    _span.start(_span.start() + offset); // keep parent_span() in step
+    BaseT::offset(_ptr);
+    return *this;
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename Dim>
+typename std::enable_if<arg_helper<Dim, Dimensions...>::value, Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>&>::type
+Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::operator+=(DimensionSize<Dim> offset)
+{
+    BaseT::shift_span(offset);
     BaseT::offset(_ptr);
     return *this;
 }
 
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename Dim>
+typename std::enable_if<std::is_same<Dim, Dimension>::value>::type
+Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::shift_span(DimensionSize<Dim> offset)
+{
+    _span.start(_span.start() + offset);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename Dim>
+typename std::enable_if<!std::is_same<Dim, Dimension>::value>::type
+Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::shift_span(DimensionSize<Dim> offset)
+{
+    BaseT::shift_span(offset);
+}
+
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
 template<typename... Dims>
 typename std::enable_if<arg_helper<Dimension, Dims...>::value, typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::SliceType>::type
@@ -568,6 +594,55 @@ typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::con
     return const_iterator::create_end(*this);
 }
 
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::for_each_contiguous_run(FunctionT&& fn)
+{
+    if(data_size() == 0) return;
+    do_for_each_contiguous_run(&*base_ptr(), fn);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::for_each_contiguous_run(FunctionT&& fn) const
+{
+    if(data_size() == 0) return;
+    do_for_each_contiguous_run(&*parent_const_iterator(base_ptr()), fn);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::contiguous() const
+{
+    return BaseT::contiguous() && BaseT::data_size() == static_cast<std::size_t>(BaseT::_base_span)
+           && (_span.stride() == 1 || _span.span() <= DimensionSize<Dimension>(1));
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
+template<typename PointerT, typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::do_for_each_contiguous_run(PointerT ptr, FunctionT& fn) const
+{
+    std::size_t const block = static_cast<std::size_t>(BaseT::_base_span);
+    std::size_t const stride = block * _span.stride();
+    std::size_t const span = static_cast<std::size_t>(_span.span());
+    if(BaseT::contiguous()) {
+        std::size_t const run = BaseT::data_size();
+        if(run == stride) {
+            // lower dimensions are complete so the whole block is contiguous
+            fn(ptr, ptr + run * span);
+            return;
+        }
+        for(std::size_t i=0; i < span; ++i) {
+            fn(ptr, ptr + run);
+            ptr += stride;
+        }
+        return;
+    }
+    for(std::size_t i=0; i < span; ++i) {
+        BaseT::do_for_each_contiguous_run(ptr, fn);
+        ptr += stride;
+    }
+}
+
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension, typename... Dimensions>
 inline typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::Parent& Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::parent() const
 {
@@ -618,7 +693,7 @@ bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::increme
         current -= BaseT::diff_base_span(); // return pointer to beginning of BaseT block
         if(++pos.index < _span.span())
         {
-            current += static_cast<std::size_t>(BaseT::_base_span); // move up to next block
+            current += static_cast<std::size_t>(BaseT::_base_span) * _span.stride(); // move up to next block
             return true;
         }
         // reset end to the end of a first chunk
@@ -642,11 +717,11 @@ bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::add_it(
     std::size_t new_index = pos.index + rank_inc;
     if(new_index < _span.span()) {
         pos.index = new_index;
-        current += rank_inc * static_cast<std::size_t>(BaseT::_base_span);
+        current += rank_inc * static_cast<std::size_t>(BaseT::_base_span) * _span.stride();
         return true;
     }
     std::size_t delta = new_index - _span.span();
-    current += (delta - pos.index) * static_cast<std::size_t>(BaseT::_base_span);
+    current += (delta - pos.index) * static_cast<std::size_t>(BaseT::_base_span) * _span.stride();
     pos.index = delta;
     return false;
 }
@@ -655,11 +730,12 @@ template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixi
 template<typename IteratorDifferenceT>
 IteratorDifferenceT Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::diff_it(IteratorDifferenceT const& diff) const
 {
-    if(diff < (IteratorDifferenceT)BaseT::_base_span) {
+    IteratorDifferenceT const step = static_cast<IteratorDifferenceT>(static_cast<std::size_t>(BaseT::_base_span) * _span.stride());
+    if(diff < step) {
         return BaseT::diff_it(diff);
     }
     else {
-        return IteratorDifferenceT(diff/BaseT::_base_span) * BaseT::data_size() + BaseT::diff_it(diff%BaseT::_base_span);
+        return IteratorDifferenceT(diff/step) * BaseT::data_size() + BaseT::diff_it(diff%step);
     }
 }
 
@@ -667,8 +743,7 @@ template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixi
 template<bool const_type>
 bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension, Dimensions...>::operator==(Slice<const_type, SliceTraitsT, SliceMixin, Dimension, Dimensions...> const& s) const
 {
-    return s.data_size() == data_size()
-           && std::equal(s.cbegin(), s.cend(), cbegin());
+    return bulk_equal(s, *this);
 }
 
 // -------------------- single dimension specialisation -------------------
@@ -785,9 +860,7 @@ template<typename... Dims>
 Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::Slice( typename std::enable_if<arg_helper<Dimension, Dims...>::value, copy_resize_construct_base_tag const&>::type
     , Slice const& copy
     , DimensionSpan<Dims> const&... spans)
-    : _span(DimensionSpan<Dimension>(DimensionIndex<Dimension>(copy._span.start()
-                           + arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...).start())
-                           , arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...).span()))
+    : _span(sub_span(copy._span, arg_helper<DimensionSpan<Dimension> const&, DimensionSpan<Dims> const&...>::arg(spans...)))
     , _base_span(copy._base_span)
     , _parent(copy._parent)
 {
@@ -913,23 +986,22 @@ typename std::enable_if<((!std::is_same<Dim, Dimension>::value)
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::reference_type Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::operator[](std::size_t p) const
 {
-    parent_iterator ptr = (_ptr + p);
+    parent_iterator ptr = (_ptr + p * _span.stride());
     return *ptr;
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::reference_type Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::operator[](DimensionIndex<Dimension> const& p) const
 {
-    return *(_ptr + static_cast<std::size_t>(p));
+    return *(_ptr + static_cast<std::size_t>(p) * _span.stride());
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 Slice<IsConst, SliceTraitsT, SliceMixin, Dimension> Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::slice(DimensionSpan<Dimension> const& span)
 {
     Slice r(*this);
-    _ptr += static_cast<std::size_t>(_span.start());
-    r._span.start(_span.start() + DimensionSize<Dimension>(span.start()));
-    r._span.span(span.span());
+    r._span = sub_span(_span, span);
+    r._ptr += static_cast<std::size_t>(span.start()) * _span.stride();
     return r;
 }
 
@@ -937,22 +1009,60 @@ template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixi
 typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::ConstSliceType Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::slice(DimensionSpan<Dimension> const& span) const
 {
     ConstSliceType r(*this);
-    _ptr += static_cast<std::size_t>(_span.start());
-    r._span.start(_span.start() + DimensionSize<Dimension>(span.start()));
-    r._span.span(span.span());
+    r._span = sub_span(_span, span);
+    r._ptr += static_cast<std::size_t>(span.start()) * _span.stride();
     return r;
 }
 
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
+template<typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::for_each_contiguous_run(FunctionT&& fn)
+{
+    if(data_size() == 0) return;
+    do_for_each_contiguous_run(&*_ptr, fn);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
+template<typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::for_each_contiguous_run(FunctionT&& fn) const
+{
+    if(data_size() == 0) return;
+    do_for_each_contiguous_run(&*parent_const_iterator(_ptr), fn);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
+bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::contiguous() const
+{
+    return _span.stride() == 1 || _span.span() <= DimensionSize<Dimension>(1);
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
+template<typename PointerT, typename FunctionT>
+void Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::do_for_each_contiguous_run(PointerT ptr, FunctionT& fn) const
+{
+    std::size_t const span = static_cast<std::size_t>(_span.span());
+    if(contiguous()) {
+        fn(ptr, ptr + span);
+        return;
+    }
+    // a strided span has a run for each element
+    for(std::size_t i=0; i < span; ++i) {
+        fn(ptr, ptr + 1);
+        ptr += _span.stride();
+    }
+}
+
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 std::size_t Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::base_span() const
 {
-    return static_cast<std::size_t>(_span.span());
+    std::size_t const span = static_cast<std::size_t>(_span.span());
+    return span == 0 ? 0 : (span - 1) * _span.stride() + 1;
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 std::size_t Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::diff_base_span() const
 {
-    return static_cast<std::size_t>(_span.span());
+    return static_cast<std::size_t>(_span.span()) * _span.stride();
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
@@ -982,39 +1092,47 @@ typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::SelfType& Slice<Is
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::begin()
+template<typename Dim>
+typename std::enable_if<std::is_same<Dim, Dimension>::value>::type
+Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::shift_span(DimensionSize<Dim> offset)
 {
-    return _ptr;
+    _span.start(_span.start() + offset);
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::begin() const
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::begin()
 {
-    return _ptr;
+    return iterator(_ptr, static_cast<typename iterator::difference_type>(_span.stride()));
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::cbegin() const
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::begin() const
 {
-    return _ptr;
+    return const_iterator(_ptr, static_cast<typename const_iterator::difference_type>(_span.stride()));
+}
+
+template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::cbegin() const
+{
+    return const_iterator(_ptr, static_cast<typename const_iterator::difference_type>(_span.stride()));
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::end()
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::end()
 {
-    return _ptr + static_cast<std::size_t>(_span.span());
+    return iterator(_ptr + static_cast<std::size_t>(_span.span()) * _span.stride(), static_cast<typename iterator::difference_type>(_span.stride()));
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::end() const
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::end() const
 {
-    return _ptr + static_cast<std::size_t>(_span.span());
+    return const_iterator(_ptr + static_cast<std::size_t>(_span.span()) * _span.stride(), static_cast<typename const_iterator::difference_type>(_span.stride()));
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
-typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::parent_const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::cend() const
+typename Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::const_iterator Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::cend() const
 {
-    return _ptr + static_cast<std::size_t>(_span.span());
+    return const_iterator(_ptr + static_cast<std::size_t>(_span.span()) * _span.stride(), static_cast<typename const_iterator::difference_type>(_span.stride()));
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
@@ -1027,7 +1145,7 @@ template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixi
 template<typename IteratorT>
 bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::increment_it(IteratorT& current, SlicePosition<rank>& pos) const
 {
-    ++current;
+    current += _span.stride();
     if(++pos.index < _span.span())
     {
         return true;
@@ -1044,28 +1162,29 @@ bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::add_it(std::size_t inc
     if(new_index < _span.span())
     {
         pos.index = new_index;
-        current += increment;
+        current += increment * _span.stride();
         return true;
     }
-    current -= pos.index;
+    current -= pos.index * _span.stride();
     pos.index = new_index - _span.span();
-    current += pos.index;
+    current += pos.index * _span.stride();
     return false;
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 template<typename IteratorDifferenceT>
-IteratorDifferenceT Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::diff_it(IteratorDifferenceT const& diff)
+IteratorDifferenceT Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::diff_it(IteratorDifferenceT const& diff) const
 {
-    return diff;
+    // rounded up as the end of a strided span lies short of a whole stride
+    IteratorDifferenceT const stride = static_cast<IteratorDifferenceT>(_span.stride());
+    return (diff + stride - 1) / stride;
 }
 
 template<bool IsConst, typename SliceTraitsT, template<typename> class SliceMixin, typename Dimension>
 template<bool IsConst_>
 bool Slice<IsConst, SliceTraitsT, SliceMixin, Dimension>::operator==(Slice<IsConst_, SliceTraitsT, SliceMixin, Dimension> const& s) const
 {
-    return s.data_size() == data_size()
-        && std::equal(s.begin(), s.end(), begin());
+    return bulk_equal(s, *this);
 }
 
 template<typename SliceType>
@@ -24,6 +24,8 @@
 #ifndef PSS_ASTROTYPES_MULTIARRAY_SLICEHELPERS_H
 #define PSS_ASTROTYPES_MULTIARRAY_SLICEHELPERS_H
 
+#include "pss/astrotypes/multiarray/DimensionSpan.h"
+
 /**
  * @brief Implementation details. Helper class defintions.
  */
@@ -98,6 +100,17 @@ struct arg_helper<T, Dim, Dims...> : public arg_helper<T, Dims...>
 };
 
 
+/**
+ * @brief the span selected by sub_span from within span, expressed in the indices of the parent of span
+ */
+template<typename Dimension>
+DimensionSpan<Dimension> sub_span(DimensionSpan<Dimension> const& span, DimensionSpan<Dimension> const& sub_span)
+{
+    return DimensionSpan<Dimension>(span.start() + DimensionSize<Dimension>(static_cast<std::size_t>(sub_span.start()) * span.stride())
+                                  , sub_span.span()
+                                  , span.stride() * sub_span.stride());
+}
+
 template<typename ParentT, typename ExcludeDimension>
 struct InternalSliceTraits  {
     typedef ParentT Parent;
@@ -49,14 +49,26 @@ DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, rank>::operator
 }
 
 template<typename DerivedType, typename SliceType, bool is_const, int rank>
-DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, rank>::operator+=(std::size_t increment)
+DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, rank>::operator+=(difference_type increment)
 {
-    if(!this->_slice->add_it(increment, this->_current, _pos)) {
+    if(increment < 0) {
+        // restart from the beginning of the slice
+        increment += offset();
+        this->_current = _slice->base_ptr();
+        _pos = SlicePosition<SliceT::rank>();
+    }
+    if(!this->_slice->add_it(static_cast<std::size_t>(increment), this->_current, _pos)) {
         this->_current = this->_slice->end()._current;
     }
     return static_cast<DerivedType&>(*this);
 }
 
+template<typename DerivedType, typename SliceType, bool is_const, int rank>
+typename SliceIteratorBase<DerivedType, SliceType, is_const, rank>::difference_type SliceIteratorBase<DerivedType, SliceType, is_const, rank>::offset() const
+{
+    return _slice->diff_it(this->_current - _slice->base_ptr());
+}
+
 template<typename DerivedType, typename SliceType, bool is_const, int rank>
 typename SliceIteratorBase<DerivedType, SliceType, is_const, rank>::SliceT const& SliceIteratorBase<DerivedType, SliceType, is_const, rank>::slice() const
 {
@@ -66,7 +78,7 @@ typename SliceIteratorBase<DerivedType, SliceType, is_const, rank>::SliceT const
 template<typename DerivedType, typename SliceType, bool is_const, int rank>
 typename SliceIteratorBase<DerivedType, SliceType, is_const, rank>::difference_type SliceIteratorBase<DerivedType, SliceType, is_const, rank>::operator-(SelfType const& f) const
 {
-    return  _slice->diff_it(this->_current - f._current);
+    return offset() - f.offset();
 }
 
 template<typename DerivedType, typename SliceType, bool is_const>
@@ -102,20 +114,62 @@ DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator++(
 }
 
 template<typename DerivedType, typename SliceType, bool is_const>
-DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator++(int)
+DerivedType SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator++(int)
 {
     DerivedType copy(static_cast<DerivedType&>(*this));
-    ++(*this);
+    ++static_cast<DerivedType&>(*this);
+    return copy;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator--()
+{
+    return static_cast<DerivedType&>(*this) += -1;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+DerivedType SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator--(int)
+{
+    DerivedType copy(static_cast<DerivedType&>(*this));
+    --static_cast<DerivedType&>(*this);
     return copy;
 }
 
 template<typename DerivedType, typename SliceType, bool is_const>
-DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator+=(std::size_t increment)
+DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator+=(difference_type increment)
 {
     _current += increment;
     return static_cast<DerivedType&>(*this);
 }
 
+template<typename DerivedType, typename SliceType, bool is_const>
+DerivedType& SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator-=(difference_type decrement)
+{
+    return static_cast<DerivedType&>(*this) += -decrement;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+DerivedType SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator+(difference_type increment) const
+{
+    DerivedType copy(static_cast<DerivedType const&>(*this));
+    copy += increment;
+    return copy;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+DerivedType SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator-(difference_type decrement) const
+{
+    DerivedType copy(static_cast<DerivedType const&>(*this));
+    copy += -decrement;
+    return copy;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+typename SliceIteratorBase<DerivedType, SliceType, is_const, 1>::reference SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator[](difference_type offset) const
+{
+    return *(*this + offset);
+}
+
 template<typename DerivedType, typename SliceType, bool is_const>
 const typename SliceIteratorBase<DerivedType, SliceType, is_const, 1>::reference SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator*() const
 {
@@ -143,6 +197,35 @@ bool SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator!=(SliceIte
     return _current != o._current;
 }
 
+// n.b. the parent memory position increases monotonically with the position in the slice
+template<typename DerivedType, typename SliceType, bool is_const>
+template<typename D, bool const_val>
+bool SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator<(SliceIteratorBase<D, SliceType, const_val, 1> const& o) const
+{
+    return _current < o._current;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+template<typename D, bool const_val>
+bool SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator>(SliceIteratorBase<D, SliceType, const_val, 1> const& o) const
+{
+    return _current > o._current;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+template<typename D, bool const_val>
+bool SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator<=(SliceIteratorBase<D, SliceType, const_val, 1> const& o) const
+{
+    return _current <= o._current;
+}
+
+template<typename DerivedType, typename SliceType, bool is_const>
+template<typename D, bool const_val>
+bool SliceIteratorBase<DerivedType, SliceType, is_const, 1>::operator>=(SliceIteratorBase<D, SliceType, const_val, 1> const& o) const
+{
+    return _current >= o._current;
+}
+
 template<typename T, std::size_t B, typename SliceType, bool is_const>
 SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator++()
 {
@@ -152,10 +235,56 @@ SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIte
 }
 
 template<typename T, std::size_t B, typename SliceType, bool is_const>
-SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator++(int)
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator++(int)
 {
-    static_assert(B == 1 , "not yet implemented");
-    return static_cast<ActualBaseT&>(*this)++;
+    SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> copy(*this);
+    ++(*this);
+    return copy;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator--()
+{
+    --static_cast<ActualBaseT&>(*this);
+    return *this;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator--(int)
+{
+    SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> copy(*this);
+    --(*this);
+    return copy;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator+=(typename ActualBaseT::difference_type increment)
+{
+    static_cast<ActualBaseT&>(*this) += increment;
+    return *this;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>& SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator-=(typename ActualBaseT::difference_type decrement)
+{
+    static_cast<ActualBaseT&>(*this) -= decrement;
+    return *this;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator+(typename ActualBaseT::difference_type increment) const
+{
+    SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> copy(*this);
+    copy += increment;
+    return copy;
+}
+
+template<typename T, std::size_t B, typename SliceType, bool is_const>
+SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const>::operator-(typename ActualBaseT::difference_type decrement) const
+{
+    SliceIterator<multiarray::ReducedRankSlice<SliceType, T, B>, is_const> copy(*this);
+    copy -= decrement;
+    return copy;
 }
 
 template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
@@ -166,9 +295,56 @@ SliceIterator<Mixin<SliceType, Ts...>, is_const>& SliceIterator<Mixin<SliceType,
 }
 
 template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
-SliceIterator<Mixin<SliceType, Ts...>, is_const>& SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator++(int)
+SliceIterator<Mixin<SliceType, Ts...>, is_const> SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator++(int)
 {
-    return static_cast<ActualBaseT&>(*this)++;
+    SliceIterator<Mixin<SliceType, Ts...>, is_const> copy(*this);
+    ++(*this);
+    return copy;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const>& SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator--()
+{
+    --static_cast<ActualBaseT&>(*this);
+    return *this;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const> SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator--(int)
+{
+    SliceIterator<Mixin<SliceType, Ts...>, is_const> copy(*this);
+    --(*this);
+    return copy;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const>& SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator+=(typename ActualBaseT::difference_type increment)
+{
+    static_cast<ActualBaseT&>(*this) += increment;
+    return *this;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const>& SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator-=(typename ActualBaseT::difference_type decrement)
+{
+    static_cast<ActualBaseT&>(*this) -= decrement;
+    return *this;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const> SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator+(typename ActualBaseT::difference_type increment) const
+{
+    SliceIterator<Mixin<SliceType, Ts...>, is_const> copy(*this);
+    copy += increment;
+    return copy;
+}
+
+template<template<typename, typename...> class Mixin, typename... Ts, typename SliceType, bool is_const>
+SliceIterator<Mixin<SliceType, Ts...>, is_const> SliceIterator<Mixin<SliceType, Ts...>, is_const>::operator-(typename ActualBaseT::difference_type decrement) const
+{
+    SliceIterator<Mixin<SliceType, Ts...>, is_const> copy(*this);
+    copy -= decrement;
+    return copy;
 }
 
 } // namespace multiarray
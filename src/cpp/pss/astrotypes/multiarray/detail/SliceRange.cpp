@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+template<typename SliceT, typename Dimension>
+SliceRange<SliceT, Dimension>::SliceRange(SliceT const& first, DimensionSize<Dimension> size, std::size_t stride)
+    : _first(first)
+    , _size(size)
+    , _stride(stride)
+{
+}
+
+template<typename SliceT, typename Dimension>
+typename SliceRange<SliceT, Dimension>::iterator SliceRange<SliceT, Dimension>::begin() const
+{
+    return iterator(_first, 0, _stride);
+}
+
+template<typename SliceT, typename Dimension>
+typename SliceRange<SliceT, Dimension>::iterator SliceRange<SliceT, Dimension>::end() const
+{
+    return iterator(_first, static_cast<std::size_t>(_size), _stride);
+}
+
+template<typename SliceT, typename Dimension>
+typename SliceRange<SliceT, Dimension>::const_iterator SliceRange<SliceT, Dimension>::cbegin() const
+{
+    return begin();
+}
+
+template<typename SliceT, typename Dimension>
+typename SliceRange<SliceT, Dimension>::const_iterator SliceRange<SliceT, Dimension>::cend() const
+{
+    return end();
+}
+
+template<typename SliceT, typename Dimension>
+DimensionSize<Dimension> SliceRange<SliceT, Dimension>::size() const
+{
+    return _size;
+}
+
+template<typename SliceT, typename Dimension>
+bool SliceRange<SliceT, Dimension>::empty() const
+{
+    return _size == DimensionSize<Dimension>(0);
+}
+
+template<typename SliceT, typename Dimension>
+SliceT SliceRange<SliceT, Dimension>::operator[](DimensionIndex<Dimension> index) const
+{
+    return begin()[static_cast<typename iterator::difference_type>(static_cast<std::size_t>(index))];
+}
+
+template<typename Dimension, typename DataT>
+typename std::enable_if<is_slice<DataT>::value, std::size_t>::type
+slice_range_stride(DataT const& data)
+{
+    return data.template span<Dimension>().stride();
+}
+
+template<typename Dimension, typename DataT>
+typename std::enable_if<!is_slice<DataT>::value, std::size_t>::type
+slice_range_stride(DataT const&)
+{
+    return 1;
+}
+
+template<typename Dimension, typename DataT>
+auto make_slice_range(DataT&& data) -> SliceRange<decltype(data[DimensionIndex<Dimension>(0)]), Dimension>
+{
+    typedef decltype(data[DimensionIndex<Dimension>(0)]) SliceT;
+    return SliceRange<SliceT, Dimension>(data[DimensionIndex<Dimension>(0)], data.template dimension<Dimension>(), slice_range_stride<Dimension>(data));
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension>::SliceRangeIterator(SliceT const& first, std::size_t index, std::size_t stride)
+    : _first(first)
+    , _slice(first)
+    , _index(index)
+    , _stride(stride)
+{
+    if(index != 0) _slice += DimensionSize<Dimension>(index * _stride);
+}
+
+template<typename SliceT, typename Dimension>
+inline typename SliceRangeIterator<SliceT, Dimension>::reference SliceRangeIterator<SliceT, Dimension>::operator*() const
+{
+    return _slice;
+}
+
+template<typename SliceT, typename Dimension>
+inline typename SliceRangeIterator<SliceT, Dimension>::pointer SliceRangeIterator<SliceT, Dimension>::operator->() const
+{
+    return &_slice;
+}
+
+template<typename SliceT, typename Dimension>
+typename SliceRangeIterator<SliceT, Dimension>::value_type SliceRangeIterator<SliceT, Dimension>::operator[](difference_type n) const
+{
+    SliceT slice(_first);
+    slice += DimensionSize<Dimension>(static_cast<std::size_t>(static_cast<difference_type>(_index) + n) * _stride);
+    return slice;
+}
+
+template<typename SliceT, typename Dimension>
+inline SliceRangeIterator<SliceT, Dimension>& SliceRangeIterator<SliceT, Dimension>::operator++()
+{
+    _slice += DimensionSize<Dimension>(_stride);
+    ++_index;
+    return *this;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> SliceRangeIterator<SliceT, Dimension>::operator++(int)
+{
+    SliceRangeIterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+template<typename SliceT, typename Dimension>
+inline SliceRangeIterator<SliceT, Dimension>& SliceRangeIterator<SliceT, Dimension>::operator--()
+{
+    return *this += -1;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> SliceRangeIterator<SliceT, Dimension>::operator--(int)
+{
+    SliceRangeIterator tmp(*this);
+    --*this;
+    return tmp;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension>& SliceRangeIterator<SliceT, Dimension>::operator+=(difference_type n)
+{
+    if(n >= 0) {
+        _slice += DimensionSize<Dimension>(static_cast<std::size_t>(n) * _stride);
+        _index += static_cast<std::size_t>(n);
+    }
+    else {
+        // slices only move forwards, so restart from the beginning of the range
+        _index -= static_cast<std::size_t>(-n);
+        _slice = _first;
+        _slice += DimensionSize<Dimension>(_index * _stride);
+    }
+    return *this;
+}
+
+template<typename SliceT, typename Dimension>
+inline SliceRangeIterator<SliceT, Dimension>& SliceRangeIterator<SliceT, Dimension>::operator-=(difference_type n)
+{
+    return *this += -n;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> SliceRangeIterator<SliceT, Dimension>::operator+(difference_type n) const
+{
+    SliceRangeIterator tmp(*this);
+    return tmp += n;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> SliceRangeIterator<SliceT, Dimension>::operator-(difference_type n) const
+{
+    SliceRangeIterator tmp(*this);
+    return tmp -= n;
+}
+
+template<typename SliceT, typename Dimension>
+inline typename SliceRangeIterator<SliceT, Dimension>::difference_type SliceRangeIterator<SliceT, Dimension>::operator-(SliceRangeIterator const& it) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(it._index);
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator==(SliceRangeIterator const& it) const
+{
+    return _index == it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator!=(SliceRangeIterator const& it) const
+{
+    return _index != it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator<(SliceRangeIterator const& it) const
+{
+    return _index < it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator>(SliceRangeIterator const& it) const
+{
+    return _index > it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator<=(SliceRangeIterator const& it) const
+{
+    return _index <= it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline bool SliceRangeIterator<SliceT, Dimension>::operator>=(SliceRangeIterator const& it) const
+{
+    return _index >= it._index;
+}
+
+template<typename SliceT, typename Dimension>
+inline std::size_t SliceRangeIterator<SliceT, Dimension>::index() const
+{
+    return _index;
+}
+
+template<typename SliceT, typename Dimension>
+SliceRangeIterator<SliceT, Dimension> operator+(typename SliceRangeIterator<SliceT, Dimension>::difference_type n, SliceRangeIterator<SliceT, Dimension> const& it)
+{
+    return it + n;
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
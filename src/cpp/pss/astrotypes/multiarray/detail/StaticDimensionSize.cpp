@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdexcept>
+#include <string>
+
+namespace pss {
+namespace astrotypes {
+
+template<typename Dimension, std::size_t N>
+constexpr std::size_t StaticDimensionSize<Dimension, N>::value;
+
+template<typename Dimension, std::size_t N>
+StaticDimensionSize<Dimension, N>::StaticDimensionSize()
+    : DimensionSize<Dimension>(N)
+{
+}
+
+// ------------- runtime size --------------------
+template<typename Dimension>
+DimensionSizeStorage<Dimension>::DimensionSizeStorage()
+    : _size(0)
+{
+}
+
+template<typename Dimension>
+DimensionSizeStorage<Dimension>::DimensionSizeStorage(DimensionSize<Dimension> const& size)
+    : _size(size)
+{
+}
+
+template<typename Dimension>
+inline DimensionSize<Dimension> DimensionSizeStorage<Dimension>::get() const
+{
+    return _size;
+}
+
+template<typename Dimension>
+void DimensionSizeStorage<Dimension>::set(DimensionSize<Dimension> const& size)
+{
+    _size = size;
+}
+
+// ------------- static size ---------------------
+template<typename Dimension, std::size_t N>
+DimensionSizeStorage<StaticDimensionSize<Dimension, N>>::DimensionSizeStorage()
+{
+}
+
+template<typename Dimension, std::size_t N>
+DimensionSizeStorage<StaticDimensionSize<Dimension, N>>::DimensionSizeStorage(DimensionSize<Dimension> const& size)
+{
+    set(size);
+}
+
+template<typename Dimension, std::size_t N>
+inline DimensionSize<Dimension> DimensionSizeStorage<StaticDimensionSize<Dimension, N>>::get() const
+{
+    return DimensionSize<Dimension>(N);
+}
+
+template<typename Dimension, std::size_t N>
+void DimensionSizeStorage<StaticDimensionSize<Dimension, N>>::set(DimensionSize<Dimension> const& size)
+{
+    if(static_cast<std::size_t>(size) != N) {
+        throw std::invalid_argument("size " + std::to_string(static_cast<std::size_t>(size))
+                                    + " requested for a dimension with a static size of " + std::to_string(N));
+    }
+}
+
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,188 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+template<typename BaseIteratorT>
+StridedIterator<BaseIteratorT>::StridedIterator()
+    : _base()
+    , _stride(1)
+{
+}
+
+template<typename BaseIteratorT>
+StridedIterator<BaseIteratorT>::StridedIterator(BaseIteratorT base, difference_type stride)
+    : _base(base)
+    , _stride(stride)
+{
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT, typename Enable>
+StridedIterator<BaseIteratorT>::StridedIterator(StridedIterator<OtherIteratorT> const& other)
+    : _base(other.base())
+    , _stride(other.stride())
+{
+}
+
+template<typename BaseIteratorT>
+inline BaseIteratorT const& StridedIterator<BaseIteratorT>::base() const
+{
+    return _base;
+}
+
+template<typename BaseIteratorT>
+inline typename StridedIterator<BaseIteratorT>::difference_type StridedIterator<BaseIteratorT>::stride() const
+{
+    return _stride;
+}
+
+template<typename BaseIteratorT>
+inline typename StridedIterator<BaseIteratorT>::reference StridedIterator<BaseIteratorT>::operator*() const
+{
+    return *_base;
+}
+
+template<typename BaseIteratorT>
+inline typename StridedIterator<BaseIteratorT>::pointer StridedIterator<BaseIteratorT>::operator->() const
+{
+    return &*_base;
+}
+
+template<typename BaseIteratorT>
+inline typename StridedIterator<BaseIteratorT>::reference StridedIterator<BaseIteratorT>::operator[](difference_type n) const
+{
+    return *(_base + n * _stride);
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT>& StridedIterator<BaseIteratorT>::operator++()
+{
+    _base += _stride;
+    return *this;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT> StridedIterator<BaseIteratorT>::operator++(int)
+{
+    StridedIterator copy(*this);
+    _base += _stride;
+    return copy;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT>& StridedIterator<BaseIteratorT>::operator--()
+{
+    _base -= _stride;
+    return *this;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT> StridedIterator<BaseIteratorT>::operator--(int)
+{
+    StridedIterator copy(*this);
+    _base -= _stride;
+    return copy;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT>& StridedIterator<BaseIteratorT>::operator+=(difference_type n)
+{
+    _base += n * _stride;
+    return *this;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT>& StridedIterator<BaseIteratorT>::operator-=(difference_type n)
+{
+    _base -= n * _stride;
+    return *this;
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT> StridedIterator<BaseIteratorT>::operator+(difference_type n) const
+{
+    return StridedIterator(_base + n * _stride, _stride);
+}
+
+template<typename BaseIteratorT>
+inline StridedIterator<BaseIteratorT> StridedIterator<BaseIteratorT>::operator-(difference_type n) const
+{
+    return StridedIterator(_base - n * _stride, _stride);
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline typename StridedIterator<BaseIteratorT>::difference_type StridedIterator<BaseIteratorT>::operator-(StridedIterator<OtherIteratorT> const& other) const
+{
+    return (_base - other.base()) / _stride;
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator==(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base == other.base();
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator!=(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base != other.base();
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator<(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base < other.base();
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator>(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base > other.base();
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator<=(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base <= other.base();
+}
+
+template<typename BaseIteratorT>
+template<typename OtherIteratorT>
+inline bool StridedIterator<BaseIteratorT>::operator>=(StridedIterator<OtherIteratorT> const& other) const
+{
+    return _base >= other.base();
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
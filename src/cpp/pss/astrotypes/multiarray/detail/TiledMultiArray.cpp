@@ -0,0 +1,408 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <stdexcept>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+
+// ------------------ TiledIterator ----------------------
+template<typename T>
+TiledIterator<T>::TiledIterator(T* base, std::size_t offset, std::size_t index, std::size_t run_length, std::size_t step, std::size_t jump)
+    : _base(base)
+    , _offset(offset)
+    , _index(index)
+    , _run_pos(0)
+    , _run_length(run_length)
+    , _step(step)
+    , _jump(jump)
+{
+}
+
+template<typename T>
+typename TiledIterator<T>::reference TiledIterator<T>::operator*() const
+{
+    return _base[_offset];
+}
+
+template<typename T>
+typename TiledIterator<T>::pointer TiledIterator<T>::operator->() const
+{
+    return _base + _offset;
+}
+
+template<typename T>
+TiledIterator<T>& TiledIterator<T>::operator++()
+{
+    ++_index;
+    _offset += _step;
+    if(++_run_pos == _run_length) {
+        _run_pos = 0;
+        _offset += _jump;
+    }
+    return *this;
+}
+
+template<typename T>
+TiledIterator<T> TiledIterator<T>::operator++(int)
+{
+    TiledIterator tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+template<typename T>
+bool TiledIterator<T>::operator==(TiledIterator const& o) const
+{
+    return _index == o._index;
+}
+
+template<typename T>
+bool TiledIterator<T>::operator!=(TiledIterator const& o) const
+{
+    return _index != o._index;
+}
+
+// ------------------ TiledLine ----------------------
+template<typename T, typename Dimension>
+TiledLine<T, Dimension>::TiledLine(T* base, std::size_t offset, std::size_t size, std::size_t run_length, std::size_t step, std::size_t jump)
+    : _base(base)
+    , _offset(offset)
+    , _size(size)
+    , _run_length(run_length)
+    , _step(step)
+    , _jump(jump)
+{
+}
+
+template<typename T, typename Dimension>
+T& TiledLine<T, Dimension>::operator[](DimensionIndex<Dimension> index) const
+{
+    std::size_t const i = static_cast<std::size_t>(index);
+    return _base[_offset + (i / _run_length) * (_run_length * _step + _jump) + (i % _run_length) * _step];
+}
+
+template<typename T, typename Dimension>
+template<typename Dim>
+DimensionSize<Dim> TiledLine<T, Dimension>::dimension() const
+{
+    return DimensionSize<Dim>(std::is_same<Dim, Dimension>::value ? _size : 1);
+}
+
+template<typename T, typename Dimension>
+typename TiledLine<T, Dimension>::iterator TiledLine<T, Dimension>::begin() const
+{
+    return iterator(_base, _offset, 0, _run_length, _step, _jump);
+}
+
+template<typename T, typename Dimension>
+typename TiledLine<T, Dimension>::iterator TiledLine<T, Dimension>::end() const
+{
+    return iterator(_base, _offset, _size, _run_length, _step, _jump);
+}
+
+template<typename T, typename Dimension>
+typename TiledLine<T, Dimension>::const_iterator TiledLine<T, Dimension>::cbegin() const
+{
+    return const_iterator(_base, _offset, 0, _run_length, _step, _jump);
+}
+
+template<typename T, typename Dimension>
+typename TiledLine<T, Dimension>::const_iterator TiledLine<T, Dimension>::cend() const
+{
+    return const_iterator(_base, _offset, _size, _run_length, _step, _jump);
+}
+
+// ------------------ Tile ----------------------
+template<typename T, typename OuterDimension, typename InnerDimension>
+Tile<T, OuterDimension, InnerDimension>::Tile(T* data, std::size_t row_stride, DimensionSize<OuterDimension> outer_size, DimensionSize<InnerDimension> inner_size)
+    : _data(data)
+    , _row_stride(row_stride)
+    , _outer_size(outer_size)
+    , _inner_size(inner_size)
+{
+}
+
+template<typename T, typename OuterDimension, typename InnerDimension>
+T* Tile<T, OuterDimension, InnerDimension>::row(DimensionIndex<OuterDimension> index) const
+{
+    return _data + static_cast<std::size_t>(index) * _row_stride;
+}
+
+template<typename T, typename OuterDimension, typename InnerDimension>
+T& Tile<T, OuterDimension, InnerDimension>::operator()(DimensionIndex<OuterDimension> outer, DimensionIndex<InnerDimension> inner) const
+{
+    return _data[static_cast<std::size_t>(outer) * _row_stride + static_cast<std::size_t>(inner)];
+}
+
+template<typename T, typename OuterDimension, typename InnerDimension>
+T* Tile<T, OuterDimension, InnerDimension>::data() const
+{
+    return _data;
+}
+
+template<typename T, typename OuterDimension, typename InnerDimension>
+std::size_t Tile<T, OuterDimension, InnerDimension>::row_stride() const
+{
+    return _row_stride;
+}
+
+template<typename T, typename OuterDimension, typename InnerDimension>
+template<typename Dim>
+DimensionSize<Dim> Tile<T, OuterDimension, InnerDimension>::dimension() const
+{
+    static_assert(std::is_same<Dim, OuterDimension>::value || std::is_same<Dim, InnerDimension>::value, "dimension not supported by this Tile");
+    return DimensionSize<Dim>(std::is_same<Dim, OuterDimension>::value ? _outer_size : _inner_size);
+}
+
+// ------------------ TiledMultiArray ----------------------
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TiledMultiArray()
+    : _outer_size(0)
+    , _inner_size(0)
+    , _inner_tiles(0)
+{
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TiledMultiArray(DimensionSize<OuterDimension> outer_size, DimensionSize<InnerDimension> inner_size)
+{
+    set_size(outer_size, inner_size);
+    _data.resize_initialised(number_of_tiles<OuterDimension>() * _inner_tiles * LayoutT::tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TiledMultiArray(DimensionSize<InnerDimension> inner_size, DimensionSize<OuterDimension> outer_size)
+    : TiledMultiArray(outer_size, inner_size)
+{
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TiledMultiArray(NoInitialisation const&, DimensionSize<OuterDimension> outer_size, DimensionSize<InnerDimension> inner_size)
+{
+    set_size(outer_size, inner_size);
+    _data.resize(number_of_tiles<OuterDimension>() * _inner_tiles * LayoutT::tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename DataT, typename Enable>
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TiledMultiArray(DataT const& data)
+    : TiledMultiArray(NoInitialisation(), data.template dimension<OuterDimension>(), data.template dimension<InnerDimension>())
+{
+    copy_from(data);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+void TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::set_size(std::size_t outer, std::size_t inner)
+{
+    _outer_size = outer;
+    _inner_size = inner;
+    _inner_tiles = (inner + LayoutT::inner_tile_size - 1) / LayoutT::inner_tile_size;
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+void TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::resize(DimensionSize<OuterDimension> outer_size, DimensionSize<InnerDimension> inner_size)
+{
+    set_size(outer_size, inner_size);
+    _data.resize(0);
+    _data.resize_initialised(number_of_tiles<OuterDimension>() * _inner_tiles * LayoutT::tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename Dim>
+DimensionSize<Dim> TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::dimension() const
+{
+    static_assert(has_dimension<Dim>(), "dimension not supported by this TiledMultiArray");
+    return DimensionSize<Dim>(std::is_same<Dim, OuterDimension>::value ? _outer_size : _inner_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+std::size_t TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::data_size() const
+{
+    return _outer_size * _inner_size;
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename Dim>
+std::size_t TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::number_of_tiles() const
+{
+    static_assert(has_dimension<Dim>(), "dimension not supported by this TiledMultiArray");
+    return std::is_same<Dim, OuterDimension>::value ? (_outer_size + LayoutT::outer_tile_size - 1) / LayoutT::outer_tile_size
+                                                    : _inner_tiles;
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+std::size_t TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::tile_offset(std::size_t outer_tile, std::size_t inner_tile) const
+{
+    return (outer_tile * _inner_tiles + inner_tile) * LayoutT::tile_size;
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+std::size_t TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::offset(std::size_t outer, std::size_t inner) const
+{
+    return tile_offset(outer / LayoutT::outer_tile_size, inner / LayoutT::inner_tile_size)
+         + (outer % LayoutT::outer_tile_size) * LayoutT::inner_tile_size
+         + inner % LayoutT::inner_tile_size;
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+T& TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator()(DimensionIndex<OuterDimension> outer, DimensionIndex<InnerDimension> inner)
+{
+    return _data[offset(outer, inner)];
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+T const& TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator()(DimensionIndex<OuterDimension> outer, DimensionIndex<InnerDimension> inner) const
+{
+    return _data[offset(outer, inner)];
+}
+
+// a line along the inner dimension: runs of inner_tile_size contiguous elements, one in each tile across
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::OuterLineType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator[](DimensionIndex<OuterDimension> index)
+{
+    return OuterLineType(_data.data(), offset(index, 0), _inner_size, LayoutT::inner_tile_size, 1, LayoutT::tile_size - LayoutT::inner_tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::ConstOuterLineType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator[](DimensionIndex<OuterDimension> index) const
+{
+    return ConstOuterLineType(_data.data(), offset(index, 0), _inner_size, LayoutT::inner_tile_size, 1, LayoutT::tile_size - LayoutT::inner_tile_size);
+}
+
+// a line along the outer dimension: runs of outer_tile_size elements a tile row apart, one in each tile down
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::InnerLineType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator[](DimensionIndex<InnerDimension> index)
+{
+    return InnerLineType(_data.data(), offset(0, index), _outer_size, LayoutT::outer_tile_size, LayoutT::inner_tile_size, (_inner_tiles - 1) * LayoutT::tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::ConstInnerLineType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator[](DimensionIndex<InnerDimension> index) const
+{
+    return ConstInnerLineType(_data.data(), offset(0, index), _outer_size, LayoutT::outer_tile_size, LayoutT::inner_tile_size, (_inner_tiles - 1) * LayoutT::tile_size);
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::TileType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::tile(DimensionIndex<OuterDimension> outer_tile, DimensionIndex<InnerDimension> inner_tile)
+{
+    std::size_t const outer_start = static_cast<std::size_t>(outer_tile) * LayoutT::outer_tile_size;
+    std::size_t const inner_start = static_cast<std::size_t>(inner_tile) * LayoutT::inner_tile_size;
+    return TileType(_data.data() + tile_offset(outer_tile, inner_tile)
+                   , LayoutT::inner_tile_size
+                   , DimensionSize<OuterDimension>(std::min(LayoutT::outer_tile_size, _outer_size - outer_start))
+                   , DimensionSize<InnerDimension>(std::min(LayoutT::inner_tile_size, _inner_size - inner_start)));
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+typename TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::ConstTileType
+TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::tile(DimensionIndex<OuterDimension> outer_tile, DimensionIndex<InnerDimension> inner_tile) const
+{
+    std::size_t const outer_start = static_cast<std::size_t>(outer_tile) * LayoutT::outer_tile_size;
+    std::size_t const inner_start = static_cast<std::size_t>(inner_tile) * LayoutT::inner_tile_size;
+    return ConstTileType(_data.data() + tile_offset(outer_tile, inner_tile)
+                        , LayoutT::inner_tile_size
+                        , DimensionSize<OuterDimension>(std::min(LayoutT::outer_tile_size, _outer_size - outer_start))
+                        , DimensionSize<InnerDimension>(std::min(LayoutT::inner_tile_size, _inner_size - inner_start)));
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename DataT>
+void TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::copy_from(DataT const& data)
+{
+    check_size(data, "TiledMultiArray::copy_from: size does not match");
+    for(std::size_t outer_tile = 0; outer_tile < number_of_tiles<OuterDimension>(); ++outer_tile) {
+        for(std::size_t inner_tile = 0; inner_tile < _inner_tiles; ++inner_tile) {
+            TileType t = tile(DimensionIndex<OuterDimension>(outer_tile), DimensionIndex<InnerDimension>(inner_tile));
+            std::size_t const outer_start = outer_tile * LayoutT::outer_tile_size;
+            std::size_t const inner_start = inner_tile * LayoutT::inner_tile_size;
+            for(DimensionIndex<OuterDimension> o(0); o < t.template dimension<OuterDimension>(); ++o) {
+                auto const line = data[DimensionIndex<OuterDimension>(outer_start + o)];
+                T* row = t.row(o);
+                for(std::size_t i = 0; i < t.template dimension<InnerDimension>(); ++i) {
+                    row[i] = line[DimensionIndex<InnerDimension>(inner_start + i)];
+                }
+            }
+        }
+    }
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename DataT>
+void TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::copy_to(DataT& data) const
+{
+    check_size(data, "TiledMultiArray::copy_to: size does not match");
+    for(std::size_t outer_tile = 0; outer_tile < number_of_tiles<OuterDimension>(); ++outer_tile) {
+        for(std::size_t inner_tile = 0; inner_tile < _inner_tiles; ++inner_tile) {
+            ConstTileType t = tile(DimensionIndex<OuterDimension>(outer_tile), DimensionIndex<InnerDimension>(inner_tile));
+            std::size_t const outer_start = outer_tile * LayoutT::outer_tile_size;
+            std::size_t const inner_start = inner_tile * LayoutT::inner_tile_size;
+            for(DimensionIndex<OuterDimension> o(0); o < t.template dimension<OuterDimension>(); ++o) {
+                auto line = data[DimensionIndex<OuterDimension>(outer_start + o)];
+                T const* row = t.row(o);
+                for(std::size_t i = 0; i < t.template dimension<InnerDimension>(); ++i) {
+                    line[DimensionIndex<InnerDimension>(inner_start + i)] = row[i];
+                }
+            }
+        }
+    }
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+template<typename DataT>
+void TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::check_size(DataT const& data, const char* msg) const
+{
+    if(static_cast<std::size_t>(data.template dimension<OuterDimension>()) != _outer_size
+       || static_cast<std::size_t>(data.template dimension<InnerDimension>()) != _inner_size)
+    {
+        throw std::invalid_argument(msg);
+    }
+}
+
+template<typename T, typename LayoutT, typename OuterDimension, typename InnerDimension, typename Alloc>
+bool TiledMultiArray<T, LayoutT, OuterDimension, InnerDimension, Alloc>::operator==(TiledMultiArray const& o) const
+{
+    if(_outer_size != o._outer_size || _inner_size != o._inner_size) return false;
+    // compare tile by tile, ignoring any padding
+    for(std::size_t outer_tile = 0; outer_tile < number_of_tiles<OuterDimension>(); ++outer_tile) {
+        for(std::size_t inner_tile = 0; inner_tile < _inner_tiles; ++inner_tile) {
+            ConstTileType t = tile(DimensionIndex<OuterDimension>(outer_tile), DimensionIndex<InnerDimension>(inner_tile));
+            ConstTileType other = o.tile(DimensionIndex<OuterDimension>(outer_tile), DimensionIndex<InnerDimension>(inner_tile));
+            for(DimensionIndex<OuterDimension> i(0); i < t.template dimension<OuterDimension>(); ++i) {
+                if(!std::equal(t.row(i), t.row(i) + static_cast<std::size_t>(t.template dimension<InnerDimension>()), other.row(i))) return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,167 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <array>
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace detail {
+
+// full tile: bounds known at compile time so the compiler can unroll and vectorise
+template<std::size_t Tile, typename SrcT, typename DstT>
+inline void transpose_tile(SrcT const* src, std::size_t src_stride_b, DstT* dst, std::size_t dst_stride_a)
+{
+    for(std::size_t a=0; a < Tile; ++a) {
+        SrcT const* s = src + a;
+        DstT* d = dst + a * dst_stride_a;
+        for(std::size_t b=0; b < Tile; ++b) {
+            d[b] = static_cast<DstT>(s[b * src_stride_b]);
+        }
+    }
+}
+
+// partial tile at the edges of the data
+template<typename SrcT, typename DstT>
+inline void transpose_tile(SrcT const* src, std::size_t src_stride_b, DstT* dst, std::size_t dst_stride_a
+                          , std::size_t size_a, std::size_t size_b)
+{
+    for(std::size_t a=0; a < size_a; ++a) {
+        SrcT const* s = src + a;
+        DstT* d = dst + a * dst_stride_a;
+        for(std::size_t b=0; b < size_b; ++b) {
+            d[b] = static_cast<DstT>(s[b * src_stride_b]);
+        }
+    }
+}
+
+/**
+ * @brief the sizes and strides of each dimension, in the memory order of the destination
+ */
+template<typename DimensionTuple>
+struct TransposeLayout;
+
+template<typename... Dimensions>
+struct TransposeLayout<std::tuple<Dimensions...>>
+{
+    static constexpr std::size_t rank = sizeof...(Dimensions);
+    typedef std::array<std::size_t, rank> ArrayType;
+
+    template<typename DstArrayT, typename SrcArrayT>
+    TransposeLayout(DstArrayT const& dst, SrcArrayT const& src)
+        : sizes{{ static_cast<std::size_t>(dst.template dimension<Dimensions>())... }}
+        , dst_strides{{ dst.template block_size_t<Dimensions>()... }}
+        , src_strides{{ src.template block_size_t<Dimensions>()... }}
+    {
+    }
+
+    ArrayType sizes;
+    ArrayType dst_strides;
+    ArrayType src_strides;
+};
+
+template<typename LayoutT, typename SrcT, typename DstT>
+void transpose(LayoutT const& layout, SrcT const* src, DstT* dst)
+{
+    constexpr std::size_t rank = LayoutT::rank;
+    std::size_t const b = rank - 1; // contiguous dimension in the destination
+    std::size_t a = b;              // contiguous dimension in the source
+    for(std::size_t i=0; i < rank; ++i) {
+        if(layout.src_strides[i] == 1 && layout.sizes[i] > 1) a = i;
+    }
+    if(layout.src_strides[a] != 1) {
+        // the source contiguous dimension has a single element (e.g. a partition of a larger array)
+        for(std::size_t i=0; i < rank; ++i) {
+            if(layout.src_strides[i] == 1) a = i;
+        }
+    }
+
+    // iterate over all the dimensions other than a and b
+    typename LayoutT::ArrayType index;
+    index.fill(0);
+    std::size_t src_offset = 0;
+    std::size_t dst_offset = 0;
+    while(true) {
+        if(a == b) {
+            // same contiguous dimension in both - a straight copy of the run
+            std::copy(src + src_offset, src + src_offset + layout.sizes[b], dst + dst_offset);
+        }
+        else {
+            tiled_transpose(src + src_offset, layout.src_strides[b]
+                          , dst + dst_offset, layout.dst_strides[a]
+                          , layout.sizes[a], layout.sizes[b]);
+        }
+
+        std::size_t dim = rank;
+        while(dim-- > 0) {
+            if(dim == a || dim == b) continue;
+            if(++index[dim] < layout.sizes[dim]) {
+                src_offset += layout.src_strides[dim];
+                dst_offset += layout.dst_strides[dim];
+                break;
+            }
+            src_offset -= (layout.sizes[dim] - 1) * layout.src_strides[dim];
+            dst_offset -= (layout.sizes[dim] - 1) * layout.dst_strides[dim];
+            index[dim] = 0;
+        }
+        if(dim >= rank) return; // wrapped all dimensions
+    }
+}
+
+} // namespace detail
+
+template<typename SrcT, typename DstT>
+void tiled_transpose(SrcT const* src, std::size_t src_stride_b
+                   , DstT* dst, std::size_t dst_stride_a
+                   , std::size_t size_a, std::size_t size_b)
+{
+    constexpr std::size_t tile = TransposeTile<SrcT, DstT>::value;
+    for(std::size_t a=0; a < size_a; a += tile) {
+        std::size_t const na = std::min(tile, size_a - a);
+        for(std::size_t b=0; b < size_b; b += tile) {
+            std::size_t const nb = std::min(tile, size_b - b);
+            SrcT const* s = src + a + b * src_stride_b;
+            DstT* d = dst + a * dst_stride_a + b;
+            if(na == tile && nb == tile) {
+                detail::transpose_tile<tile>(s, src_stride_b, d, dst_stride_a);
+            }
+            else {
+                detail::transpose_tile(s, src_stride_b, d, dst_stride_a, na, nb);
+            }
+        }
+    }
+}
+
+template<typename DstArrayT, typename SrcArrayT>
+void transpose(DstArrayT& dst, SrcArrayT const& src)
+{
+    static_assert(DstArrayT::rank == SrcArrayT::rank, "transpose requires types with the same dimensions");
+    if(dst.data_size() == 0) return;
+    detail::TransposeLayout<typename DstArrayT::DimensionTuple> const layout(dst, src);
+    detail::transpose(layout, &*src.begin(), &*dst.begin());
+}
+
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
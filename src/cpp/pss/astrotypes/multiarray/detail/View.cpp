@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -21,52 +21,273 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 
 namespace pss {
 namespace astrotypes {
+namespace multiarray {
+namespace detail {
 
-View::View(MultiArrayType& array)
-    : _container(array)
-    , _fbegin(0)
-    , _fend(0)
-    , _sbegin(0)
-    , _send(0)
+/**
+ * @brief the number of elements in the dimensions before/after the mapped Dimension
+ */
+template<typename Dimension, typename DimensionTuple>
+struct ViewSizeHelper;
+
+template<typename Dimension, typename D, typename... Ds>
+struct ViewSizeHelper<Dimension, std::tuple<D, Ds...>>
+{
+    typedef ViewSizeHelper<Dimension, std::tuple<Ds...>> NextT;
+
+    template<typename DataT>
+    static std::size_t outer(DataT const& data)
+    {
+        return std::is_same<D, Dimension>::value ? 1 : static_cast<std::size_t>(data.template dimension<D>()) * NextT::outer(data);
+    }
+
+    template<typename DataT>
+    static std::size_t inner(DataT const& data)
+    {
+        return std::is_same<D, Dimension>::value ? NextT::all(data) : NextT::inner(data);
+    }
+
+    template<typename DataT>
+    static std::size_t all(DataT const& data)
+    {
+        return static_cast<std::size_t>(data.template dimension<D>()) * NextT::all(data);
+    }
+};
+
+template<typename Dimension>
+struct ViewSizeHelper<Dimension, std::tuple<>>
+{
+    template<typename DataT>
+    static std::size_t outer(DataT const&) { return 1; }
+
+    template<typename DataT>
+    static std::size_t inner(DataT const&) { return 1; }
+
+    template<typename DataT>
+    static std::size_t all(DataT const&) { return 1; }
+};
+
+/**
+ * @brief copy n elements, as a single block of memory if the source is contiguous
+ */
+template<typename IteratorT, typename OutIteratorT>
+inline void view_copy(IteratorT src, std::size_t n, OutIteratorT dst, bool reversed)
+{
+    typedef typename std::iterator_traits<IteratorT>::difference_type DifferenceType;
+    if(n == 0) return;
+    auto const* first = &*src;
+    if(&*(src + static_cast<DifferenceType>(n - 1)) == first + (n - 1)) {
+        if(reversed) {
+            std::reverse_copy(first, first + n, dst);
+        }
+        else {
+            std::copy(first, first + n, dst);
+        }
+        return;
+    }
+    if(reversed) {
+        std::reverse_copy(src, src + static_cast<DifferenceType>(n), dst);
+    }
+    else {
+        std::copy(src, src + static_cast<DifferenceType>(n), dst);
+    }
+}
+
+} // namespace detail
+
+template<typename DataT, typename Dimension>
+View<DataT, Dimension>::View(DataT& data, MapperType const& mapper)
+    : _data(data)
+    , _mapper(std::make_shared<MapperType const>(mapper))
+    , _outer_size(detail::ViewSizeHelper<Dimension, DimensionTuple>::outer(data))
+    , _source_size(data.template dimension<Dimension>())
+    , _inner_size(detail::ViewSizeHelper<Dimension, DimensionTuple>::inner(data))
+{
+    static_assert(has_type<DimensionTuple, Dimension>::value, "View: the mapped Dimension is not a dimension of the data");
+    if(!_mapper->fits(DimensionSize<Dimension>(_source_size))) {
+        throw std::invalid_argument("View: IndexMapper refers to indexes outside of the data");
+    }
+}
+
+template<typename DataT, typename Dimension>
+View<DataT, Dimension>::View(DataT& data, std::shared_ptr<MapperType const> const& mapper)
+    : _data(data)
+    , _mapper(mapper)
+    , _outer_size(detail::ViewSizeHelper<Dimension, DimensionTuple>::outer(data))
+    , _source_size(data.template dimension<Dimension>())
+    , _inner_size(detail::ViewSizeHelper<Dimension, DimensionTuple>::inner(data))
+{
+}
+
+template<typename DataT, typename Dimension>
+View<DataT, Dimension>::~View()
+{
+}
+
+template<typename DataT, typename Dimension>
+auto View<DataT, Dimension>::operator[](DimensionIndex<Dimension> index)
+    -> decltype(std::declval<StorageRef>()[index])
+{
+    return _data[(*_mapper)(index)];
+}
+
+template<typename DataT, typename Dimension>
+auto View<DataT, Dimension>::operator[](DimensionIndex<Dimension> index) const
+    -> decltype(std::declval<ConstStorageRef>()[index])
 {
+    return static_cast<ConstStorageRef>(_data)[(*_mapper)(index)];
 }
 
-View::~View()
+template<typename DataT, typename Dimension>
+template<typename Dim>
+typename std::enable_if<!std::is_same<Dim, Dimension>::value
+                       , View<typename std::remove_reference<decltype(std::declval<typename View<DataT, Dimension>::StorageRef>()[DimensionIndex<Dim>(0)])>::type, Dimension>>::type
+View<DataT, Dimension>::operator[](DimensionIndex<Dim> index)
 {
+    auto slice = _data[index];
+    return View<decltype(slice), Dimension>(slice, _mapper);
 }
 
-typename View::Iterator View::begin()
+template<typename DataT, typename Dimension>
+template<typename Dim>
+typename std::enable_if<!std::is_same<Dim, Dimension>::value
+                       , View<typename std::remove_reference<decltype(std::declval<typename View<DataT, Dimension>::ConstStorageRef>()[DimensionIndex<Dim>(0)])>::type, Dimension>>::type
+View<DataT, Dimension>::operator[](DimensionIndex<Dim> index) const
 {
-    return Iterator();
+    auto slice = static_cast<ConstStorageRef>(_data)[index];
+    return View<decltype(slice), Dimension>(slice, _mapper);
 }
 
-typename View::ConstIterator View::begin() const
+template<typename DataT, typename Dimension>
+template<typename Dim>
+typename std::enable_if<std::is_same<Dim, Dimension>::value, DimensionSize<Dim>>::type
+View<DataT, Dimension>::dimension() const
 {
-    return ConstIterator();
+    return _mapper->size();
 }
 
-typename View::ConstIterator View::cbegin() const
+template<typename DataT, typename Dimension>
+template<typename Dim>
+typename std::enable_if<!std::is_same<Dim, Dimension>::value, DimensionSize<Dim>>::type
+View<DataT, Dimension>::dimension() const
 {
-    return ConstIterator();
+    return static_cast<ConstStorageRef>(_data).template dimension<Dim>();
+}
+
+template<typename DataT, typename Dimension>
+std::size_t View<DataT, Dimension>::data_size() const
+{
+    return _outer_size * static_cast<std::size_t>(_mapper->size()) * _inner_size;
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::MapperType const& View<DataT, Dimension>::mapper() const
+{
+    return *_mapper;
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::iterator View<DataT, Dimension>::begin()
+{
+    return iterator(_data.begin(), _mapper, _outer_size, _source_size, _inner_size, false);
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::iterator View<DataT, Dimension>::end()
+{
+    return iterator(_data.begin(), _mapper, _outer_size, _source_size, _inner_size, true);
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::const_iterator View<DataT, Dimension>::begin() const
+{
+    return cbegin();
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::const_iterator View<DataT, Dimension>::end() const
+{
+    return cend();
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::const_iterator View<DataT, Dimension>::cbegin() const
+{
+    return const_iterator(static_cast<ConstStorageRef>(_data).begin(), _mapper, _outer_size, _source_size, _inner_size, false);
+}
+
+template<typename DataT, typename Dimension>
+typename View<DataT, Dimension>::const_iterator View<DataT, Dimension>::cend() const
+{
+    return const_iterator(static_cast<ConstStorageRef>(_data).begin(), _mapper, _outer_size, _source_size, _inner_size, true);
+}
+
+template<typename DataT, typename Dimension>
+template<typename OutT>
+void View<DataT, Dimension>::materialise(OutT& out) const
+{
+    static_assert(std::is_same<typename OutT::DimensionTuple, DimensionTuple>::value, "View::materialise: the output must have the same dimensions as the View");
+    if(out.data_size() != data_size()
+       || static_cast<std::size_t>(out.template dimension<Dimension>()) != static_cast<std::size_t>(_mapper->size()))
+    {
+        throw std::invalid_argument("View::materialise: output size does not match the View");
+    }
+
+    std::size_t const size = _mapper->size();
+    std::size_t const inner = _inner_size;
+    auto const src = static_cast<ConstStorageRef>(_data).begin();
+    auto const dst = out.begin();
+    for(std::size_t outer = 0; outer < _outer_size; ++outer) {
+        std::size_t const src_offset = outer * _source_size;
+        std::size_t const dst_offset = outer * size;
+        for(auto const& run : _mapper->runs()) {
+            auto dst_it = dst + (dst_offset + run.start) * inner;
+            if(!run.reversed) {
+                // consecutive source indexes: the whole run is a single block
+                detail::view_copy(src + (src_offset + run.source_start) * inner, run.length * inner, dst_it, false);
+            }
+            else if(inner == 1) {
+                detail::view_copy(src + (src_offset + run.source_start + 1 - run.length), run.length, dst_it, true);
+            }
+            else {
+                for(std::size_t i = 0; i < run.length; ++i) {
+                    detail::view_copy(src + (src_offset + run.source_start - i) * inner, inner, dst_it + i * inner, false);
+                }
+            }
+        }
+    }
 }
 
-typename View::Iterator View::end()
+template<typename DataT, typename Dimension>
+template<typename OutT, typename... Dims>
+OutT View<DataT, Dimension>::construct(std::tuple<Dims...> const*) const
 {
-    return Iterator();
+    return OutT(NoInitialisation(), dimension<Dims>()...);
 }
 
-typename View::ConstIterator View::end() const
+template<typename DataT, typename Dimension>
+template<typename OutT>
+OutT View<DataT, Dimension>::materialise() const
 {
-    return ConstIterator();
+    OutT out(construct<OutT>(static_cast<typename OutT::DimensionTuple const*>(nullptr)));
+    materialise(out);
+    return out;
 }
 
-typename View::ConstIterator View::cend() const
+template<typename DataT, typename Dimension>
+typename std::enable_if<std::is_lvalue_reference<DataT>::value || is_slice<typename std::decay<DataT>::type>::value
+                       , View<typename std::remove_reference<DataT>::type, Dimension>>::type
+make_view(DataT&& data, IndexMapper<Dimension> const& mapper)
 {
-    return ConstIterator();
+    return View<typename std::remove_reference<DataT>::type, Dimension>(data, mapper);
 }
 
+} // namespace multiarray
 } // namespace astrotypes
 } // namespace pss
@@ -1,18 +1,18 @@
 /*
  * MIT License
- * 
+ *
  * Copyright (c) 2018 PulsarSearchSoft
- * 
+ *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
  * in the Software without restriction, including without limitation the rights
  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
  * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
- * 
+ *
  * The above copyright notice and this permission notice shall be included in all
  * copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -21,20 +21,83 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "astrotypes/multiarray/ViewIterator.h"
-
 
 namespace pss {
 namespace astrotypes {
 namespace multiarray {
 
+template<typename BaseIteratorT, typename Dimension>
+ViewIterator<BaseIteratorT, Dimension>::ViewIterator(BaseIteratorT base, std::shared_ptr<IndexMapper<Dimension> const> const& mapper
+                                                    , std::size_t outer_size, std::size_t source_size, std::size_t inner_size, bool end)
+    : _base(base)
+    , _current(base)
+    , _mapper(mapper)
+    , _outer_size(outer_size)
+    , _source_size(source_size)
+    , _inner_size(inner_size)
+    , _size(mapper->size())
+    , _outer(outer_size)
+    , _index(0)
+    , _inner(0)
+{
+    if(!end && _size != 0 && _inner_size != 0 && _outer_size != 0) {
+        _outer = 0;
+        reposition();
+    }
+}
+
+template<typename BaseIteratorT, typename Dimension>
+inline void ViewIterator<BaseIteratorT, Dimension>::reposition()
+{
+    _current = _base + static_cast<difference_type>((_outer * _source_size + (*_mapper)(_index)) * _inner_size);
+}
+
+template<typename BaseIteratorT, typename Dimension>
+inline typename ViewIterator<BaseIteratorT, Dimension>::reference ViewIterator<BaseIteratorT, Dimension>::operator*() const
+{
+    return *_current;
+}
+
+template<typename BaseIteratorT, typename Dimension>
+inline typename ViewIterator<BaseIteratorT, Dimension>::pointer ViewIterator<BaseIteratorT, Dimension>::operator->() const
+{
+    return &*_current;
+}
+
+template<typename BaseIteratorT, typename Dimension>
+inline ViewIterator<BaseIteratorT, Dimension>& ViewIterator<BaseIteratorT, Dimension>::operator++()
+{
+    if(++_inner < _inner_size) {
+        ++_current;
+        return *this;
+    }
+    _inner = 0;
+    if(++_index == _size) {
+        _index = 0;
+        if(++_outer == _outer_size) return *this; // end
+    }
+    reposition();
+    return *this;
+}
+
+template<typename BaseIteratorT, typename Dimension>
+ViewIterator<BaseIteratorT, Dimension> ViewIterator<BaseIteratorT, Dimension>::operator++(int)
+{
+    ViewIterator copy(*this);
+    ++*this;
+    return copy;
+}
 
-ViewIterator::ViewIterator()
+template<typename BaseIteratorT, typename Dimension>
+inline bool ViewIterator<BaseIteratorT, Dimension>::operator==(ViewIterator const& o) const
 {
+    return _outer == o._outer && _index == o._index && _inner == o._inner;
 }
 
-ViewIterator::~ViewIterator()
+template<typename BaseIteratorT, typename Dimension>
+inline bool ViewIterator<BaseIteratorT, Dimension>::operator!=(ViewIterator const& o) const
 {
+    return !(*this == o);
 }
 
 } // namespace multiarray
@@ -73,7 +73,7 @@ class TestMultiArray : public MultiArray<std::allocator<T>, T, TestMultiArrayMix
 
 // this must be declared in the astrotypes namespace
 template<typename Dimension, typename T, typename... Dimensions>
-struct has_dimension<multiarray::test::TestMultiArray<T, Dimensions...>, Dimension> : public list_has_type<Dimension, Dimensions...>::type
+struct has_dimension<multiarray::test::TestMultiArray<T, Dimensions...>, Dimension> : public list_has_type<Dimension, DimensionTag<Dimensions>...>::type
 {
 };
 
@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../AlgorithmsTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/Algorithms.h"
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <stdexcept>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+AlgorithmsTest::AlgorithmsTest()
+    : ::testing::Test()
+{
+}
+
+AlgorithmsTest::~AlgorithmsTest()
+{
+}
+
+void AlgorithmsTest::SetUp()
+{
+}
+
+void AlgorithmsTest::TearDown()
+{
+}
+
+TEST_F(AlgorithmsTest, test_copy)
+{
+    TestMultiArray<int, DimensionA, DimensionB> src(DimensionSize<DimensionA>(29), DimensionSize<DimensionB>(13));
+    std::iota(src.begin(), src.end(), 0);
+
+    // whole array, different element types
+    TestMultiArray<double, DimensionA, DimensionB> dst(DimensionSize<DimensionA>(29), DimensionSize<DimensionB>(13));
+    bulk_copy(src, dst);
+    ASSERT_TRUE(std::equal(src.begin(), src.end(), dst.begin()));
+
+    // slice to slice where the contiguous runs differ on each side
+    TestMultiArray<int, DimensionA, DimensionB> target(DimensionSize<DimensionA>(20), DimensionSize<DimensionB>(10));
+    std::fill(target.begin(), target.end(), -1);
+    auto const src_slice = src.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(4), DimensionSize<DimensionA>(10))
+                                   , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(7)));
+    bulk_copy(src_slice, target.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(3), DimensionSize<DimensionA>(10))
+                                    , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(7))));
+    for(std::size_t a = 0; a < 20; ++a) {
+        for(std::size_t b = 0; b < 10; ++b) {
+            bool const in_slice = a >= 3 && a < 13 && b >= 2 && b < 9;
+            int const expected = in_slice ? src[DimensionIndex<DimensionA>(a + 1)][DimensionIndex<DimensionB>(b - 1)] : -1;
+            ASSERT_EQ(expected, (target[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)])) << a << ", " << b;
+        }
+    }
+
+    // sizes must match
+    ASSERT_THROW(bulk_copy(src, target), std::invalid_argument);
+}
+
+TEST_F(AlgorithmsTest, test_copy_streaming)
+{
+    // large enough to use non-temporal stores, with a misaligned destination run
+    std::size_t const rows = streaming_store_bytes / 1000 + 1;
+    TestMultiArray<uint8_t, DimensionA, DimensionB> src(DimensionSize<DimensionA>(rows), DimensionSize<DimensionB>(1000));
+    uint8_t n = 0;
+    std::generate(src.begin(), src.end(), [&]() { return n++; });
+    TestMultiArray<uint8_t, DimensionA, DimensionB> dst(DimensionSize<DimensionA>(rows), DimensionSize<DimensionB>(1001));
+    auto dst_slice = dst.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(1000)));
+    bulk_copy(src, dst_slice);
+    ASSERT_TRUE(bulk_equal(src, dst_slice));
+    ASSERT_TRUE(std::equal(src.cbegin(), src.cend(), dst_slice.cbegin()));
+}
+
+TEST_F(AlgorithmsTest, test_fill)
+{
+    TestMultiArray<uint16_t, DimensionA, DimensionB> data(DimensionSize<DimensionA>(17), DimensionSize<DimensionB>(9));
+    std::fill(data.begin(), data.end(), 0);
+    bulk_fill(data.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(5))), 7);
+    for(std::size_t a = 0; a < 17; ++a) {
+        for(std::size_t b = 0; b < 9; ++b) {
+            uint16_t const expected = (b >= 2 && b < 7) ? 7 : 0;
+            ASSERT_EQ(expected, (data[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)])) << a << ", " << b;
+        }
+    }
+
+    // single byte and streaming paths
+    TestMultiArray<uint8_t, DimensionA, DimensionB> bytes(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5));
+    bulk_fill(bytes, 200);
+    ASSERT_TRUE(std::all_of(bytes.begin(), bytes.end(), [](uint8_t v) { return v == 200; }));
+
+    TestMultiArray<float, DimensionA, DimensionB> large(DimensionSize<DimensionA>(streaming_store_bytes / 4000 + 1), DimensionSize<DimensionB>(1001));
+    bulk_fill(large.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(1000))), 1.5f);
+    for(std::size_t a = 0; a < large.dimension<DimensionA>(); ++a) {
+        auto const row = large[DimensionIndex<DimensionA>(a)];
+        ASSERT_TRUE(std::all_of(row.begin() + 1, row.end(), [](float v) { return v == 1.5f; })) << a;
+    }
+}
+
+TEST_F(AlgorithmsTest, test_equal)
+{
+    TestMultiArray<int, DimensionA, DimensionB> a(DimensionSize<DimensionA>(8), DimensionSize<DimensionB>(6));
+    std::iota(a.begin(), a.end(), 0);
+    TestMultiArray<int, DimensionA, DimensionB> b(DimensionSize<DimensionA>(8), DimensionSize<DimensionB>(7));
+    std::fill(b.begin(), b.end(), 0);
+    auto b_slice = b.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(6)));
+    bulk_copy(a, b_slice);
+    ASSERT_TRUE(bulk_equal(a, b_slice));
+    ASSERT_TRUE(bulk_equal(b_slice, a));
+
+    b[DimensionIndex<DimensionA>(7)][DimensionIndex<DimensionB>(6)] = 0;
+    ASSERT_FALSE(bulk_equal(a, b_slice));
+    ASSERT_FALSE(bulk_equal(a, b));
+
+    // floating point values are compared by value, not representation
+    TestMultiArray<float, DimensionA, DimensionB> zero(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(2));
+    TestMultiArray<float, DimensionA, DimensionB> negative_zero(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(2));
+    std::fill(zero.begin(), zero.end(), 0.0f);
+    std::fill(negative_zero.begin(), negative_zero.end(), -0.0f);
+    ASSERT_TRUE(bulk_equal(zero, negative_zero));
+}
+
+TEST_F(AlgorithmsTest, test_equal_slices)
+{
+    // both sides are sliced so the runs are matched up with the iterator of the second
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> a(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(6));
+    std::iota(a.begin(), a.end(), 0);
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> b(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(6), DimensionSize<DimensionC>(4));
+    std::fill(b.begin(), b.end(), -1);
+    auto const a_slice = a.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(3))
+                               , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(2), DimensionSize<DimensionC>(4)));
+    auto b_slice = b.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(4))
+                         , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(1), DimensionSize<DimensionC>(3)));
+    ASSERT_EQ(a_slice.data_size(), b_slice.data_size());
+    bulk_copy(a_slice, b_slice);
+    ASSERT_TRUE(std::equal(a_slice.begin(), a_slice.end(), b_slice.begin()));
+    ASSERT_TRUE(bulk_equal(a_slice, b_slice));
+    ASSERT_TRUE(bulk_equal(b_slice, a_slice));
+
+    *(b_slice.end() - 1) = 0;
+    ASSERT_FALSE(bulk_equal(a_slice, b_slice));
+    ASSERT_FALSE(bulk_equal(b_slice, a_slice));
+}
+
+TEST_F(AlgorithmsTest, test_run_pair_stops_early)
+{
+    TestMultiArray<int, DimensionA, DimensionB> a(DimensionSize<DimensionA>(8), DimensionSize<DimensionB>(6));
+    TestMultiArray<int, DimensionA, DimensionB> b(DimensionSize<DimensionA>(8), DimensionSize<DimensionB>(7));
+    auto const b_slice = b.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(6)));
+
+    unsigned calls = 0;
+    ASSERT_FALSE(detail::for_each_run_pair(a, b_slice, [&](int*, int const*, std::size_t) { ++calls; return false; }));
+    ASSERT_EQ(1U, calls);
+
+    calls = 0;
+    ASSERT_TRUE(detail::for_each_run_pair(a, b_slice, [&](int*, int const*, std::size_t n) { ++calls; return n == 6; }));
+    ASSERT_EQ(8U, calls);
+
+    // both contiguous
+    TestMultiArray<int, DimensionA, DimensionB> const c(DimensionSize<DimensionA>(8), DimensionSize<DimensionB>(6));
+    calls = 0;
+    ASSERT_TRUE(detail::for_each_run_pair(a, c, [&](int*, int const*, std::size_t n) { ++calls; return n == 48; }));
+    ASSERT_EQ(1U, calls);
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
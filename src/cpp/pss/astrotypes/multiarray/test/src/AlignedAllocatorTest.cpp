@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../AlignedAllocatorTest.h"
+#include "pss/astrotypes/multiarray/AlignedAllocator.h"
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include "../TestMultiArray.h"
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+AlignedAllocatorTest::AlignedAllocatorTest()
+    : ::testing::Test()
+{
+}
+
+AlignedAllocatorTest::~AlignedAllocatorTest()
+{
+}
+
+void AlignedAllocatorTest::SetUp()
+{
+}
+
+void AlignedAllocatorTest::TearDown()
+{
+}
+
+TEST_F(AlignedAllocatorTest, test_std_vector_alignment)
+{
+    for(std::size_t size = 1; size < 100; size += 7) {
+        std::vector<uint8_t, AlignedAllocator<uint8_t>> data(size);
+        ASSERT_EQ(0U, reinterpret_cast<std::size_t>(data.data()) % 64);
+    }
+    std::vector<float, AlignedAllocator<float, 4096>> page_aligned(10);
+    ASSERT_EQ(0U, reinterpret_cast<std::size_t>(page_aligned.data()) % 4096);
+}
+
+TEST_F(AlignedAllocatorTest, test_multiarray)
+{
+    typedef AlignedAllocator<uint16_t> AllocatorType;
+    multiarray::MultiArray<AllocatorType, uint16_t, multiarray::test::TestMultiArrayMixin, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5));
+    ASSERT_EQ(0U, reinterpret_cast<std::size_t>(&*ma.begin()) % AllocatorType::alignment);
+    ASSERT_EQ(15U, static_cast<std::size_t>(std::distance(ma.begin(), ma.end())));
+}
+
+TEST_F(AlignedAllocatorTest, test_rebind)
+{
+    typedef std::allocator_traits<AlignedAllocator<uint8_t, 128>>::rebind_alloc<double> ReboundType;
+    static_assert(std::is_same<ReboundType, AlignedAllocator<double, 128>>::value, "unexpected rebind type");
+    ASSERT_TRUE(AlignedAllocator<uint8_t>() == AlignedAllocator<double>());
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ArrayRefTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/ArrayRef.h"
+#include <thread>
+#include <type_traits>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ArrayRefTest::ArrayRefTest()
+    : ::testing::Test()
+{
+}
+
+ArrayRefTest::~ArrayRefTest()
+{
+}
+
+void ArrayRefTest::SetUp()
+{
+}
+
+void ArrayRefTest::TearDown()
+{
+}
+
+TEST_F(ArrayRefTest, test_trivially_copyable)
+{
+    static_assert(std::is_trivially_copyable<ArrayRef<int, DimensionA, DimensionB>>::value, "ArrayRef must be trivially copyable");
+    static_assert(std::is_trivially_copyable<ArrayRef<const float, DimensionA>>::value, "ArrayRef must be trivially copyable");
+    ArrayRef<int, DimensionA, DimensionB> ref;
+    ASSERT_EQ(nullptr, ref.data());
+    ASSERT_EQ(0U, ref.data_size());
+}
+
+TEST_F(ArrayRefTest, test_multiarray)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(5));
+    auto ref = make_array_ref(ma);
+    static_assert(std::is_same<decltype(ref), ArrayRef<int, DimensionA, DimensionB, DimensionC>>::value, "unexpected type");
+    ASSERT_EQ(&*ma.begin(), ref.data());
+    ASSERT_EQ(DimensionSize<DimensionA>(3), ref.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionC>(5), ref.dimension<DimensionC>());
+    ASSERT_EQ(20U, ref.stride<DimensionA>());
+    ASSERT_EQ(5U, ref.strides()[1]);
+    ASSERT_EQ(1U, ref.strides()[2]);
+    ASSERT_EQ(4U, ref.extents()[1]);
+    ASSERT_EQ(ma.data_size(), ref.data_size());
+    ASSERT_TRUE(ref.is_contiguous());
+
+    for(DimensionIndex<DimensionA> a(0); a < 3; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 4; ++b) {
+            for(DimensionIndex<DimensionC> c(0); c < 5; ++c) {
+                ASSERT_EQ(&ma[a][b][c], &ref(a, b, c));
+                ASSERT_EQ(&ma[a][b][c], &ref(c, b, a));
+            }
+        }
+    }
+
+    // writes go through to the data, and copies refer to the same data
+    auto copy = ref;
+    copy(DimensionIndex<DimensionA>(2), DimensionIndex<DimensionB>(1), DimensionIndex<DimensionC>(3)) = -1;
+    ASSERT_EQ(-1, (ma[DimensionIndex<DimensionA>(2)][DimensionIndex<DimensionB>(1)][DimensionIndex<DimensionC>(3)]));
+
+    // const
+    auto const& const_ma = ma;
+    auto const_ref = make_array_ref(const_ma);
+    static_assert(std::is_same<decltype(const_ref), ArrayRef<const int, DimensionA, DimensionB, DimensionC>>::value, "unexpected type");
+    ArrayRef<const int, DimensionA, DimensionB, DimensionC> converted(ref);
+    ASSERT_EQ(const_ref.data(), converted.data());
+}
+
+TEST_F(ArrayRefTest, test_slice)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(6), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(5));
+    auto slice = ma.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(3))
+                        , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(2), DimensionSize<DimensionC>(2)));
+    auto ref = make_array_ref(slice);
+    ASSERT_EQ(&*slice.begin(), ref.data());
+    ASSERT_EQ(DimensionSize<DimensionA>(3), ref.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(4), ref.dimension<DimensionB>());
+    ASSERT_EQ(DimensionSize<DimensionC>(2), ref.dimension<DimensionC>());
+    ASSERT_EQ(20U, ref.stride<DimensionA>());
+    ASSERT_EQ(5U, ref.stride<DimensionB>());
+    ASSERT_EQ(1U, ref.stride<DimensionC>());
+    ASSERT_FALSE(ref.is_contiguous());
+    ASSERT_EQ(slice.data_size(), ref.data_size());
+    for(DimensionIndex<DimensionA> a(0); a < 3; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 4; ++b) {
+            for(DimensionIndex<DimensionC> c(0); c < 2; ++c) {
+                ASSERT_EQ(&slice[a][b][c], &ref(a, b, c));
+            }
+        }
+    }
+
+    // reduced slice (a single value of DimensionA)
+    auto reduced = ma[DimensionIndex<DimensionA>(4)];
+    auto reduced_ref = make_array_ref(reduced);
+    static_assert(std::is_same<decltype(reduced_ref), ArrayRef<int, DimensionB, DimensionC>>::value, "unexpected type");
+    ASSERT_EQ(5U, reduced_ref.stride<DimensionB>());
+    ASSERT_TRUE(reduced_ref.is_contiguous());
+    ASSERT_EQ((&ma[DimensionIndex<DimensionA>(4)][DimensionIndex<DimensionB>(3)][DimensionIndex<DimensionC>(1)])
+             , &reduced_ref(DimensionIndex<DimensionB>(3), DimensionIndex<DimensionC>(1)));
+}
+
+TEST_F(ArrayRefTest, test_pass_to_thread)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    auto ref = make_array_ref(ma.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(3))));
+    std::thread thread([ref]() {
+        // a plain strided loop as a C kernel would use
+        for(std::size_t a = 0; a < ref.extents()[0]; ++a) {
+            for(std::size_t b = 0; b < ref.extents()[1]; ++b) {
+                ref.data()[a * ref.strides()[0] + b * ref.strides()[1]] = -1;
+            }
+        }
+    });
+    thread.join();
+    for(DimensionIndex<DimensionA> a(0); a < 10; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 7; ++b) {
+            bool const in_slice = b >= 2 && b < 5;
+            ASSERT_EQ(in_slice, ma[a][b] == -1) << a << ", " << b;
+        }
+    }
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
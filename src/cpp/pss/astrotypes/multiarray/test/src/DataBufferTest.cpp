@@ -23,6 +23,7 @@
  */
 #include "pss/astrotypes/multiarray/test/DataBufferTest.h"
 #include "pss/astrotypes/multiarray/DataBuffer.h"
+#include <algorithm>
 #include <numeric>
 
 namespace pss {
@@ -330,6 +331,48 @@ TEST_F(DataBufferTest, test_reserve)
     ASSERT_EQ(buffer.size(), 10U);
 }
 
+TEST_F(DataBufferTest, test_resize_within_capacity)
+{
+    DataBuffer<int> buffer(10);
+    int const* data = buffer.data();
+    buffer.resize(2);
+    buffer.resize(8);
+    ASSERT_EQ(buffer.size(), 8U);
+    ASSERT_EQ(buffer.capacity(), 10U);
+    ASSERT_EQ(data, buffer.data());
+
+    buffer.reserve(20);
+    data = buffer.data();
+    buffer.resize(20);
+    ASSERT_EQ(data, buffer.data());
+}
+
+TEST_F(DataBufferTest, test_empty_resize_with_value)
+{
+    DataBuffer<int> buffer;
+    ASSERT_TRUE(buffer.empty());
+    buffer.resize(5, 7);
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_EQ(buffer.size(), 5U);
+    for(std::size_t i=0; i < buffer.size(); ++i) {
+        ASSERT_EQ(buffer[i], 7) << "i=" << i;
+    }
+}
+
+TEST_F(DataBufferTest, test_const_copy_construct)
+{
+    DataBuffer<int> buffer(10, 3);
+    DataBuffer<int> const& const_buffer = buffer;
+    DataBuffer<int> copy(const_buffer);
+    ASSERT_EQ(copy.size(), 10U);
+    ASSERT_NE(copy.data(), buffer.data());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), copy.begin()));
+
+    DataBuffer<int> moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 10U);
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), moved.begin()));
+}
+
 } // namespace test
 } // namespace multiarray
 } // namespace astrotypes
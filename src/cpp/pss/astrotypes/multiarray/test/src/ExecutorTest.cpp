@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ExecutorTest.h"
+#include "pss/astrotypes/multiarray/Executor.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ExecutorTest::ExecutorTest()
+    : ::testing::Test()
+{
+}
+
+ExecutorTest::~ExecutorTest()
+{
+}
+
+void ExecutorTest::SetUp()
+{
+}
+
+void ExecutorTest::TearDown()
+{
+}
+
+TEST_F(ExecutorTest, test_serial_executor)
+{
+    SerialExecutor executor;
+    ASSERT_EQ(1U, executor.concurrency());
+    std::vector<std::size_t> order;
+    executor.parallel_for(5, [&](std::size_t task) { order.push_back(task); });
+    ASSERT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), order);
+}
+
+TEST_F(ExecutorTest, test_thread_pool_runs_each_task_once)
+{
+    ThreadPoolExecutor executor(4);
+    ASSERT_EQ(4U, executor.concurrency());
+    for(std::size_t number_of_tasks : { 0U, 1U, 3U, 100U }) {
+        std::vector<std::atomic<unsigned>> counts(number_of_tasks);
+        for(auto& count : counts) count = 0;
+        // repeat to exercise reuse of the pool between calls
+        for(unsigned repeat = 0; repeat < 10; ++repeat) {
+            executor.parallel_for(number_of_tasks, [&](std::size_t task) { ++counts[task]; });
+        }
+        for(auto const& count : counts) {
+            ASSERT_EQ(10U, count);
+        }
+    }
+}
+
+TEST_F(ExecutorTest, test_thread_pool_exception)
+{
+    ThreadPoolExecutor executor(3);
+    std::atomic<unsigned> count(0);
+    ASSERT_THROW(executor.parallel_for(20, [&](std::size_t task)
+                                       {
+                                           ++count;
+                                           if(task == 7) throw std::runtime_error("task failed");
+                                       })
+                , std::runtime_error);
+    // all other tasks still run
+    ASSERT_EQ(20U, count);
+
+    // the pool is still usable
+    count = 0;
+    executor.parallel_for(20, [&](std::size_t) { ++count; });
+    ASSERT_EQ(20U, count);
+}
+
+TEST_F(ExecutorTest, test_thread_pool_nested_call)
+{
+    // a task calling parallel_for on its own executor must not deadlock
+    ThreadPoolExecutor executor(4);
+    std::vector<std::atomic<unsigned>> counts(8 * 8);
+    for(auto& count : counts) count = 0;
+    executor.parallel_for(8, [&](std::size_t outer)
+                          {
+                              executor.parallel_for(8, [&](std::size_t inner) { ++counts[outer * 8 + inner]; });
+                          });
+    for(auto const& count : counts) {
+        ASSERT_EQ(1U, count);
+    }
+
+    // nested through a second executor and back again
+    ThreadPoolExecutor other(2);
+    std::atomic<unsigned> count(0);
+    executor.parallel_for(4, [&](std::size_t)
+                          {
+                              other.parallel_for(4, [&](std::size_t)
+                                                 {
+                                                     executor.parallel_for(4, [&](std::size_t) { ++count; });
+                                                 });
+                          });
+    ASSERT_EQ(64U, count);
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ExpressionTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/Expression.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ExpressionTest::ExpressionTest()
+    : ::testing::Test()
+{
+}
+
+ExpressionTest::~ExpressionTest()
+{
+}
+
+void ExpressionTest::SetUp()
+{
+}
+
+void ExpressionTest::TearDown()
+{
+}
+
+TEST_F(ExpressionTest, test_same_dimensions)
+{
+    TestMultiArray<int, DimensionA, DimensionB> a(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(7));
+    TestMultiArray<int, DimensionA, DimensionB> b(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(7));
+    TestMultiArray<int, DimensionA, DimensionB> result(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(7));
+    std::iota(a.begin(), a.end(), 0);
+    std::iota(b.begin(), b.end(), 100);
+
+    assign(result, (a + b) * 2 - a / 2);
+    auto it_a = a.cbegin();
+    auto it_b = b.cbegin();
+    for(auto const& value : result) {
+        ASSERT_EQ((*it_a + *it_b) * 2 - *it_a / 2, value);
+        ++it_a;
+        ++it_b;
+    }
+
+    assign(result, -a);
+    it_a = a.cbegin();
+    for(auto const& value : result) {
+        ASSERT_EQ(-*it_a, value);
+        ++it_a;
+    }
+
+    // plain scalar assignment
+    assign(result, 3);
+    for(auto const& value : result) {
+        ASSERT_EQ(3, value);
+    }
+}
+
+TEST_F(ExpressionTest, test_broadcast)
+{
+    TestMultiArray<float, DimensionA, DimensionB> data(DimensionSize<DimensionA>(4), DimensionSize<DimensionB>(6));
+    TestMultiArray<float, DimensionB> offset(DimensionSize<DimensionB>(6));
+    TestMultiArray<float, DimensionA> scale(DimensionSize<DimensionA>(4));
+    std::iota(data.begin(), data.end(), 0.0f);
+    std::iota(offset.begin(), offset.end(), 10.0f);
+    std::iota(scale.begin(), scale.end(), 1.0f);
+
+    // offset is broadcast along DimensionA, scale along DimensionB
+    assign(data, (data - offset) * scale);
+    for(std::size_t a = 0; a < 4; ++a) {
+        for(std::size_t b = 0; b < 6; ++b) {
+            float const expected = (static_cast<float>(a * 6 + b) - static_cast<float>(10 + b)) * static_cast<float>(a + 1);
+            ASSERT_FLOAT_EQ(expected, data[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)]);
+        }
+    }
+
+    // the outer product of two 1D arrays
+    assign(data, scale * offset);
+    for(std::size_t a = 0; a < 4; ++a) {
+        for(std::size_t b = 0; b < 6; ++b) {
+            ASSERT_FLOAT_EQ(static_cast<float>((a + 1) * (10 + b)), data[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)]);
+        }
+    }
+}
+
+TEST_F(ExpressionTest, test_dimension_order)
+{
+    TestMultiArray<int, DimensionA, DimensionB> a(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5));
+    TestMultiArray<int, DimensionB, DimensionA> result(DimensionSize<DimensionB>(5), DimensionSize<DimensionA>(3));
+    std::iota(a.begin(), a.end(), 0);
+
+    // operands are matched by dimension, not position
+    assign(result, a + 1);
+    for(std::size_t i = 0; i < 3; ++i) {
+        for(std::size_t j = 0; j < 5; ++j) {
+            ASSERT_EQ(a[DimensionIndex<DimensionA>(i)][DimensionIndex<DimensionB>(j)] + 1
+                     , result[DimensionIndex<DimensionB>(j)][DimensionIndex<DimensionA>(i)]);
+        }
+    }
+}
+
+TEST_F(ExpressionTest, test_slice_operands)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> data(DimensionSize<DimensionA>(6), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(3));
+    std::iota(data.begin(), data.end(), 0);
+
+    // every other DimensionA index from 1, DimensionB [1, 3)
+    auto const slice = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(3), 2)
+                                , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(2)));
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> result(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(2), DimensionSize<DimensionC>(3));
+    assign(result, slice * 10);
+
+    for(std::size_t a = 0; a < 3; ++a) {
+        for(std::size_t b = 0; b < 2; ++b) {
+            for(std::size_t c = 0; c < 3; ++c) {
+                int const expected = static_cast<int>(((2 * a + 1) * 4 + (b + 1)) * 3 + c) * 10;
+                ASSERT_EQ(expected, result[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)][DimensionIndex<DimensionC>(c)]);
+            }
+        }
+    }
+
+    // assign into a slice
+    assign(data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(0), DimensionSize<DimensionA>(3))
+                     , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(2))), -result);
+    auto const target = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(0), DimensionSize<DimensionA>(3))
+                                 , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(2)));
+    auto it = result.cbegin();
+    for(auto const& value : target) {
+        ASSERT_EQ(-*it, value);
+        ++it;
+    }
+}
+
+TEST_F(ExpressionTest, test_size_mismatch)
+{
+    TestMultiArray<int, DimensionA, DimensionB> data(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5));
+    TestMultiArray<int, DimensionB> row(DimensionSize<DimensionB>(4));
+    ASSERT_THROW(assign(data, data + row), std::invalid_argument);
+}
+
+TEST_F(ExpressionTest, test_parallel_assign)
+{
+    ThreadPoolExecutor executor(4);
+    TestMultiArray<double, DimensionA, DimensionB> data(DimensionSize<DimensionA>(53), DimensionSize<DimensionB>(17));
+    TestMultiArray<double, DimensionB> offset(DimensionSize<DimensionB>(17));
+    std::iota(data.begin(), data.end(), 0.0);
+    std::iota(offset.begin(), offset.end(), 1.0);
+
+    TestMultiArray<double, DimensionA, DimensionB> serial(DimensionSize<DimensionA>(53), DimensionSize<DimensionB>(17));
+    TestMultiArray<double, DimensionA, DimensionB> parallel(DimensionSize<DimensionA>(53), DimensionSize<DimensionB>(17));
+    assign(serial, data / offset + 0.5);
+    parallel_assign(executor, parallel, data / offset + 0.5);
+    ASSERT_TRUE(std::equal(serial.cbegin(), serial.cend(), parallel.cbegin()));
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
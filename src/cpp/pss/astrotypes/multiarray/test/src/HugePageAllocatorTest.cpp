@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../HugePageAllocatorTest.h"
+#include "pss/astrotypes/multiarray/HugePageAllocator.h"
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include "../TestMultiArray.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+HugePageAllocatorTest::HugePageAllocatorTest()
+    : ::testing::Test()
+{
+}
+
+HugePageAllocatorTest::~HugePageAllocatorTest()
+{
+}
+
+void HugePageAllocatorTest::SetUp()
+{
+}
+
+void HugePageAllocatorTest::TearDown()
+{
+}
+
+TEST_F(HugePageAllocatorTest, test_small_allocation)
+{
+    // below the huge page threshold we expect a plain aligned heap allocation
+    std::vector<int, HugePageAllocator<int>> data(100, 3);
+    ASSERT_EQ(0U, reinterpret_cast<std::size_t>(data.data()) % 64);
+    ASSERT_EQ(300, std::accumulate(data.begin(), data.end(), 0));
+}
+
+TEST_F(HugePageAllocatorTest, test_large_allocation)
+{
+    typedef HugePageAllocator<uint8_t> AllocatorType;
+    std::size_t const size = 3 * AllocatorType::huge_page_size + 17;
+    for(auto policy : { HugePagePolicy::Transparent, HugePagePolicy::HugeTlb }) {
+        AllocatorType allocator(policy);
+        multiarray::MultiArray<AllocatorType, uint8_t, multiarray::test::TestMultiArrayMixin, DimensionA, DimensionB> ma(allocator, DimensionSize<DimensionA>(size), DimensionSize<DimensionB>(1));
+        ASSERT_EQ(0U, reinterpret_cast<std::size_t>(&*ma.begin()) % AllocatorType::huge_page_size);
+        std::fill(ma.begin(), ma.end(), 1);
+        ASSERT_EQ(size, static_cast<std::size_t>(std::count(ma.begin(), ma.end(), 1)));
+    }
+}
+
+TEST_F(HugePageAllocatorTest, test_numa_node)
+{
+    // binding to node 0 must always be possible (or silently ignored)
+    typedef HugePageAllocator<float> AllocatorType;
+    AllocatorType allocator(HugePagePolicy::Transparent, 0);
+    std::vector<float, AllocatorType> data(AllocatorType::huge_page_size, 1.0f, allocator);
+    ASSERT_EQ(AllocatorType::huge_page_size, static_cast<std::size_t>(std::count(data.begin(), data.end(), 1.0f)));
+    ASSERT_EQ(0, data.get_allocator().numa_node());
+}
+
+TEST_F(HugePageAllocatorTest, test_equality)
+{
+    HugePageAllocator<int> a;
+    HugePageAllocator<double> b(a);
+    ASSERT_TRUE(a == b);
+    ASSERT_FALSE(a == HugePageAllocator<int>(HugePagePolicy::HugeTlb));
+    ASSERT_TRUE(a != HugePageAllocator<int>(HugePagePolicy::Transparent, 1));
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
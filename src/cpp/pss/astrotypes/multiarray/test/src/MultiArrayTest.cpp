@@ -24,7 +24,10 @@
 #include "../MultiArrayTest.h"
 #include "../TestMultiArray.h"
 #include "pss/astrotypes/multiarray/MultiArray.h"
+#include "pss/astrotypes/multiarray/PointerAllocator.h"
 #include <algorithm>
+#include <stdexcept>
+#include <numeric>
 
 
 namespace pss {
@@ -782,6 +785,235 @@ TEST_F(MultiArrayTest, test_has_exact_dimensions)
     static_assert(std::is_same<typename has_exact_dimensions<TestType2d, DimensionA, DimensionB>::type, std::true_type>::value, "expecting true");
 }
 
+TEST_F(MultiArrayTest, test_allocator_instance_constructor)
+{
+    // the allocator instance passed should be used for the storage
+    std::vector<int> memory(6 * 4, 0);
+    PointerAllocator<int> allocator(memory.data());
+    MultiArray<PointerAllocator<int>, int, TestMultiArrayMixin, DimensionA, DimensionB> ma(allocator, DimensionSize<DimensionA>(6), DimensionSize<DimensionB>(4));
+    ASSERT_EQ(6U, ma.dimension<DimensionA>());
+    ASSERT_EQ(4U, ma.dimension<DimensionB>());
+    ASSERT_EQ(memory.data(), &*ma.begin());
+
+    int n = 0;
+    std::generate(ma.begin(), ma.end(), [&]() { return ++n; });
+    for(std::size_t i = 0; i < memory.size(); ++i) {
+        ASSERT_EQ(static_cast<int>(i + 1), memory[i]);
+    }
+}
+
+TEST_F(MultiArrayTest, test_for_each_contiguous_run)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(5));
+    unsigned calls = 0;
+    ma.for_each_contiguous_run([&](int* begin, int* end)
+                               {
+                                   ++calls;
+                                   ASSERT_EQ(&*ma.begin(), begin);
+                                   ASSERT_EQ(60, end - begin);
+                                   for(int* it = begin; it != end; ++it) *it += 1;
+                               });
+    ASSERT_EQ(1U, calls);
+
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> const& const_ma = ma;
+    int n = 0;
+    const_ma.for_each_contiguous_run([&](int const* begin, int const* end)
+                                     {
+                                         for(int const* it = begin; it != end; ++it) ASSERT_EQ(++n, *it);
+                                     });
+    ASSERT_EQ(60, n);
+
+    // no calls for an empty array
+    TestMultiArray<int, DimensionA, DimensionB> empty(DimensionSize<DimensionA>(0), DimensionSize<DimensionB>(4));
+    calls = 0;
+    empty.for_each_contiguous_run([&](int*, int*) { ++calls; });
+    ASSERT_EQ(0U, calls);
+}
+
+TEST_F(MultiArrayTest, test_two_dimension_reserve)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4));
+    ma.reserve(DimensionSize<DimensionA>(10));
+    ASSERT_LE(10U, static_cast<std::size_t>(ma.capacity<DimensionA>()));
+    ASSERT_EQ(DimensionSize<DimensionA>(3), ma.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(4), ma.dimension<DimensionB>());
+    for(int i = 0; i < 12; ++i) ASSERT_EQ(i, *(ma.begin() + i));
+
+    // growing and shrinking within the capacity does not reallocate
+    int const* const data = &*ma.begin();
+    ma.resize(DimensionSize<DimensionA>(10));
+    ma.resize(DimensionSize<DimensionA>(1));
+    ma.resize(DimensionSize<DimensionA>(7));
+    ASSERT_EQ(data, &*ma.begin());
+    ASSERT_LE(10U, static_cast<std::size_t>(ma.capacity<DimensionA>()));
+
+    // reserve for a different inner dimension
+    ma.reserve(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(100));
+    ASSERT_LE(50U, static_cast<std::size_t>(ma.capacity<DimensionA>()));
+}
+
+TEST_F(MultiArrayTest, test_two_dimension_append)
+{
+    TestMultiArray<int, DimensionA, DimensionB> block(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4));
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(0), DimensionSize<DimensionB>(0));
+
+    // an empty array takes its inner dimensions from the data
+    ma.append(block);
+    ASSERT_EQ(DimensionSize<DimensionA>(3), ma.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(4), ma.dimension<DimensionB>());
+    ASSERT_TRUE(ma == block);
+
+    // append single rows
+    std::size_t reallocations = 0;
+    int const* data = &*ma.begin();
+    for(std::size_t i = 0; i < 100; ++i) {
+        ma.append(block[DimensionIndex<DimensionA>(i % 3)]);
+        if(data != &*ma.begin()) {
+            ++reallocations;
+            data = &*ma.begin();
+        }
+    }
+    ASSERT_EQ(DimensionSize<DimensionA>(103), ma.dimension<DimensionA>());
+    ASSERT_GE(8U, reallocations); // amortised doubling
+    for(std::size_t i = 0; i < 103; ++i) {
+        auto const row = ma[DimensionIndex<DimensionA>(i)];
+        auto const expected = block[DimensionIndex<DimensionA>(i % 3)];
+        ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), row.cbegin())) << i;
+    }
+
+    // append a slice
+    ma.append(block.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2))));
+    ASSERT_EQ(DimensionSize<DimensionA>(105), ma.dimension<DimensionA>());
+    ASSERT_EQ(4, *(ma.begin() + 103 * 4));
+    ASSERT_EQ(11, *(ma.end() - 1));
+
+    // mismatched inner dimension
+    TestMultiArray<int, DimensionA, DimensionB> other(DimensionSize<DimensionA>(1), DimensionSize<DimensionB>(5));
+    ASSERT_THROW(ma.append(other), std::invalid_argument);
+}
+
+TEST_F(MultiArrayTest, test_append_view_of_self)
+{
+    // no spare capacity so the append has to reallocate while the data is still being read
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4));
+    ASSERT_EQ(DimensionSize<DimensionA>(3), ma.capacity<DimensionA>());
+    ma.append(ma.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2))));
+    ASSERT_EQ(DimensionSize<DimensionA>(5), ma.dimension<DimensionA>());
+    for(int i = 0; i < 12; ++i) ASSERT_EQ(i, *(ma.begin() + i));
+    for(int i = 0; i < 8; ++i) ASSERT_EQ(4 + i, *(ma.begin() + 12 + i)) << i;
+
+    // a single row
+    ma.append(ma[DimensionIndex<DimensionA>(0)]);
+    ASSERT_EQ(DimensionSize<DimensionA>(6), ma.dimension<DimensionA>());
+    for(int i = 0; i < 4; ++i) ASSERT_EQ(i, *(ma.begin() + 20 + i)) << i;
+
+    TestMultiArray<int, DimensionA> ma_1d(DimensionSize<DimensionA>(5));
+    ASSERT_EQ(DimensionSize<DimensionA>(5), ma_1d.capacity<DimensionA>());
+    ma_1d.append(ma_1d);
+    ASSERT_EQ(DimensionSize<DimensionA>(10), ma_1d.dimension<DimensionA>());
+    for(int i = 0; i < 10; ++i) ASSERT_EQ(i % 5, *(ma_1d.begin() + i));
+}
+
+TEST_F(MultiArrayTest, test_append_transposed)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(3));
+    TestMultiArray<int, DimensionB, DimensionA> transposed(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(3));
+    ma.append(transposed);
+    ASSERT_EQ(DimensionSize<DimensionA>(4), ma.dimension<DimensionA>());
+    for(DimensionIndex<DimensionA> a(0); a < 2; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 3; ++b) {
+            ASSERT_EQ(transposed[b][a], ma[a + 2][b]);
+        }
+    }
+}
+
+TEST_F(MultiArrayTest, test_one_dimension_append)
+{
+    TestMultiArray<int, DimensionA> block(DimensionSize<DimensionA>(5));
+    TestMultiArray<int, DimensionA> ma(DimensionSize<DimensionA>(0));
+    ma.reserve(DimensionSize<DimensionA>(8));
+    ASSERT_LE(8U, static_cast<std::size_t>(ma.capacity<DimensionA>()));
+    ma.append(block);
+    ma.append(block);
+    ASSERT_EQ(DimensionSize<DimensionA>(10), ma.dimension<DimensionA>());
+    for(int i = 0; i < 10; ++i) ASSERT_EQ(i % 5, *(ma.begin() + i));
+}
+
+TEST_F(MultiArrayTest, test_resize_value_initialises_reused_storage)
+{
+    // storage is kept when shrinking so any stale data must be reset when growing again
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(4), DimensionSize<DimensionB>(3));
+    std::fill(ma.begin(), ma.end(), 99);
+    ma.resize(DimensionSize<DimensionA>(1));
+    ma.resize(DimensionSize<DimensionA>(4));
+    ASSERT_TRUE(std::all_of(ma.begin(), ma.begin() + 3, [](int v) { return v == 99; }));
+    ASSERT_TRUE(std::all_of(ma.begin() + 3, ma.end(), [](int v) { return v == 0; }));
+}
+
+TEST_F(MultiArrayTest, test_no_initialisation)
+{
+    typedef MultiArray<std::allocator<int>, int, TestMultiArrayMixin, DimensionA, DimensionB> ArrayType;
+    ArrayType ma(NoInitialisation(), DimensionSize<DimensionB>(3), DimensionSize<DimensionA>(4));
+    ASSERT_EQ(DimensionSize<DimensionA>(4), ma.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(3), ma.dimension<DimensionB>());
+    ASSERT_EQ(12U, ma.data_size());
+    std::fill(ma.begin(), ma.end(), 5);
+
+    // existing data is kept
+    ma.resize(NoInitialisation(), DimensionSize<DimensionA>(10));
+    ASSERT_EQ(DimensionSize<DimensionA>(10), ma.dimension<DimensionA>());
+    ASSERT_EQ(30U, ma.data_size());
+    ASSERT_TRUE(std::all_of(ma.begin(), ma.begin() + 12, [](int v) { return v == 5; }));
+
+    ma.resize(NoInitialisation(), DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(5));
+    ASSERT_EQ(DimensionSize<DimensionA>(2), ma.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(5), ma.dimension<DimensionB>());
+    ASSERT_EQ(10U, ma.data_size());
+
+    MultiArray<std::allocator<int>, int, TestMultiArrayMixin, DimensionA> one(NoInitialisation(), std::allocator<int>(), DimensionSize<DimensionA>(7));
+    ASSERT_EQ(7U, one.data_size());
+}
+
+TEST_F(MultiArrayTest, test_direct_element_access)
+{
+    // TestMultiArray is filled with a sequence 0, 1, 2, ...
+    TestMultiArray<unsigned, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(4), DimensionSize<DimensionB>(5), DimensionSize<DimensionC>(6));
+    auto const& const_ma = ma;
+    for(DimensionIndex<DimensionA> a(0); a < 4; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 5; ++b) {
+            for(DimensionIndex<DimensionC> c(0); c < 6; ++c) {
+                unsigned const expected = ma[a][b][c];
+                ASSERT_EQ(expected, ma(a, b, c));
+                // order independent
+                ASSERT_EQ(expected, ma(c, a, b));
+                ASSERT_EQ(expected, const_ma(b, c, a));
+                ASSERT_EQ(expected, const_ma.at(a, b, c));
+            }
+        }
+    }
+
+    ma(DimensionIndex<DimensionB>(2), DimensionIndex<DimensionA>(1), DimensionIndex<DimensionC>(3)) = 1000;
+    ASSERT_EQ(1000U, (ma[DimensionIndex<DimensionA>(1)][DimensionIndex<DimensionB>(2)][DimensionIndex<DimensionC>(3)]));
+
+    // bounds checking
+    ASSERT_THROW(ma.at(DimensionIndex<DimensionA>(4), DimensionIndex<DimensionB>(0), DimensionIndex<DimensionC>(0)), std::out_of_range);
+    ASSERT_THROW(ma.at(DimensionIndex<DimensionA>(0), DimensionIndex<DimensionB>(5), DimensionIndex<DimensionC>(0)), std::out_of_range);
+    ASSERT_THROW(const_ma.at(DimensionIndex<DimensionA>(0), DimensionIndex<DimensionB>(0), DimensionIndex<DimensionC>(6)), std::out_of_range);
+
+    // strides follow a resize
+    ma.resize(DimensionSize<DimensionC>(3), DimensionSize<DimensionA>(2));
+    std::iota(ma.begin(), ma.end(), 0U);
+    ASSERT_EQ(15U * 2, ma.data_size() );
+    ASSERT_EQ(3U * 5 + 2 * 3 + 1, ma(DimensionIndex<DimensionA>(1), DimensionIndex<DimensionB>(2), DimensionIndex<DimensionC>(1)));
+    ASSERT_THROW(ma.at(DimensionIndex<DimensionA>(1), DimensionIndex<DimensionB>(2), DimensionIndex<DimensionC>(3)), std::out_of_range);
+
+    // single dimension
+    TestMultiArray<unsigned, DimensionA> ma_1d(DimensionSize<DimensionA>(10));
+    ASSERT_EQ(7U, ma_1d(DimensionIndex<DimensionA>(7)));
+    ASSERT_EQ(7U, ma_1d.at(DimensionIndex<DimensionA>(7)));
+    ASSERT_THROW(ma_1d.at(DimensionIndex<DimensionA>(10)), std::out_of_range);
+}
+
 } // namespace test
 } // namespace multiarray
 } // namespace astrotypes
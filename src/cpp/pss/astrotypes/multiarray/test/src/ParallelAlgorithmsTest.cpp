@@ -0,0 +1,236 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ParallelAlgorithmsTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/ParallelAlgorithms.h"
+#include "pss/astrotypes/multiarray/SliceRange.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ParallelAlgorithmsTest::ParallelAlgorithmsTest()
+    : ::testing::Test()
+{
+}
+
+ParallelAlgorithmsTest::~ParallelAlgorithmsTest()
+{
+}
+
+void ParallelAlgorithmsTest::SetUp()
+{
+}
+
+void ParallelAlgorithmsTest::TearDown()
+{
+}
+
+TEST_F(ParallelAlgorithmsTest, test_partition)
+{
+    auto const spans = partition(DimensionSize<DimensionA>(10), 4);
+    ASSERT_EQ(4U, spans.size());
+    std::size_t next = 0;
+    for(auto const& span : spans) {
+        ASSERT_EQ(next, static_cast<std::size_t>(span.start()));
+        ASSERT_GE(static_cast<std::size_t>(span.span()), 2U);
+        next += static_cast<std::size_t>(span.span());
+    }
+    ASSERT_EQ(10U, next);
+
+    // never more partitions than elements
+    ASSERT_EQ(3U, partition(DimensionSize<DimensionA>(3), 64).size());
+}
+
+TEST_F(ParallelAlgorithmsTest, test_fill)
+{
+    ThreadPoolExecutor executor(4);
+    TestMultiArray<int, DimensionA, DimensionB> data(DimensionSize<DimensionA>(37), DimensionSize<DimensionB>(11));
+    parallel_fill(executor, data, 7);
+    for(auto const& value : data) {
+        ASSERT_EQ(7, value);
+    }
+
+    // fill a slice leaving the rest untouched
+    auto slice = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(3), DimensionSize<DimensionA>(20))
+                          , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(5)));
+    parallel_fill(executor, slice, 1);
+    ASSERT_EQ(100, std::count(data.begin(), data.end(), 1));
+    ASSERT_EQ(37 * 11 - 100, std::count(data.begin(), data.end(), 7));
+    for(auto const& value : slice) {
+        ASSERT_EQ(1, value);
+    }
+}
+
+TEST_F(ParallelAlgorithmsTest, test_copy_and_transform)
+{
+    ThreadPoolExecutor executor(3);
+    TestMultiArray<int, DimensionA, DimensionB> src(DimensionSize<DimensionA>(29), DimensionSize<DimensionB>(13));
+    std::iota(src.begin(), src.end(), 0);
+
+    TestMultiArray<double, DimensionA, DimensionB> dst(DimensionSize<DimensionA>(29), DimensionSize<DimensionB>(13));
+    parallel_copy(executor, src, dst);
+    ASSERT_TRUE(std::equal(src.begin(), src.end(), dst.begin()));
+
+    parallel_transform(executor, src, dst, [](int v) { return 2.0 * v; });
+    auto it = dst.begin();
+    for(auto const& value : src) {
+        ASSERT_DOUBLE_EQ(2.0 * value, *it++);
+    }
+
+    // a slice into a full array (different contiguous runs on each side)
+    auto const slice = src.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(4), DimensionSize<DimensionA>(10))
+                               , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(7)));
+    TestMultiArray<int, DimensionA, DimensionB> sliced(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    parallel_copy(executor, slice, sliced);
+    ASSERT_TRUE(std::equal(slice.begin(), slice.end(), sliced.begin()));
+
+    // sizes must match
+    ASSERT_THROW(parallel_copy(executor, src, sliced), std::invalid_argument);
+}
+
+TEST_F(ParallelAlgorithmsTest, test_for_each_slice_range)
+{
+    ThreadPoolExecutor executor(3);
+    TestMultiArray<int, DimensionA, DimensionB> data(DimensionSize<DimensionA>(29), DimensionSize<DimensionB>(7));
+
+    // each channel visited exactly once
+    parallel_for_each(executor, make_slice_range<DimensionB>(data), [](TestMultiArray<int, DimensionA, DimensionB>::OperatorSliceType<DimensionB>::type& slice)
+                      {
+                          std::transform(slice.begin(), slice.end(), slice.begin(), [](int v) { return 2 * v; });
+                      });
+    int n = 0;
+    for(auto const& value : data) {
+        ASSERT_EQ(2 * n++, value);
+    }
+
+    // fewer slices than tasks
+    TestMultiArray<int, DimensionA, DimensionB> small(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(3));
+    std::vector<int> first(2, -1);
+    parallel_for_each(executor, make_slice_range<DimensionA>(small), [&](TestMultiArray<int, DimensionA, DimensionB>::OperatorSliceType<DimensionA>::type const& slice)
+                      {
+                          first[*slice.begin() / 3] = *slice.begin();
+                      });
+    ASSERT_EQ(0, first[0]);
+    ASSERT_EQ(3, first[1]);
+}
+
+TEST_F(ParallelAlgorithmsTest, test_reduce_deterministic)
+{
+    TestMultiArray<float, DimensionA, DimensionB> data(DimensionSize<DimensionA>(517), DimensionSize<DimensionB>(33));
+    unsigned n = 0;
+    // values with a wide dynamic range so the result is sensitive to the order of summation
+    std::generate(data.begin(), data.end(), [&]() { ++n; return (n % 7 == 0) ? 1.0e6f + n : 1.0f / n; });
+
+    SerialExecutor serial;
+    float const expected = parallel_reduce(serial, data, 0.0f, std::plus<float>());
+    for(std::size_t threads : { 1U, 2U, 3U, 8U }) {
+        ThreadPoolExecutor executor(threads);
+        ASSERT_EQ(expected, parallel_reduce(executor, data, 0.0f, std::plus<float>())) << threads;
+    }
+
+    // compare against a double precision sum
+    double const sum = std::accumulate(data.begin(), data.end(), 0.0);
+    ASSERT_NEAR(sum, expected, sum * 1e-6);
+
+    // operators with no identity element
+    ASSERT_EQ(*std::max_element(data.begin(), data.end())
+            , parallel_reduce(serial, data, -1.0f, [](float a, float b) { return std::max(a, b); }));
+}
+
+TEST_F(ParallelAlgorithmsTest, test_reduce_by_dimension)
+{
+    ThreadPoolExecutor executor(4);
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> data(DimensionSize<DimensionA>(70)
+                                                                , DimensionSize<DimensionB>(5)
+                                                                , DimensionSize<DimensionC>(3));
+    std::iota(data.begin(), data.end(), 0);
+
+    std::vector<int> expected_a(70, 1);
+    std::vector<int> expected_b(5, 1);
+    std::vector<int> expected_c(3, 1);
+    unsigned n = 0;
+    for(int a = 0; a < 70; ++a) {
+        for(int b = 0; b < 5; ++b) {
+            for(int c = 0; c < 3; ++c) {
+                expected_a[a] += n;
+                expected_b[b] += n;
+                expected_c[c] += n;
+                ++n;
+            }
+        }
+    }
+    ASSERT_EQ(expected_a, parallel_reduce_by<DimensionA>(executor, data, 1, std::plus<int>()));
+    ASSERT_EQ(expected_b, parallel_reduce_by<DimensionB>(executor, data, 1, std::plus<int>()));
+    ASSERT_EQ(expected_c, parallel_reduce_by<DimensionC>(executor, data, 1, std::plus<int>()));
+
+    // reduction over a slice
+    auto const slice = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(10), DimensionSize<DimensionA>(2))
+                                , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(2))
+                                , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(1), DimensionSize<DimensionC>(2)));
+    std::vector<int> expected_slice_c(2, 0);
+    unsigned i = 0;
+    for(auto const& value : slice) {
+        expected_slice_c[i++ % 2] += value;
+    }
+    ASSERT_EQ(expected_slice_c, parallel_reduce_by<DimensionC>(executor, slice, 0, std::plus<int>()));
+}
+
+TEST_F(ParallelAlgorithmsTest, test_transpose)
+{
+    ThreadPoolExecutor executor(4);
+    for(std::size_t size_a : { 1U, 3U, 67U }) {
+        DimensionSize<DimensionA> a(size_a);
+        DimensionSize<DimensionB> b(131);
+        DimensionSize<DimensionC> c(5);
+        TestMultiArray<int, DimensionA, DimensionB, DimensionC> abc(a, b, c);
+        std::iota(abc.begin(), abc.end(), 0);
+
+        TestMultiArray<int, DimensionC, DimensionA, DimensionB> expected(c, a, b);
+        TestMultiArray<int, DimensionC, DimensionA, DimensionB> cab(c, a, b);
+        transpose(expected, abc);
+        parallel_transpose(executor, cab, abc);
+        ASSERT_TRUE(expected == cab) << size_a;
+
+        // partitioning the source contiguous dimension
+        TestMultiArray<int, DimensionC, DimensionB, DimensionA> expected_cba(c, b, a);
+        TestMultiArray<int, DimensionC, DimensionB, DimensionA> cba(c, b, a);
+        transpose(expected_cba, abc);
+        parallel_transpose(executor, cba, abc);
+        ASSERT_TRUE(expected_cba == cba) << size_a;
+    }
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
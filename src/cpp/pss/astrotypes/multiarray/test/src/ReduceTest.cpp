@@ -0,0 +1,271 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ReduceTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/Reduce.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ReduceTest::ReduceTest()
+    : ::testing::Test()
+{
+}
+
+ReduceTest::~ReduceTest()
+{
+}
+
+void ReduceTest::SetUp()
+{
+}
+
+void ReduceTest::TearDown()
+{
+}
+
+TEST_F(ReduceTest, test_reduce_rank_2)
+{
+    // sizes chosen to cross the kernels' tile and lane boundaries
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(37), DimensionSize<DimensionB>(1100));
+
+    auto sum_a = reduce<DimensionA>(ma);
+    static_assert(std::is_same<decltype(sum_a), ReducedArray<int64_t, DimensionB>>::value, "unexpected type");
+    ASSERT_EQ(DimensionSize<DimensionB>(1100), sum_a.dimension<DimensionB>());
+    for(DimensionIndex<DimensionB> b(0); b < 1100; ++b) {
+        int expected = 0;
+        for(DimensionIndex<DimensionA> a(0); a < 37; ++a) expected += ma[a][b];
+        ASSERT_EQ(expected, sum_a[b]) << b;
+    }
+
+    auto sum_b = reduce<DimensionB>(ma);
+    static_assert(std::is_same<decltype(sum_b), ReducedArray<int64_t, DimensionA>>::value, "unexpected type");
+    ASSERT_EQ(DimensionSize<DimensionA>(37), sum_b.dimension<DimensionA>());
+    for(DimensionIndex<DimensionA> a(0); a < 37; ++a) {
+        int expected = 0;
+        for(DimensionIndex<DimensionB> b(0); b < 1100; ++b) expected += ma[a][b];
+        ASSERT_EQ(expected, sum_b[a]) << a;
+    }
+}
+
+TEST_F(ReduceTest, test_reduce_rank_3)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5), DimensionSize<DimensionC>(7));
+
+    auto sum_a = reduce<DimensionA>(ma);
+    static_assert(std::is_same<decltype(sum_a), ReducedArray<int64_t, DimensionB, DimensionC>>::value, "unexpected type");
+    auto sum_b = reduce<DimensionB>(ma);
+    static_assert(std::is_same<decltype(sum_b), ReducedArray<int64_t, DimensionA, DimensionC>>::value, "unexpected type");
+    auto sum_c = reduce<DimensionC>(ma);
+    static_assert(std::is_same<decltype(sum_c), ReducedArray<int64_t, DimensionA, DimensionB>>::value, "unexpected type");
+
+    for(DimensionIndex<DimensionB> b(0); b < 5; ++b) {
+        for(DimensionIndex<DimensionC> c(0); c < 7; ++c) {
+            int expected = 0;
+            for(DimensionIndex<DimensionA> a(0); a < 3; ++a) expected += ma[a][b][c];
+            ASSERT_EQ(expected, sum_a[b][c]);
+        }
+    }
+    for(DimensionIndex<DimensionA> a(0); a < 3; ++a) {
+        for(DimensionIndex<DimensionC> c(0); c < 7; ++c) {
+            int expected = 0;
+            for(DimensionIndex<DimensionB> b(0); b < 5; ++b) expected += ma[a][b][c];
+            ASSERT_EQ(expected, sum_b[a][c]);
+        }
+        for(DimensionIndex<DimensionB> b(0); b < 5; ++b) {
+            int expected = 0;
+            for(DimensionIndex<DimensionC> c(0); c < 7; ++c) expected += ma[a][b][c];
+            ASSERT_EQ(expected, sum_c[a][b]);
+        }
+    }
+}
+
+TEST_F(ReduceTest, test_reduce_slice)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(4), DimensionSize<DimensionB>(6), DimensionSize<DimensionC>(40));
+    auto slice = ma.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2))
+                         , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(3))
+                         , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(3), DimensionSize<DimensionC>(33)));
+
+    auto sum_b = reduce<DimensionB>(slice);
+    ASSERT_EQ(DimensionSize<DimensionA>(2), sum_b.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionC>(33), sum_b.dimension<DimensionC>());
+    auto sum_c = reduce<DimensionC>(slice);
+    for(DimensionIndex<DimensionA> a(0); a < 2; ++a) {
+        for(DimensionIndex<DimensionC> c(0); c < 33; ++c) {
+            int expected = 0;
+            for(DimensionIndex<DimensionB> b(0); b < 3; ++b) expected += slice[a][b][c];
+            ASSERT_EQ(expected, sum_b[a][c]);
+        }
+        for(DimensionIndex<DimensionB> b(0); b < 3; ++b) {
+            int expected = 0;
+            for(DimensionIndex<DimensionC> c(0); c < 33; ++c) expected += slice[a][b][c];
+            ASSERT_EQ(expected, sum_c[a][b]);
+        }
+    }
+}
+
+TEST_F(ReduceTest, test_widening_accumulator)
+{
+    static_assert(std::is_same<ReduceAccumulator<uint8_t>::type, uint32_t>::value, "unexpected accumulator");
+    static_assert(std::is_same<ReduceAccumulator<int16_t>::type, int32_t>::value, "unexpected accumulator");
+    static_assert(std::is_same<ReduceAccumulator<uint32_t>::type, uint64_t>::value, "unexpected accumulator");
+    static_assert(std::is_same<ReduceAccumulator<float>::type, float>::value, "unexpected accumulator");
+
+    TestMultiArray<uint8_t, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(300), DimensionSize<DimensionB>(300));
+    std::fill(ma.begin(), ma.end(), 255);
+
+    auto sum_a = reduce<DimensionA>(ma);
+    static_assert(std::is_same<decltype(sum_a), ReducedArray<uint32_t, DimensionB>>::value, "unexpected type");
+    auto sum_b = reduce<DimensionB>(ma);
+    for(auto const& v : sum_a) ASSERT_EQ(255U * 300U, v);
+    for(auto const& v : sum_b) ASSERT_EQ(255U * 300U, v);
+
+    // explicit accumulator type
+    auto sum_double = reduce<DimensionB, double>(ma);
+    static_assert(std::is_same<decltype(sum_double), ReducedArray<double, DimensionA>>::value, "unexpected type");
+    for(auto const& v : sum_double) ASSERT_DOUBLE_EQ(255.0 * 300.0, v);
+}
+
+TEST_F(ReduceTest, test_kahan_sum)
+{
+    // 2^24 + 1 is not representable as a float: a plain sum of ones onto 2^24 loses every one of them
+    std::size_t const n = 4097;
+    TestMultiArray<float, DimensionA, DimensionB> ma(DimensionSize<DimensionA>{n}, DimensionSize<DimensionB>{n});
+    std::fill(ma.begin(), ma.end(), 1.0f);
+    ma[DimensionIndex<DimensionA>(0)][DimensionIndex<DimensionB>(0)] = 16777216.0f;
+
+    float const expected = 16777216.0f + (n - 1);
+    auto sum_a = reduce<DimensionA>(ma);
+    ASSERT_EQ(16777216.0f, sum_a[DimensionIndex<DimensionB>(0)]);
+
+    auto kahan_a = reduce<DimensionA>(ma, reduction::KahanSum());
+    auto kahan_b = reduce<DimensionB>(ma, reduction::KahanSum());
+    ASSERT_EQ(expected, kahan_a[DimensionIndex<DimensionB>(0)]);
+    ASSERT_EQ(expected, kahan_b[DimensionIndex<DimensionA>(0)]);
+    for(DimensionIndex<DimensionA> a(1); a < n; ++a) {
+        ASSERT_EQ(float(n), kahan_b[a]);
+    }
+    for(DimensionIndex<DimensionB> b(1); b < n; ++b) {
+        ASSERT_EQ(float(n), kahan_a[b]);
+    }
+}
+
+TEST_F(ReduceTest, test_pairwise_sum)
+{
+    std::size_t const n = 1 << 20;
+    double const expected = n * double(0.1f);
+    TestMultiArray<float, DimensionA, DimensionB> ma(DimensionSize<DimensionA>{n}, DimensionSize<DimensionB>(2));
+    std::fill(ma.begin(), ma.end(), 0.1f);
+    TestMultiArray<float, DimensionB, DimensionA> transposed(DimensionSize<DimensionB>(2), DimensionSize<DimensionA>{n});
+    std::fill(transposed.begin(), transposed.end(), 0.1f);
+
+    auto sum = reduce<DimensionA>(ma);
+    ASSERT_GT(std::abs(sum[DimensionIndex<DimensionB>(0)] - expected) / expected, 1e-4);
+
+    auto pairwise = reduce<DimensionA>(ma, reduction::PairwiseSum());
+    auto pairwise_transposed = reduce<DimensionA>(transposed, reduction::PairwiseSum());
+    for(DimensionIndex<DimensionB> b(0); b < 2; ++b) {
+        ASSERT_LT(std::abs(pairwise[b] - expected) / expected, 1e-6);
+        ASSERT_LT(std::abs(pairwise_transposed[b] - expected) / expected, 1e-6);
+    }
+}
+
+TEST_F(ReduceTest, test_mean)
+{
+    TestMultiArray<uint16_t, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(4), DimensionSize<DimensionB>(5));
+    auto mean_a = mean<DimensionA>(ma);
+    static_assert(std::is_same<decltype(mean_a), ReducedArray<float, DimensionB>>::value, "unexpected type");
+    auto mean_b = mean<DimensionB, double>(ma);
+    static_assert(std::is_same<decltype(mean_b), ReducedArray<double, DimensionA>>::value, "unexpected type");
+
+    // element (a, b) holds 5a + b
+    for(DimensionIndex<DimensionB> b(0); b < 5; ++b) {
+        ASSERT_FLOAT_EQ(7.5f + b, mean_a[b]);
+    }
+    for(DimensionIndex<DimensionA> a(0); a < 4; ++a) {
+        ASSERT_DOUBLE_EQ(5.0 * a + 2.0, mean_b[a]);
+    }
+}
+
+TEST_F(ReduceTest, test_binary_op)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(37), DimensionSize<DimensionB>(1100));
+    auto const max = [](int64_t a, int64_t b) { return std::max(a, b); };
+
+    auto max_a = reduce<DimensionA>(ma, max);
+    static_assert(std::is_same<decltype(max_a), ReducedArray<int64_t, DimensionB>>::value, "unexpected type");
+    for(DimensionIndex<DimensionB> b(0); b < 1100; ++b) {
+        int expected = ma[DimensionIndex<DimensionA>(0)][b];
+        for(DimensionIndex<DimensionA> a(0); a < 37; ++a) expected = std::max(expected, static_cast<int>(ma[a][b]));
+        ASSERT_EQ(expected, max_a[b]) << b;
+    }
+
+    // the values are combined in the order of the reduced dimension
+    auto const difference = [](double a, double b) { return a - b; };
+    auto difference_b = reduce<DimensionB, double>(ma, difference);
+    static_assert(std::is_same<decltype(difference_b), ReducedArray<double, DimensionA>>::value, "unexpected type");
+    for(DimensionIndex<DimensionA> a(0); a < 37; ++a) {
+        double expected = ma[a][DimensionIndex<DimensionB>(0)];
+        for(DimensionIndex<DimensionB> b(1); b < 1100; ++b) expected -= ma[a][b];
+        ASSERT_DOUBLE_EQ(expected, difference_b[a]) << a;
+    }
+}
+
+TEST_F(ReduceTest, test_reduce_into)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4));
+    TestMultiArray<long, DimensionB> out(DimensionSize<DimensionB>(4));
+    reduce<DimensionA>(ma, out);
+    for(DimensionIndex<DimensionB> b(0); b < 4; ++b) {
+        ASSERT_EQ(12 + 3 * b, out[b]);
+    }
+
+    TestMultiArray<long, DimensionB> wrong_size(DimensionSize<DimensionB>(5));
+    ASSERT_THROW(reduce<DimensionA>(ma, wrong_size), std::invalid_argument);
+}
+
+TEST_F(ReduceTest, test_empty_dimension)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(0), DimensionSize<DimensionB>(4));
+    auto sum_a = reduce<DimensionA>(ma);
+    ASSERT_EQ(DimensionSize<DimensionB>(4), sum_a.dimension<DimensionB>());
+    for(auto const& v : sum_a) ASSERT_EQ(0, v);
+    auto sum_b = reduce<DimensionB>(ma);
+    ASSERT_EQ(0U, sum_b.data_size());
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
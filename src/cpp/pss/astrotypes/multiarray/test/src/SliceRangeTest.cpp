@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../SliceRangeTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/SliceRange.h"
+#include <algorithm>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+SliceRangeTest::SliceRangeTest()
+    : ::testing::Test()
+{
+}
+
+SliceRangeTest::~SliceRangeTest()
+{
+}
+
+void SliceRangeTest::SetUp()
+{
+}
+
+void SliceRangeTest::TearDown()
+{
+}
+
+TEST_F(SliceRangeTest, test_outer_dimension)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(4));
+    auto range = make_slice_range<DimensionA>(ma);
+    ASSERT_EQ(DimensionSize<DimensionA>(5), range.size());
+    ASSERT_FALSE(range.empty());
+    ASSERT_EQ(5, range.end() - range.begin());
+
+    std::size_t index = 0;
+    for(auto const& slice : range) {
+        auto expected = ma[DimensionIndex<DimensionA>(index)];
+        ASSERT_EQ(4U, slice.data_size());
+        ASSERT_TRUE(std::equal(slice.begin(), slice.end(), expected.begin())) << index;
+        ++index;
+    }
+    ASSERT_EQ(5U, index);
+
+    // random access
+    auto it = range.begin();
+    it += 3;
+    ASSERT_EQ(12, *it->begin());
+    --it;
+    ASSERT_EQ(8, *it->begin());
+    it -= 2;
+    ASSERT_TRUE(it == range.begin());
+    ASSERT_EQ(16, *(range.end() - 1)->begin());
+    ASSERT_EQ(4, *range.begin()[1].begin());
+    ASSERT_EQ(8, *range[DimensionIndex<DimensionA>(2)].begin());
+    ASSERT_TRUE(range.begin() < range.end());
+}
+
+TEST_F(SliceRangeTest, test_inner_dimension)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(5), DimensionSize<DimensionB>(4));
+    auto range = make_slice_range<DimensionB>(ma);
+    ASSERT_EQ(DimensionSize<DimensionB>(4), range.size());
+
+    int b = 0;
+    for(auto const& slice : range) {
+        ASSERT_EQ(5U, slice.data_size());
+        int a = 0;
+        for(auto const& value : slice) {
+            ASSERT_EQ(a * 4 + b, value) << a << ", " << b;
+            ++a;
+        }
+        ++b;
+    }
+    ASSERT_EQ(4, b);
+    ASSERT_EQ(1, *(range.begin() + 1)->begin());
+    ASSERT_EQ(3, *(range.end() - 1)->begin());
+}
+
+TEST_F(SliceRangeTest, test_sub_slice)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(6), DimensionSize<DimensionB>(5));
+    auto sub = ma.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(3))
+                      , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(2)));
+
+    std::size_t a = 0;
+    for(auto const& slice : make_slice_range<DimensionA>(sub)) {
+        ASSERT_EQ(2U, slice.data_size());
+        ASSERT_EQ(static_cast<int>((a + 1) * 5 + 2), *slice.begin());
+        ++a;
+    }
+    ASSERT_EQ(3U, a);
+
+    std::size_t b = 0;
+    for(auto const& slice : make_slice_range<DimensionB>(sub)) {
+        ASSERT_EQ(3U, slice.data_size());
+        auto expected = sub[DimensionIndex<DimensionB>(b)];
+        ASSERT_TRUE(std::equal(slice.begin(), slice.end(), expected.begin())) << b;
+        ++b;
+    }
+    ASSERT_EQ(2U, b);
+
+    // slicing a reduced slice of a slice
+    auto channel = sub[DimensionIndex<DimensionB>(1)];
+    auto part = channel.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2)));
+    ASSERT_EQ(13, *part.begin());
+    ASSERT_EQ(18, *(part.begin() + 1));
+}
+
+TEST_F(SliceRangeTest, test_strided_slice)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(4));
+    auto rows = ma.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(4), 2));
+
+    std::size_t a = 0;
+    auto range = make_slice_range<DimensionA>(rows);
+    ASSERT_EQ(DimensionSize<DimensionA>(4), range.size());
+    for(auto const& slice : range) {
+        auto expected = rows[DimensionIndex<DimensionA>(a)];
+        ASSERT_EQ(static_cast<int>((2 * a + 1) * 4), *slice.begin()) << a;
+        ASSERT_TRUE(std::equal(slice.begin(), slice.end(), expected.begin())) << a;
+        ++a;
+    }
+    ASSERT_EQ(4U, a);
+    ASSERT_EQ(28, *(range.begin() + 3)->begin());
+    ASSERT_EQ(20, *range.begin()[2].begin());
+    ASSERT_EQ(12, *(range.end() - 3)->begin());
+}
+
+TEST_F(SliceRangeTest, test_modify_rank_3)
+{
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> ma(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(4), DimensionSize<DimensionC>(5));
+    int n = 0;
+    for(auto& slice : make_slice_range<DimensionA>(ma)) {
+        ASSERT_EQ(20U, slice.data_size());
+        std::fill(slice.begin(), slice.end(), n++);
+    }
+    for(std::size_t i = 0; i < ma.data_size(); ++i) {
+        ASSERT_EQ(static_cast<int>(i / 20), *(ma.begin() + i)) << i;
+    }
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -25,7 +25,11 @@
 #include "pss/astrotypes/multiarray/Slice.h"
 
 #include <vector>
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
 
 
 namespace pss {
@@ -673,9 +677,9 @@ TEST_F(SliceTest, const_test_three_dimensions_slice_iterators)
                     slice.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionIndex<DimensionA>(4)));
 
     auto it = sub_slice.begin();
-    static_assert(std::is_same<std::iterator_traits<decltype(it)>::iterator_category, std::forward_iterator_tag>::value, "expecting a forward iterator");
+    static_assert(std::is_same<std::iterator_traits<decltype(it)>::iterator_category, std::random_access_iterator_tag>::value, "expecting a random access iterator");
     auto it2 = sub_slice.cbegin();
-    static_assert(std::is_same<std::iterator_traits<decltype(it2)>::iterator_category, std::forward_iterator_tag>::value, "expecting a forward iterator");
+    static_assert(std::is_same<std::iterator_traits<decltype(it2)>::iterator_category, std::random_access_iterator_tag>::value, "expecting a random access iterator");
     for(DimensionIndex<DimensionA> i(0); i < sub_slice.size<DimensionA>(); ++i) {
         for(DimensionIndex<DimensionB> j(0); j < sub_slice.size<DimensionB>(); ++j) {
             for(DimensionIndex<DimensionC> k(0); k < sub_slice.size<DimensionC>(); ++k) {
@@ -1146,6 +1150,415 @@ TEST_F(SliceTest, test_is_multi_dimension)
     ASSERT_FALSE(r);
 }
 
+TEST_F(SliceTest, test_single_dimension_for_each_contiguous_run)
+{
+    ParentType<1> p(20);
+    Slice<false, ParentType<1>, TestSliceMixin, DimensionA> slice(p, DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(5), DimensionSize<DimensionA>(10)));
+    unsigned count = 0;
+    slice.for_each_contiguous_run([&](int* begin, int* end)
+                                  {
+                                      ASSERT_EQ(begin, &p._vec[5]);
+                                      ASSERT_EQ(end - begin, 10);
+                                      ++count;
+                                  });
+    ASSERT_EQ(count, 1U);
+}
+
+TEST_F(SliceTest, test_three_dimensions_for_each_contiguous_run)
+{
+    ParentType<3> p(10);
+    Slice<false, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC> slice(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(4))
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(3))
+                                              , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(2), DimensionSize<DimensionC>(5))
+                                              );
+    // each run should be a single span of DimensionC, in iterator order
+    std::vector<int> values;
+    unsigned count = 0;
+    slice.for_each_contiguous_run([&](int* begin, int* end)
+                                  {
+                                      ASSERT_EQ(end - begin, 5);
+                                      values.insert(values.end(), begin, end);
+                                      ++count;
+                                  });
+    ASSERT_EQ(count, 4U * 3U);
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), slice.cbegin()));
+    ASSERT_EQ(values.size(), slice.data_size());
+
+    // const version
+    auto const& const_slice = slice;
+    values.clear();
+    const_slice.for_each_contiguous_run([&](int const* begin, int const* end)
+                                        {
+                                            values.insert(values.end(), begin, end);
+                                        });
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), slice.cbegin()));
+}
+
+TEST_F(SliceTest, test_three_dimensions_for_each_contiguous_run_merged)
+{
+    ParentType<3> p(10);
+    // full inner dimensions - runs should merge into a single block
+    Slice<false, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC> slice(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(3), DimensionSize<DimensionA>(4))
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(0), DimensionSize<DimensionB>(10))
+                                              , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(0), DimensionSize<DimensionC>(10))
+                                              );
+    unsigned count = 0;
+    slice.for_each_contiguous_run([&](int* begin, int* end)
+                                  {
+                                      ASSERT_EQ(begin, &p._vec[300]);
+                                      ASSERT_EQ(end - begin, 400);
+                                      ++count;
+                                  });
+    ASSERT_EQ(count, 1U);
+
+    // full innermost dimension only - runs merge across DimensionC
+    auto sub_slice = slice.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(2)));
+    std::vector<int> values;
+    count = 0;
+    sub_slice.for_each_contiguous_run([&](int* begin, int* end)
+                                  {
+                                      ASSERT_EQ(end - begin, 20);
+                                      values.insert(values.end(), begin, end);
+                                      ++count;
+                                  });
+    ASSERT_EQ(count, 4U);
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), sub_slice.cbegin()));
+}
+
+TEST_F(SliceTest, test_three_dimensions_random_access_iterators)
+{
+    ParentType<3> p(10);
+    Slice<false, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC> slice(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionIndex<DimensionA>(4))
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionIndex<DimensionB>(5))
+                                              , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(3), DimensionIndex<DimensionC>(7))
+    );
+
+    // sequential traversal as the reference
+    std::vector<int> expected;
+    for(auto it = slice.cbegin(); it != slice.cend(); ++it) {
+        expected.push_back(*it);
+    }
+    ASSERT_EQ(slice.data_size(), expected.size());
+    std::ptrdiff_t const size = expected.size();
+    ASSERT_EQ(size, std::distance(slice.begin(), slice.end()));
+
+    auto const begin = slice.begin();
+    auto const end = slice.end();
+    for(std::ptrdiff_t i = 0; i < size; ++i) {
+        auto it = begin + i;
+        ASSERT_EQ(expected[i], *it) << "i=" << i;
+        ASSERT_EQ(expected[i], begin[i]) << "i=" << i;
+        ASSERT_EQ(i, it - begin);
+        ASSERT_EQ(size - i, end - it);
+        ASSERT_TRUE(it == end - (size - i)) << "i=" << i;
+        ASSERT_TRUE(begin <= it);
+        ASSERT_TRUE(it < end);
+        ASSERT_FALSE(it >= end);
+        for(std::ptrdiff_t j = 0; j < size; j += 7) {
+            auto it_j = it + (j - i);
+            ASSERT_EQ(expected[j], *it_j) << "i=" << i << " j=" << j;
+            ASSERT_EQ(j - i, it_j - it);
+            ASSERT_EQ(j < i, it_j < it);
+            ASSERT_EQ(j > i, it_j > it);
+        }
+    }
+    ASSERT_TRUE(begin + size == end);
+
+    // step backwards from the end
+    auto it = slice.end();
+    for(std::ptrdiff_t i = size - 1; i >= 0; --i) {
+        --it;
+        ASSERT_EQ(expected[i], *it) << "i=" << i;
+    }
+    ASSERT_TRUE(it == begin);
+    auto post = it++;
+    ASSERT_TRUE(post == begin);
+    ASSERT_EQ(1, it - post);
+}
+
+TEST_F(SliceTest, test_slice_sort)
+{
+    // random access iterators allow the use of std algorithms such as sort
+    ParentType<2> p(10);
+    auto slice = Slice<false, ParentType<2>, TestSliceMixin, DimensionA, DimensionB>(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionIndex<DimensionA>(5))
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionIndex<DimensionB>(8))
+    );
+    std::vector<int> values(slice.cbegin(), slice.cend());
+    std::vector<int> const original = p._vec;
+    std::sort(slice.begin(), slice.end(), std::greater<int>());
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), slice.cbegin()));
+
+    // data outside the slice is untouched
+    std::vector<bool> in_slice(p._vec.size(), false);
+    for(auto it = slice.begin(); it != slice.end(); ++it) {
+        in_slice[&*it - p._vec.data()] = true;
+    }
+    for(std::size_t i = 0; i < p._vec.size(); ++i) {
+        if(!in_slice[i]) {
+            ASSERT_EQ(original[i], p._vec[i]) << i;
+        }
+    }
+}
+
+TEST_F(SliceTest, test_strided_span)
+{
+    DimensionSpan<DimensionA> span(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(4), 3);
+    ASSERT_EQ(3U, span.stride());
+    ASSERT_EQ(DimensionIndex<DimensionA>(11), span.end());
+    ASSERT_FALSE(span == DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(4)));
+
+    // trim keeps only the indices within bounds (2, 5, 8)
+    span.trim(DimensionSize<DimensionA>(10));
+    ASSERT_EQ(DimensionSize<DimensionA>(3), span.span());
+    ASSERT_EQ(DimensionIndex<DimensionA>(8), span.end());
+
+    span.end(DimensionIndex<DimensionA>(5));
+    ASSERT_EQ(DimensionSize<DimensionA>(2), span.span());
+}
+
+TEST_F(SliceTest, test_zero_stride_span)
+{
+    typedef DimensionSpan<DimensionA> SpanT;
+    ASSERT_THROW(SpanT(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(4), 0), std::invalid_argument);
+
+    SpanT span(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(4), 3);
+    ASSERT_THROW(span.stride(0), std::invalid_argument);
+    ASSERT_EQ(3U, span.stride());
+}
+
+TEST_F(SliceTest, test_three_dimensions_strided_slice)
+{
+    std::size_t const size = 10;
+    ParentType<3> p(size);
+    // a = 0, 2, 4; b = 1, 4, 7; c = 3, 4
+    Slice<false, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC> slice(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(0), DimensionSize<DimensionA>(3), 2)
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(3), 3)
+                                              , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(3), DimensionSize<DimensionC>(2))
+    );
+    std::vector<int> expected;
+    for(int a : { 0, 2, 4 }) {
+        for(int b : { 1, 4, 7 }) {
+            for(int c : { 3, 4 }) {
+                expected.push_back((a * size + b) * size + c);
+            }
+        }
+    }
+    ASSERT_EQ(expected.size(), slice.data_size());
+    ASSERT_EQ(DimensionSize<DimensionB>(3), slice.dimension<DimensionB>());
+    ASSERT_EQ(std::vector<int>(slice.cbegin(), slice.cend()), expected);
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(expected.size()), slice.cend() - slice.cbegin());
+
+    // random access
+    auto const begin = slice.cbegin();
+    for(std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], begin[i]) << i;
+        ASSERT_EQ(static_cast<std::ptrdiff_t>(i), (begin + i) - begin);
+    }
+
+    // runs
+    std::vector<int> runs;
+    slice.for_each_contiguous_run([&](int const* start, int const* end)
+                                  {
+                                      ASSERT_EQ(2, end - start);
+                                      runs.insert(runs.end(), start, end);
+                                  });
+    ASSERT_EQ(expected, runs);
+
+    // reduce on the strided dimension
+    auto reduced = slice[DimensionIndex<DimensionA>(2)];
+    ASSERT_EQ(std::vector<int>(expected.begin() + 12, expected.end()), std::vector<int>(reduced.cbegin(), reduced.cend()));
+    auto row = reduced[DimensionIndex<DimensionB>(1)];
+    ASSERT_EQ((4 * size + 4) * size + 3, row[DimensionIndex<DimensionC>(0)]);
+
+    // write through the slice
+    std::fill(slice.begin(), slice.end(), -1);
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(expected.size()), std::count(p._vec.begin(), p._vec.end(), -1));
+}
+
+TEST_F(SliceTest, test_strided_slice_of_slice)
+{
+    std::size_t const size = 20;
+    ParentType<3> p(size);
+    // b = 0, 2, ... 18
+    auto slice = Slice<true, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC>(p
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(0), DimensionSize<DimensionB>(10), 2)
+    );
+    std::vector<int> runs;
+    slice.for_each_contiguous_run([&](int const* start, int const* end)
+                                  {
+                                      ASSERT_EQ(static_cast<std::ptrdiff_t>(size), end - start);
+                                      runs.insert(runs.end(), start, end);
+                                  });
+    ASSERT_EQ(std::vector<int>(slice.cbegin(), slice.cend()), runs);
+
+    // strides combine: b = 2, 8, 14 and a = 1, 4
+    auto sub_slice = slice.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(3), 3)
+                               , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2), 3)
+                               , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(5), DimensionSize<DimensionC>(1)));
+    std::vector<int> expected;
+    for(int a : { 1, 4 }) {
+        for(int b : { 2, 8, 14 }) {
+            expected.push_back((a * size + b) * size + 5);
+        }
+    }
+    ASSERT_EQ(expected, std::vector<int>(sub_slice.cbegin(), sub_slice.cend()));
+}
+
+TEST_F(SliceTest, test_slice_of_slice_inner_dimensions_only)
+{
+    std::size_t const size = 10;
+    ParentType<3> p(size);
+    // a = 2, 3, 4
+    auto slice = Slice<true, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC>(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(3))
+    );
+
+    // the outer dimension is not resized: b = 1, 2 and c = 3, 4, 5, 6
+    auto sub_slice = slice.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(2))
+                               , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(3), DimensionSize<DimensionC>(4)));
+    std::vector<int> expected;
+    for(int a : { 2, 3, 4 }) {
+        for(int b : { 1, 2 }) {
+            for(int c : { 3, 4, 5, 6 }) {
+                expected.push_back((a * size + b) * size + c);
+            }
+        }
+    }
+    ASSERT_EQ(expected, std::vector<int>(sub_slice.cbegin(), sub_slice.cend()));
+
+    // only the innermost dimension resized
+    auto inner_slice = slice.slice(DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(5), DimensionSize<DimensionC>(1)));
+    ASSERT_EQ(static_cast<int>((2 * size + 0) * size + 5), *inner_slice.cbegin());
+    ASSERT_EQ(static_cast<int>((4 * size + 9) * size + 5), *(inner_slice.cend() - 1));
+
+    // slicing the result again must not count the inner offsets twice: a = 3, b = 1, 2 and c = 4
+    auto sub_sub_slice = sub_slice.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(1))
+                                       , DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(1), DimensionSize<DimensionC>(1)));
+    ASSERT_EQ(std::vector<int>({ 314, 324 }), std::vector<int>(sub_sub_slice.cbegin(), sub_sub_slice.cend()));
+    auto inner_sub_slice = sub_slice.slice(DimensionSpan<DimensionC>(DimensionIndex<DimensionC>(2), DimensionSize<DimensionC>(1)));
+    ASSERT_EQ(std::vector<int>({ 215, 225, 315, 325, 415, 425 }), std::vector<int>(inner_sub_slice.cbegin(), inner_sub_slice.cend()));
+}
+
+// exposes the stepping operators used by SliceRangeIterator
+template<typename SliceT>
+struct SteppableSlice : public SliceT
+{
+    SteppableSlice(SliceT const& s) : SliceT(s) {}
+    using SliceT::operator+=;
+};
+
+TEST_F(SliceTest, test_plus_equal_moves_span)
+{
+    std::size_t const size = 10;
+    ParentType<3> p(size);
+    typedef Slice<true, ParentType<3>, TestSliceMixin, DimensionA, DimensionB, DimensionC> SliceT;
+    SteppableSlice<SliceT> slice(SliceT(p
+                                      , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2))
+                                      , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(2), DimensionSize<DimensionB>(3))
+                                ));
+
+    // outer dimension
+    slice += DimensionSize<DimensionA>(3);
+    ASSERT_EQ(DimensionIndex<DimensionA>(4), slice.span<DimensionA>().start());
+    ASSERT_EQ(DimensionSize<DimensionA>(2), slice.dimension<DimensionA>());
+    ASSERT_EQ(static_cast<int>((4 * size + 2) * size), *slice.cbegin());
+
+    // lower dimension
+    slice += DimensionSize<DimensionB>(1);
+    ASSERT_EQ(DimensionIndex<DimensionA>(4), slice.span<DimensionA>().start());
+    ASSERT_EQ(DimensionIndex<DimensionB>(3), slice.span<DimensionB>().start());
+    ASSERT_EQ(DimensionSize<DimensionB>(3), slice.dimension<DimensionB>());
+    ASSERT_EQ(static_cast<int>((4 * size + 3) * size), *slice.cbegin());
+    ASSERT_EQ(static_cast<int>((5 * size + 5) * size + 9), *(slice.cend() - 1));
+
+    // a slice rebuilt from the spans refers to the same data
+    SliceT rebuilt(p, static_cast<SliceT const&>(slice));
+    ASSERT_EQ(std::vector<int>(slice.cbegin(), slice.cend()), std::vector<int>(rebuilt.cbegin(), rebuilt.cend()));
+}
+
+TEST_F(SliceTest, test_strided_innermost_dimension)
+{
+    std::size_t const size = 10;
+    ParentType<2> p(size);
+    // a = 1, 2, 3; b = 1, 3, 5, 7
+    Slice<false, ParentType<2>, TestSliceMixin, DimensionA, DimensionB> slice(p
+                                              , DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(3))
+                                              , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(4), 2)
+    );
+    std::vector<int> expected;
+    for(int a : { 1, 2, 3 }) {
+        for(int b : { 1, 3, 5, 7 }) {
+            expected.push_back(a * size + b);
+        }
+    }
+    ASSERT_EQ(expected.size(), slice.data_size());
+    ASSERT_EQ(expected, std::vector<int>(slice.cbegin(), slice.cend()));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(expected.size()), slice.cend() - slice.cbegin());
+    auto const begin = slice.cbegin();
+    for(std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], begin[i]) << i;
+        ASSERT_EQ(static_cast<std::ptrdiff_t>(i), (begin + i) - begin);
+    }
+
+    // each element is a run of its own
+    std::vector<int> runs;
+    slice.for_each_contiguous_run([&](int const* start, int const* end)
+                                  {
+                                      ASSERT_EQ(1, end - start);
+                                      runs.insert(runs.end(), start, end);
+                                  });
+    ASSERT_EQ(expected, runs);
+
+    // index and sub slice the strided dimension
+    auto row = slice[DimensionIndex<DimensionA>(1)];
+    ASSERT_EQ(static_cast<int>(2 * size + 5), row[DimensionIndex<DimensionB>(2)]);
+    auto sub_slice = slice.slice(DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(2), 2));
+    std::vector<int> sub_expected;
+    for(int a : { 1, 2, 3 }) {
+        for(int b : { 3, 7 }) {
+            sub_expected.push_back(a * size + b);
+        }
+    }
+    ASSERT_EQ(sub_expected, std::vector<int>(sub_slice.cbegin(), sub_slice.cend()));
+
+    // write through the slice
+    std::fill(slice.begin(), slice.end(), -1);
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(expected.size()), std::count(p._vec.begin(), p._vec.end(), -1));
+    ASSERT_EQ(static_cast<int>(size + 2), p._vec[size + 2]);
+}
+
+TEST_F(SliceTest, test_strided_single_dimension)
+{
+    ParentType<1> p(20);
+    typedef Slice<false, ParentType<1>, TestSliceMixin, DimensionA> SliceT;
+    // a = 2, 5, 8, 11, 14
+    SliceT slice(p, DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(5), 3));
+    std::vector<int> const expected = { 2, 5, 8, 11, 14 };
+    ASSERT_EQ(expected, std::vector<int>(slice.begin(), slice.end()));
+    ASSERT_EQ(5, slice.end() - slice.begin());
+    ASSERT_EQ(8, slice[2]);
+    ASSERT_EQ(11, slice[DimensionIndex<DimensionA>(3)]);
+    ASSERT_EQ(14, *(slice.cend() - 1));
+
+    std::vector<int> runs;
+    slice.for_each_contiguous_run([&](int* start, int* end)
+                                  {
+                                      ASSERT_EQ(1, end - start);
+                                      runs.insert(runs.end(), start, end);
+                                  });
+    ASSERT_EQ(expected, runs);
+
+    // a = 5, 11
+    auto sub_slice = slice.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(2), 2));
+    ASSERT_EQ(std::vector<int>({ 5, 11 }), std::vector<int>(sub_slice.begin(), sub_slice.end()));
+}
+
 } // namespace test
 } // namespace multiarray
 } // namespace astrotypes
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../StaticDimensionSizeTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/StaticDimensionSize.h"
+#include <numeric>
+#include <stdexcept>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+struct StaticDimension {};
+typedef StaticDimensionSize<StaticDimension, 16> StaticDimension16;
+
+
+StaticDimensionSizeTest::StaticDimensionSizeTest()
+    : ::testing::Test()
+{
+}
+
+StaticDimensionSizeTest::~StaticDimensionSizeTest()
+{
+}
+
+void StaticDimensionSizeTest::SetUp()
+{
+}
+
+void StaticDimensionSizeTest::TearDown()
+{
+}
+
+TEST_F(StaticDimensionSizeTest, test_static_size)
+{
+    static_assert(dimension_static_size<DimensionA>::value == 0, "expecting a runtime sized dimension");
+    static_assert(dimension_static_size<StaticDimension16>::value == 16, "expecting a static dimension");
+    static_assert(std::is_same<DimensionTag<StaticDimension16>, StaticDimension>::value, "expecting the wrapped tag");
+    static_assert(std::is_same<DimensionTag<DimensionA>, DimensionA>::value, "expecting the tag");
+
+    StaticDimension16 size;
+    ASSERT_EQ(16U, static_cast<std::size_t>(size));
+    ASSERT_EQ(16U, StaticDimension16::value);
+
+    StaticDimensionSize<DimensionA, 3> size_a;
+    DimensionSize<DimensionA> const& dimension_size = size_a;
+    ASSERT_EQ(DimensionSize<DimensionA>(3), dimension_size);
+}
+
+TEST_F(StaticDimensionSizeTest, test_multiarray)
+{
+    typedef TestMultiArray<int, DimensionA, StaticDimension16> ArrayType;
+    static_assert(has_dimension<ArrayType, StaticDimension>::value, "expecting the dimension to be found by its tag");
+    static_assert(has_exact_dimensions<ArrayType, DimensionA, StaticDimension>::value, "expecting the dimensions to be the tags");
+
+    ArrayType data(DimensionSize<DimensionA>(5), StaticDimension16());
+    ASSERT_EQ(DimensionSize<DimensionA>(5), data.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), data.dimension<StaticDimension>());
+    ASSERT_EQ(80U, data.data_size());
+    ASSERT_EQ(16U, data.block_size_t<DimensionA>());
+
+    // a plain DimensionSize is fine as long as it matches
+    ArrayType data_2(DimensionSize<DimensionA>(2), DimensionSize<StaticDimension>(16));
+    ASSERT_EQ(32U, data_2.data_size());
+
+    // resizing the runtime dimensions
+    data.resize(DimensionSize<DimensionA>(7));
+    ASSERT_EQ(112U, data.data_size());
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), data.dimension<StaticDimension>());
+
+    // slices behave as normal
+    std::iota(data.begin(), data.end(), 0);
+    auto slice = data[DimensionIndex<DimensionA>(2)];
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), slice.dimension<StaticDimension>());
+    ASSERT_EQ(32, *slice.begin());
+}
+
+TEST_F(StaticDimensionSizeTest, test_multiarray_default_constructor)
+{
+    TestMultiArray<int, DimensionA, StaticDimension16> data;
+    ASSERT_EQ(DimensionSize<DimensionA>(0), data.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), data.dimension<StaticDimension>());
+    ASSERT_EQ(0U, data.data_size());
+
+    TestMultiArray<int, StaticDimension16> data_1d;
+    ASSERT_EQ(16U, data_1d.data_size());
+}
+
+TEST_F(StaticDimensionSizeTest, test_multiarray_wrong_size)
+{
+    typedef TestMultiArray<int, DimensionA, StaticDimension16> ArrayType;
+    ASSERT_THROW(ArrayType(DimensionSize<DimensionA>(5), DimensionSize<StaticDimension>(15)), std::invalid_argument);
+
+    ArrayType data(DimensionSize<DimensionA>(5), StaticDimension16());
+    ASSERT_THROW(data.resize(DimensionSize<StaticDimension>(8)), std::invalid_argument);
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), data.dimension<StaticDimension>());
+    ASSERT_EQ(80U, data.data_size());
+}
+
+TEST_F(StaticDimensionSizeTest, test_static_size_is_per_type)
+{
+    // the static size belongs to the array type, not the dimension
+    TestMultiArray<int, DimensionA, StaticDimensionSize<StaticDimension, 4>> data_4(DimensionSize<DimensionA>(2), StaticDimensionSize<StaticDimension, 4>());
+    TestMultiArray<int, DimensionA, StaticDimension16> data_16(DimensionSize<DimensionA>(2), StaticDimension16());
+    TestMultiArray<int, DimensionA, StaticDimension> data_runtime(DimensionSize<DimensionA>(2), DimensionSize<StaticDimension>(7));
+    ASSERT_EQ(DimensionSize<StaticDimension>(4), data_4.dimension<StaticDimension>());
+    ASSERT_EQ(DimensionSize<StaticDimension>(16), data_16.dimension<StaticDimension>());
+    ASSERT_EQ(DimensionSize<StaticDimension>(7), data_runtime.dimension<StaticDimension>());
+
+    data_runtime.resize(DimensionSize<StaticDimension>(16));
+    ASSERT_EQ(32U, data_runtime.data_size());
+    ASSERT_EQ(data_16.data_size(), data_runtime.data_size());
+    ASSERT_THROW(data_4.resize(DimensionSize<StaticDimension>(16)), std::invalid_argument);
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,179 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../TiledMultiArrayTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/TiledMultiArray.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+TiledMultiArrayTest::TiledMultiArrayTest()
+    : ::testing::Test()
+{
+}
+
+TiledMultiArrayTest::~TiledMultiArrayTest()
+{
+}
+
+void TiledMultiArrayTest::SetUp()
+{
+}
+
+void TiledMultiArrayTest::TearDown()
+{
+}
+
+namespace {
+typedef TiledMultiArray<int, TileLayout<4, 3>, DimensionA, DimensionB> TestTiledArray;
+} // namespace
+
+TEST_F(TiledMultiArrayTest, test_size)
+{
+    TestTiledArray tiled(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    ASSERT_EQ(DimensionSize<DimensionA>(10), tiled.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(7), tiled.dimension<DimensionB>());
+    ASSERT_EQ(70U, tiled.data_size());
+    ASSERT_EQ(3U, tiled.number_of_tiles<DimensionA>());
+    ASSERT_EQ(3U, tiled.number_of_tiles<DimensionB>());
+    ASSERT_EQ(0, tiled(DimensionIndex<DimensionA>(9), DimensionIndex<DimensionB>(6)));
+
+    TestTiledArray swapped(DimensionSize<DimensionB>(7), DimensionSize<DimensionA>(10));
+    ASSERT_TRUE(swapped == tiled);
+
+    tiled.resize(DimensionSize<DimensionA>(2), DimensionSize<DimensionB>(2));
+    ASSERT_EQ(4U, tiled.data_size());
+    ASSERT_FALSE(swapped == tiled);
+}
+
+TEST_F(TiledMultiArrayTest, test_copy_from_multiarray)
+{
+    // sizes deliberately not a multiple of the tile size
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    TestTiledArray tiled(ma);
+    for(DimensionIndex<DimensionA> a(0); a < 10; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 7; ++b) {
+            ASSERT_EQ(ma[a][b], tiled(a, b)) << a << "," << b;
+        }
+    }
+
+    // and from the transposed layout
+    TestMultiArray<int, DimensionB, DimensionA> ma_t(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    TestTiledArray tiled_t(ma_t);
+    for(DimensionIndex<DimensionA> a(0); a < 10; ++a) {
+        for(DimensionIndex<DimensionB> b(0); b < 7; ++b) {
+            ASSERT_EQ(ma_t[b][a], tiled_t(a, b)) << a << "," << b;
+        }
+    }
+
+    // and back again
+    TestMultiArray<int, DimensionB, DimensionA> copy(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    std::fill(copy.begin(), copy.end(), -1);
+    tiled_t.copy_to(copy);
+    ASSERT_TRUE(copy == ma_t);
+}
+
+TEST_F(TiledMultiArrayTest, test_copy_size_mismatch)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    TestTiledArray tiled(ma);
+
+    TestMultiArray<int, DimensionA, DimensionB> smaller(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(6));
+    ASSERT_THROW(tiled.copy_to(smaller), std::invalid_argument);
+    ASSERT_THROW(tiled.copy_from(smaller), std::invalid_argument);
+
+    TestMultiArray<int, DimensionB, DimensionA> larger(DimensionSize<DimensionA>(11), DimensionSize<DimensionB>(7));
+    ASSERT_THROW(tiled.copy_to(larger), std::invalid_argument);
+}
+
+TEST_F(TiledMultiArrayTest, test_lines)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    TestTiledArray const tiled(ma);
+
+    for(DimensionIndex<DimensionA> a(0); a < 10; ++a) {
+        auto const line = tiled[a];
+        ASSERT_EQ(DimensionSize<DimensionB>(7), line.dimension<DimensionB>());
+        std::vector<int> values(line.begin(), line.end());
+        auto const expected = ma[a];
+        ASSERT_EQ(7U, values.size());
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin())) << a;
+        ASSERT_EQ(expected[DimensionIndex<DimensionB>(5)], line[DimensionIndex<DimensionB>(5)]);
+    }
+
+    for(DimensionIndex<DimensionB> b(0); b < 7; ++b) {
+        auto const line = tiled[b];
+        ASSERT_EQ(DimensionSize<DimensionA>(10), line.dimension<DimensionA>());
+        std::vector<int> values(line.cbegin(), line.cend());
+        auto const expected = ma[b];
+        ASSERT_EQ(10U, values.size());
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin())) << b;
+        ASSERT_EQ(expected[DimensionIndex<DimensionA>(9)], line[DimensionIndex<DimensionA>(9)]);
+    }
+
+    // write through a line
+    TestTiledArray writable(ma);
+    auto line = writable[DimensionIndex<DimensionB>(4)];
+    std::fill(line.begin(), line.end(), -1);
+    for(DimensionIndex<DimensionA> a(0); a < 10; ++a) {
+        ASSERT_EQ(-1, writable(a, DimensionIndex<DimensionB>(4)));
+        ASSERT_EQ(ma[a][DimensionIndex<DimensionB>(3)], writable(a, DimensionIndex<DimensionB>(3)));
+    }
+}
+
+TEST_F(TiledMultiArrayTest, test_tiles)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ma(DimensionSize<DimensionA>(10), DimensionSize<DimensionB>(7));
+    TestTiledArray tiled(ma);
+
+    std::size_t count = 0;
+    for(DimensionIndex<DimensionA> ta(0); ta < tiled.number_of_tiles<DimensionA>(); ++ta) {
+        for(DimensionIndex<DimensionB> tb(0); tb < tiled.number_of_tiles<DimensionB>(); ++tb) {
+            auto const tile = tiled.tile(ta, tb);
+            ASSERT_EQ(3U, tile.row_stride());
+            ASSERT_EQ(std::min<std::size_t>(4, 10 - 4 * ta), tile.dimension<DimensionA>());
+            ASSERT_EQ(std::min<std::size_t>(3, 7 - 3 * tb), tile.dimension<DimensionB>());
+            for(DimensionIndex<DimensionA> a(0); a < tile.dimension<DimensionA>(); ++a) {
+                for(DimensionIndex<DimensionB> b(0); b < tile.dimension<DimensionB>(); ++b) {
+                    ASSERT_EQ(ma[DimensionIndex<DimensionA>(4 * ta + a)][DimensionIndex<DimensionB>(3 * tb + b)], tile(a, b));
+                    ASSERT_EQ(&tile(a, b), tile.row(a) + b);
+                    ++count;
+                }
+            }
+        }
+    }
+    ASSERT_EQ(70U, count);
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
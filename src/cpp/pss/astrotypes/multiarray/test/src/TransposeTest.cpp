@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../TransposeTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/Transpose.h"
+#include <algorithm>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+TransposeTest::TransposeTest()
+    : ::testing::Test()
+{
+}
+
+TransposeTest::~TransposeTest()
+{
+}
+
+void TransposeTest::SetUp()
+{
+}
+
+void TransposeTest::TearDown()
+{
+}
+
+TEST_F(TransposeTest, test_tiled_transpose_2d)
+{
+    // sizes chosen to exercise both full and partial tiles
+    for(std::size_t rows : { 1U, 7U, 64U, 100U }) {
+        for(std::size_t cols : { 1U, 33U, 128U, 130U }) {
+            std::vector<uint8_t> src(rows * cols);
+            std::vector<uint16_t> dst(rows * cols, 0);
+            unsigned n=0;
+            std::generate(src.begin(), src.end(), [&]() { return static_cast<uint8_t>(n++); });
+
+            // src is rows x cols, contiguous along cols
+            tiled_transpose(src.data(), cols, dst.data(), rows, cols, rows);
+            for(std::size_t r=0; r < rows; ++r) {
+                for(std::size_t c=0; c < cols; ++c) {
+                    ASSERT_EQ(src[r * cols + c], dst[c * rows + r]) << "rows=" << rows << " cols=" << cols;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TransposeTest, test_two_dimension_transpose)
+{
+    DimensionSize<DimensionA> size_a(67);
+    DimensionSize<DimensionB> size_b(131);
+    TestMultiArray<int, DimensionA, DimensionB> ab(size_a, size_b);
+    TestMultiArray<int, DimensionB, DimensionA> ba(size_b, size_a);
+
+    transpose(ba, ab);
+    for(DimensionIndex<DimensionA> i(0); i < size_a; ++i) {
+        for(DimensionIndex<DimensionB> j(0); j < size_b; ++j) {
+            ASSERT_EQ(ba[j][i], ab[i][j]) << " i=" << i << " j=" << j;
+        }
+    }
+}
+
+TEST_F(TransposeTest, test_three_dimension_transpose_constructor)
+{
+    DimensionSize<DimensionA> size_a(5);
+    DimensionSize<DimensionB> size_b(40);
+    DimensionSize<DimensionC> size_c(37);
+    TestMultiArray<int, DimensionA, DimensionB, DimensionC> abc(size_a, size_b, size_c);
+
+    // innermost dimensions differ
+    TestMultiArray<int, DimensionC, DimensionA, DimensionB> cab(abc);
+    // innermost dimensions match
+    TestMultiArray<int, DimensionB, DimensionA, DimensionC> bac(abc);
+
+    ASSERT_EQ(cab.dimension<DimensionA>(), size_a);
+    ASSERT_EQ(cab.dimension<DimensionB>(), size_b);
+    ASSERT_EQ(cab.dimension<DimensionC>(), size_c);
+    for(DimensionIndex<DimensionA> i(0); i < size_a; ++i) {
+        for(DimensionIndex<DimensionB> j(0); j < size_b; ++j) {
+            for(DimensionIndex<DimensionC> k(0); k < size_c; ++k) {
+                ASSERT_EQ(cab[k][i][j], abc[i][j][k]) << " i=" << i << " j=" << j << " k=" << k;
+                ASSERT_EQ(bac[j][i][k], abc[i][j][k]) << " i=" << i << " j=" << j << " k=" << k;
+            }
+        }
+    }
+}
+
+TEST_F(TransposeTest, test_empty_transpose)
+{
+    TestMultiArray<int, DimensionA, DimensionB> ab(DimensionSize<DimensionA>(0), DimensionSize<DimensionB>(10));
+    TestMultiArray<int, DimensionB, DimensionA> ba(ab);
+    ASSERT_EQ(ba.data_size(), 0U);
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,223 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../ViewTest.h"
+#include "../TestMultiArray.h"
+#include "pss/astrotypes/multiarray/View.h"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace multiarray {
+namespace test {
+
+
+ViewTest::ViewTest()
+    : ::testing::Test()
+{
+}
+
+ViewTest::~ViewTest()
+{
+}
+
+void ViewTest::SetUp()
+{
+}
+
+void ViewTest::TearDown()
+{
+}
+
+TEST_F(ViewTest, test_index_mapper)
+{
+    // identity
+    IndexMapper<DimensionA> identity(DimensionSize<DimensionA>(5));
+    ASSERT_EQ(DimensionSize<DimensionA>(5), identity.size());
+    ASSERT_EQ(3U, identity(std::size_t(3)));
+    ASSERT_EQ(1U, identity.runs().size());
+    ASSERT_TRUE(identity.fits(DimensionSize<DimensionA>(5)));
+    ASSERT_FALSE(identity.fits(DimensionSize<DimensionA>(4)));
+
+    // reverse
+    auto reverse = IndexMapper<DimensionA>::reverse(DimensionSize<DimensionA>(5));
+    ASSERT_EQ(DimensionIndex<DimensionA>(4), reverse(DimensionIndex<DimensionA>(0)));
+    ASSERT_EQ(DimensionIndex<DimensionA>(0), reverse(DimensionIndex<DimensionA>(4)));
+    ASSERT_EQ(1U, reverse.runs().size());
+    ASSERT_TRUE(reverse.runs()[0].reversed);
+    ASSERT_EQ(4U, reverse.runs()[0].source_start);
+    ASSERT_EQ(5U, reverse.runs()[0].length);
+
+    // affine with a step > 1 has a run for each index
+    IndexMapper<DimensionA> affine(DimensionIndex<DimensionA>(1), 2, DimensionSize<DimensionA>(3));
+    ASSERT_EQ(5U, affine(std::size_t(2)));
+    ASSERT_EQ(3U, affine.runs().size());
+    ASSERT_TRUE(affine.fits(DimensionSize<DimensionA>(6)));
+    ASSERT_FALSE(affine.fits(DimensionSize<DimensionA>(5)));
+
+    // flagged
+    std::vector<bool> flags = { false, false, true, false, true, true, false };
+    auto unflagged = IndexMapper<DimensionA>::exclude_flagged(flags);
+    ASSERT_EQ(DimensionSize<DimensionA>(4), unflagged.size());
+    ASSERT_EQ(3U, unflagged(std::size_t(2)));
+    ASSERT_EQ(3U, unflagged.runs().size());
+    ASSERT_EQ(0U, unflagged.runs()[0].source_start);
+    ASSERT_EQ(2U, unflagged.runs()[0].length);
+    ASSERT_EQ(6U, unflagged.runs()[2].source_start);
+    ASSERT_EQ(3U, unflagged.runs()[2].start);
+}
+
+TEST_F(ViewTest, test_reverse_inner_dimension)
+{
+    TestMultiArray<int, DimensionA, DimensionB> data(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    auto view = make_view(data, IndexMapper<DimensionB>::reverse(data.dimension<DimensionB>()));
+    ASSERT_EQ(DimensionSize<DimensionA>(7), view.dimension<DimensionA>());
+    ASSERT_EQ(DimensionSize<DimensionB>(11), view.dimension<DimensionB>());
+    ASSERT_EQ(data.data_size(), view.data_size());
+
+    for(std::size_t a = 0; a < 7; ++a) {
+        for(std::size_t b = 0; b < 11; ++b) {
+            ASSERT_EQ((int)(a * 11 + 10 - b), (view[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)]));
+        }
+    }
+
+    // iteration follows the view order
+    std::vector<int> expected;
+    for(std::size_t a = 0; a < 7; ++a) {
+        for(std::size_t b = 0; b < 11; ++b) {
+            expected.push_back((int)(a * 11 + 10 - b));
+        }
+    }
+    ASSERT_EQ(expected.size(), (std::size_t)std::distance(view.begin(), view.end()));
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), view.cbegin()));
+
+    // writes go through to the underlying data
+    *view.begin() = -1;
+    ASSERT_EQ(-1, (data[DimensionIndex<DimensionA>(0)][DimensionIndex<DimensionB>(10)]));
+    expected[0] = -1;
+
+    TestMultiArray<int, DimensionA, DimensionB> out(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    view.materialise(out);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TEST_F(ViewTest, test_remap_outer_dimension)
+{
+    TestMultiArray<int, DimensionA, DimensionB> const data(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    std::vector<std::size_t> table = { 6, 0, 1, 2, 5, 4 };
+    auto view = make_view(data, IndexMapper<DimensionA>(table));
+    ASSERT_EQ(DimensionSize<DimensionA>(6), view.dimension<DimensionA>());
+    ASSERT_EQ(66U, view.data_size());
+
+    std::vector<int> expected;
+    for(std::size_t a = 0; a < table.size(); ++a) {
+        for(std::size_t b = 0; b < 11; ++b) {
+            expected.push_back((int)(table[a] * 11 + b));
+            ASSERT_EQ(expected.back(), (view[DimensionIndex<DimensionA>(a)][DimensionIndex<DimensionB>(b)]));
+        }
+    }
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+
+    TestMultiArray<int, DimensionA, DimensionB> out(DimensionSize<DimensionA>(6), DimensionSize<DimensionB>(11));
+    view.materialise(out);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+
+    // sizes must match
+    TestMultiArray<int, DimensionA, DimensionB> wrong(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    ASSERT_THROW(view.materialise(wrong), std::invalid_argument);
+}
+
+TEST_F(ViewTest, test_slice_flagged)
+{
+    TestMultiArray<int, DimensionA, DimensionB> data(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    auto slice = data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(2), DimensionSize<DimensionA>(3))
+                          , DimensionSpan<DimensionB>(DimensionIndex<DimensionB>(1), DimensionSize<DimensionB>(8)));
+    std::vector<int> flags = { 1, 0, 0, 1, 0, 0, 0, 1 };
+    auto view = make_view(slice, IndexMapper<DimensionB>::exclude_flagged(flags));
+    ASSERT_EQ(DimensionSize<DimensionB>(5), view.dimension<DimensionB>());
+    ASSERT_EQ(DimensionSize<DimensionA>(3), view.dimension<DimensionA>());
+
+    std::vector<std::size_t> const kept = { 2, 3, 5, 6, 7 }; // b in the underlying data
+    std::vector<int> expected;
+    for(std::size_t a = 0; a < 3; ++a) {
+        auto row = view[DimensionIndex<DimensionA>(a)];
+        for(std::size_t b = 0; b < kept.size(); ++b) {
+            expected.push_back((int)((a + 2) * 11 + kept[b]));
+            ASSERT_EQ(expected.back(), row[DimensionIndex<DimensionB>(b)]);
+        }
+    }
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+
+    TestMultiArray<int, DimensionA, DimensionB> out(DimensionSize<DimensionA>(3), DimensionSize<DimensionB>(5));
+    view.materialise(out);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+
+    // mapper must fit the data
+    ASSERT_THROW(make_view(slice, IndexMapper<DimensionB>(DimensionIndex<DimensionB>(0), 2, DimensionSize<DimensionB>(5))), std::invalid_argument);
+}
+
+// true if make_view can be called with a DataT
+template<typename DataT, typename Enable=void>
+struct CanMakeView : std::false_type {};
+
+template<typename DataT>
+struct CanMakeView<DataT, decltype(make_view(std::declval<DataT>(), std::declval<IndexMapper<DimensionA> const&>()), void())> : std::true_type {};
+
+TEST_F(ViewTest, test_lifetimes)
+{
+    typedef TestMultiArray<int, DimensionA, DimensionB> DataType;
+    static_assert(CanMakeView<DataType&>::value, "lvalue data");
+    static_assert(CanMakeView<DataType const&>::value, "const lvalue data");
+    static_assert(!CanMakeView<DataType>::value, "a view of a temporary MultiArray must not compile");
+    static_assert(CanMakeView<decltype(std::declval<DataType&>()[DimensionIndex<DimensionA>(0)])>::value, "slices are held by value");
+
+    DataType data(DimensionSize<DimensionA>(7), DimensionSize<DimensionB>(11));
+    std::vector<std::size_t> const table = { 4, 2 };
+
+    // a temporary slice is copied into the view
+    auto slice_view = make_view(data.slice(DimensionSpan<DimensionA>(DimensionIndex<DimensionA>(1), DimensionSize<DimensionA>(5))), IndexMapper<DimensionA>(table));
+    ASSERT_EQ(5 * 11, (*slice_view.begin()));
+
+    // iterators do not depend on the lifetime of the view
+    typedef View<DataType, DimensionA>::iterator IteratorType;
+    std::unique_ptr<View<DataType, DimensionA>> view(new View<DataType, DimensionA>(data, IndexMapper<DimensionA>(table)));
+    IteratorType it = view->begin();
+    IteratorType const end = view->end();
+    view.reset();
+
+    std::vector<int> values(it, end);
+    ASSERT_EQ(22U, values.size());
+    ASSERT_EQ(4 * 11, values[0]);
+    ASSERT_EQ(2 * 11 + 10, values.back());
+}
+
+} // namespace test
+} // namespace multiarray
+} // namespace astrotypes
+} // namespace pss
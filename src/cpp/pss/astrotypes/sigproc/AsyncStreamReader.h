@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_ASYNCSTREAMREADER_H
+#define PSS_ASTROTYPES_SIGPROC_ASYNCSTREAMREADER_H
+
+#include "SigProcFormat.h"
+#include "PackedSigProcFormat.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief Reads chunks of data from a sigproc stream on a background thread
+ * @details A fixed ring of data objects (copies of the prototype passed to the constructor)
+ *          is filled by a background I/O thread, so that the next chunks are read from the stream
+ *          while the caller processes the current one.
+ *          When all buffers are full the I/O thread waits for the caller to release one (backpressure).
+ *          No allocation takes place once the reader has been constructed.
+ *
+ *          Each call to next() returns a Chunk which gives access to the data. The buffer is handed
+ *          back to the reader when the Chunk is destroyed. Chunks share ownership of the buffers with
+ *          the reader so they remain valid if the reader is destroyed first. The final chunk of the stream may only be
+ *          partially filled (see Chunk::number_of_spectra()). Once the stream is exhausted next()
+ *          returns an empty Chunk.
+ *
+ * @tparam DataT    : the data type to read into (e.g. TimeFrequency<uint8_t>)
+ * @tparam AdapterT : the stream adapter that interprets the stream (e.g. SigProcFormat<units::Time, units::Frequency>)
+ *
+ * @code
+ *      TimeFrequency<uint8_t> prototype(DimensionSize<units::Time>(1024), header.number_of_channels());
+ *      AsyncStreamReader<TimeFrequency<uint8_t>, SigProcFormat<units::Time, units::Frequency>> reader(input_stream, prototype);
+ *      while(auto chunk = reader.next()) {
+ *          do_something(*chunk, chunk.number_of_spectra());
+ *      }
+ * @endcode
+ */
+template<typename DataT, typename AdapterT>
+class AsyncStreamReader
+{
+    public:
+        typedef DataT DataType;
+
+    private:
+        struct Filled {
+            std::size_t index;
+            DimensionSize<units::Time> number_of_spectra;
+        };
+
+        // the buffers and the state shared between the reader, its I/O thread and any Chunks
+        struct SharedState {
+            SharedState(DataT const& prototype, std::size_t number_of_buffers);
+            void release(std::size_t index);
+
+            std::vector<DataT> buffers;
+            std::mutex mutex;
+            std::condition_variable free_condition;
+            std::condition_variable filled_condition;
+            std::deque<std::size_t> free;
+            std::deque<Filled> filled;
+            bool end_of_stream;
+            bool stop;
+            std::exception_ptr exception;
+        };
+
+    public:
+        /**
+         * @brief handle to a buffer filled with data from the stream
+         * @details move only. The buffer is returned to the reader on destruction
+         */
+        class Chunk
+        {
+                friend class AsyncStreamReader;
+
+            public:
+                Chunk(Chunk&&);
+                Chunk(Chunk const&) = delete;
+                Chunk& operator=(Chunk const&) = delete;
+                ~Chunk();
+
+                /// false if there is no more data (end of stream)
+                explicit operator bool() const;
+
+                /// the data
+                DataT& operator*() const;
+                DataT* operator->() const;
+
+                /**
+                 * @brief the number of complete spectra read into the data (the first number_of_spectra() in Time)
+                 * @details any samples of an incomplete last spectrum are not counted.
+                 *          Streams in channel order (e.g. SigProcFormat<Frequency, Time>) only fill whole spectra
+                 *          when they are single channel.
+                 */
+                DimensionSize<units::Time> number_of_spectra() const;
+
+                /// true if the stream ended before the data could be completely filled
+                bool partial() const;
+
+            private:
+                Chunk(std::shared_ptr<SharedState> state, std::size_t index, DimensionSize<units::Time> number_of_spectra);
+
+            private:
+                std::shared_ptr<SharedState> _state;
+                std::size_t _index;
+                DimensionSize<units::Time> _number_of_spectra;
+        };
+
+    public:
+        /**
+         * @param stream : the input stream, positioned at the start of the data (i.e after the header).
+         *                 Must not be accessed by anything else for the lifetime of the reader.
+         * @param prototype : the data object each buffer is copied from. This determines the chunk size.
+         * @param number_of_buffers : the number of buffers in the ring (minimum 2)
+         */
+        AsyncStreamReader(std::istream& stream, DataT const& prototype, std::size_t number_of_buffers = 3);
+        AsyncStreamReader(AsyncStreamReader const&) = delete;
+        AsyncStreamReader& operator=(AsyncStreamReader const&) = delete;
+
+        /// stops the background thread. Any Chunks still held keep their buffer until they are destroyed
+        ~AsyncStreamReader();
+
+        /**
+         * @brief wait for the next chunk of data
+         * @details returns an empty Chunk once the end of the stream has been reached.
+         *          Any exception raised reading the stream is rethrown here.
+         */
+        Chunk next();
+
+    private:
+        // counts the bytes extracted from the underlying stream
+        class CountingStreamBuffer : public std::streambuf
+        {
+            public:
+                CountingStreamBuffer(std::streambuf* buffer);
+                std::size_t count() const;
+
+            protected:
+                int_type underflow() override;
+                int_type uflow() override;
+                std::streamsize xsgetn(char_type* s, std::streamsize n) override;
+                std::streamsize showmanyc() override;
+
+            private:
+                std::streambuf* _buffer;
+                std::size_t _count;
+        };
+
+        void run();
+
+    private:
+        CountingStreamBuffer _stream_buffer;
+        std::istream _stream;
+        std::size_t const _sample_bits;
+        std::shared_ptr<SharedState> _state;
+        std::thread _thread;
+};
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "detail/AsyncStreamReader.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_ASYNCSTREAMREADER_H
@@ -27,6 +27,7 @@
 #include "Header.h"
 #include "DefaultDataFactoryTraits.h"
 #include "SigProcFormat.h"
+#include "SigProcFormatAdapterSelector.h"
 #include <array>
 #include <memory>
 #include <exception>
@@ -113,31 +114,26 @@ class DataFactory
             typedef FrequencyTime<typename DataFactoryTraits::template ElementTypeMap<nifs, nbits>::type> type;
         };
 
-        template<Header::DataType DataType, bool Dummy=true>
-        struct SigProcAdapterType {};
-
-        template<bool Dummy>
-        struct SigProcAdapterType<Header::DataType::FilterBank, Dummy> {
-            typedef SigProcFormat<units::Time, units::Frequency> type;
-        };
-
-        template<bool Dummy>
-        struct SigProcAdapterType<Header::DataType::TimeSeries, Dummy> {
-            typedef SigProcFormat<units::Frequency, units::Time> type;
+        template<Header::DataType DataType, unsigned Nbits>
+        struct SigProcAdapterType {
+            typedef typename SigProcFormatAdapterSelector<DataType, Nbits>::type type;
         };
 
     private:
         // these maps generate the code to select the correct type from runtime variables
-        template<Header::DataType DataType, unsigned Nifs, unsigned Nbits=8>
+        template<Header::DataType DataType, unsigned Nifs, unsigned Nbits=1>
         struct BitsRuntimeMap {
             template<typename... Args>
             static
             void exec(unsigned number_of_bits, Args&&... args) {
-                if(number_of_bits != Nbits) BitsRuntimeMap<DataType, Nifs, BitToUnsignedInt<Nbits>::next>::exec(number_of_bits, std::forward<Args>(args)...);
+                if(number_of_bits != Nbits) {
+                    BitsRuntimeMap<DataType, Nifs, BitToUnsignedInt<Nbits>::next>::exec(number_of_bits, std::forward<Args>(args)...);
+                    return;
+                }
                 FnTemplate<
                     SigProcInputTraits<
                         typename MultiArrayType<DataType, Nifs, Nbits>::type
-                       ,typename SigProcAdapterType<DataType>::type
+                       ,typename SigProcAdapterType<DataType, Nbits>::type
                     >>::exec(std::forward<Args>(args)...);
             }
         };
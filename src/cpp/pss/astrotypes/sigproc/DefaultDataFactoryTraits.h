@@ -64,6 +64,25 @@ struct BitToUnsignedInt<8> {
     static constexpr unsigned next = 16;
 };
 
+// sub byte types are unpacked into 8 bit types
+template<>
+struct BitToUnsignedInt<4> {
+    typedef uint8_t type;
+    static constexpr unsigned next = 8;
+};
+
+template<>
+struct BitToUnsignedInt<2> {
+    typedef uint8_t type;
+    static constexpr unsigned next = 4;
+};
+
+template<>
+struct BitToUnsignedInt<1> {
+    typedef uint8_t type;
+    static constexpr unsigned next = 2;
+};
+
 /**
  * @brief Maps number_of_if_streams to the container or raw type
  * @param type        : the mapped type
@@ -32,10 +32,10 @@ namespace pss {
 namespace astrotypes {
 namespace sigproc {
 
-template<Header::DataType HeaderDataType>
+template<Header::DataType HeaderDataType, unsigned NBits=8>
 class AdaptedIStream
 {
-        typedef typename SigProcFormatAdapterSelector<HeaderDataType>::type AdapterType;
+        typedef typename SigProcFormatAdapterSelector<HeaderDataType, NBits>::type AdapterType;
 
     public:
         template<typename Stream, typename DataType>
@@ -69,6 +69,11 @@ class IStream
         template<typename Stream>
         void new_header(Stream& stream);
 
+    private:
+        // select the adapter for the number of bits in the header
+        template<Header::DataType HeaderDataType, typename Stream, typename DataType>
+        void read_adapted(Stream& s, DataType&);
+
     protected:
         HeaderT _header;
 };
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_MAPPEDFILEREADER_H
+#define PSS_ASTROTYPES_SIGPROC_MAPPEDFILEREADER_H
+#include "Header.h"
+#include "IStream.h"
+#include "detail/MappedRegion.h"
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <string>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief Zero copy access to the data in a sigproc file via a memory mapping
+ * @details The header is read as with @ref FileReader. The data section is then mapped
+ *          into memory and presented as TimeFrequency objects whose storage is the mapping
+ *          itself, avoiding the copy through a stream buffer and any heap allocation.
+ *          Files larger than is comfortable to map in one go can be processed in windows of
+ *          a fixed number of spectra with next(), only the current window being mapped.
+ *
+ *          The mapping is private: modifications to the data are visible only to the
+ *          TimeFrequency object (and its copies) and are never written back to the file.
+ *          A mapped TimeFrequency keeps its window mapped for as long as it (or any copy of it)
+ *          exists, independently of the lifetime of the reader. Copies share the mapped memory.
+ *
+ *          Only single IF data with whole byte samples (i.e nbits 8, 16 or 32) can be mapped.
+ *          The sample type requested must match the nbits in the header.
+ *
+ * @code
+ *      MappedFileReader<> reader("my_file.fil");
+ *      while(true) {
+ *          auto data = reader.next<uint8_t>(DimensionSize<units::Time>(8192));
+ *          if(data.number_of_spectra() == 0) break;
+ *          // ... use data
+ *      }
+ * @endcode
+ */
+template<typename HeaderType=Header>
+class MappedFileReader : public IStream<HeaderType>
+{
+        typedef IStream<HeaderType> BaseT;
+
+    public:
+        typedef MappedRegion::Advice Advice;
+
+        template<typename T>
+        using TimeFrequencyType = TimeFrequency<T, MappedAllocator<T>>;
+
+    public:
+        MappedFileReader();
+
+        /**
+         * @brief constructor with the file
+         * @param advice : the access pattern hint to apply to each mapping
+         */
+        MappedFileReader(std::string const& file_name, Advice advice=Advice::Sequential);
+        ~MappedFileReader();
+
+        /**
+         * @brief set the filename to read
+         * @details resets the position used by next() to the start of the data
+         */
+        void open(std::string const& file_name);
+
+        /**
+         * @brief set the access pattern hint to apply to subsequent mappings
+         */
+        void advise(Advice advice);
+
+        /**
+         * @brief map the spectra [start, start + number_of_spectra) from the file
+         * @details number_of_spectra is truncated to those available in the file
+         * @throw std::runtime_error if the file is not open or sizeof(T) does not match the header nbits
+         */
+        template<typename T>
+        TimeFrequencyType<T> map(DimensionIndex<units::Time> start, DimensionSize<units::Time> number_of_spectra) const;
+
+        /**
+         * @brief map the next window of (at most) number_of_spectra spectra
+         * @details returns an object with no spectra once the end of the data has been reached
+         */
+        template<typename T>
+        TimeFrequencyType<T> next(DimensionSize<units::Time> number_of_spectra);
+
+        /**
+         * @brief return the expected dimension of the data in the file
+         */
+        template<typename Dimension>
+        DimensionSize<Dimension> dimension() const;
+
+        /**
+         * @brief the number of data points in the file (i.e number of data points of nbits)
+         */
+        std::size_t number_of_data_points() const;
+
+    protected:
+        void do_open(std::string const& file_name);
+        void close();
+
+    private:
+        int _fd;
+        std::size_t _data_size; // bytes
+        Advice _advice;
+        DimensionIndex<units::Time> _position;
+};
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "detail/MappedFileReader.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_MAPPEDFILEREADER_H
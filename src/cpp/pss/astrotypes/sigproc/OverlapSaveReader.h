@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_OVERLAPSAVEREADER_H
+#define PSS_ASTROTYPES_SIGPROC_OVERLAPSAVEREADER_H
+
+#include "FileReader.h"
+#include "MappedFileReader.h"
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <cstddef>
+#include <memory>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief Read a sigproc file as a sequence of overlapping chunks of spectra
+ * @details Each chunk (except the first) starts with the last overlap spectra of the previous chunk,
+ *          as needed by e.g. dedispersion where each chunk must carry the last max_delay
+ *          spectra of the one before.
+ *
+ *          Chunks are views into an internal buffer several chunks long. Successive chunks
+ *          advance through the buffer, so the overlapping spectra are neither read again nor
+ *          copied. Only when the buffer is exhausted are the overlap spectra moved back to its start
+ *          (once every buffer_chunks chunks). The final chunk is a shorter view if the file runs
+ *          out, so nothing is ever reallocated.
+ *
+ *          The reader must be positioned at the start of the data (e.g. just opened).
+ *
+ *          With a MappedFileReader there is no buffer: each chunk is a window mapped directly
+ *          over the file, so the overlap is simply mapped again (see the specialisation below).
+ *
+ * @tparam T       : the type of each sample
+ * @tparam ReaderT : the reader to take data from (FileReader, MappedFileReader)
+ *
+ * @code
+ *      FileReader<> file(filename);
+ *      OverlapSaveReader<uint8_t> reader(file, DimensionSize<units::Time>(8192), DimensionSize<units::Time>(max_delay));
+ *      while(reader.next()) {
+ *          dedisperse(reader.chunk());
+ *      }
+ * @endcode
+ */
+template<typename T, typename ReaderT=FileReader<>>
+class OverlapSaveReader
+{
+    public:
+        typedef TimeFrequency<T> BufferType;
+        typedef typename BufferType::ConstSliceType ChunkType;
+
+    public:
+        /**
+         * @param chunk_size : the number of spectra in each chunk (including the overlap)
+         * @param overlap : the number of spectra at the end of a chunk to repeat at the start of the next
+         * @param buffer_chunks : the size of the internal buffer, in chunks. Larger buffers move the overlap less often.
+         * @throw std::invalid_argument if the overlap is not smaller than the chunk_size
+         */
+        OverlapSaveReader(ReaderT& reader
+                         , DimensionSize<units::Time> chunk_size
+                         , DimensionSize<units::Time> overlap
+                         , std::size_t buffer_chunks = 4);
+
+        /**
+         * @brief move on to the next chunk
+         * @return false if there is no more data
+         */
+        bool next();
+
+        /**
+         * @brief the current chunk
+         * @details only valid after next() has returned true, and until the next call to next()
+         */
+        ChunkType chunk() const;
+
+        /**
+         * @brief the index in the file of the first spectrum of the current chunk
+         */
+        DimensionIndex<units::Time> start() const;
+
+        DimensionSize<units::Time> chunk_size() const;
+        DimensionSize<units::Time> overlap() const;
+
+    private:
+        ReaderT& _reader;
+        std::size_t _chunk_size;
+        std::size_t _overlap;
+        BufferType _buffer;
+        std::size_t _spectra_remaining; // not yet read from the file
+        std::size_t _offset;            // of the current chunk in the buffer
+        std::size_t _length;            // of the current chunk
+        std::size_t _start;             // of the current chunk in the file
+        bool _started;
+};
+
+/**
+ * @brief OverlapSaveReader over a memory mapped file
+ * @details Each chunk is a window of the file mapped with MappedFileReader::map, so the
+ *          overlapping spectra are neither read again nor copied, and there is no buffer.
+ *          Chunks always start from the beginning of the data, whatever the position of the reader.
+ */
+template<typename T, typename HeaderType>
+class OverlapSaveReader<T, MappedFileReader<HeaderType>>
+{
+    public:
+        typedef typename MappedFileReader<HeaderType>::template TimeFrequencyType<T> WindowType;
+        typedef typename WindowType::ConstSliceType ChunkType;
+
+    public:
+        /**
+         * @param chunk_size : the number of spectra in each chunk (including the overlap)
+         * @param overlap : the number of spectra at the end of a chunk to repeat at the start of the next
+         * @param buffer_chunks : unused, for compatibility with the buffered reader
+         * @throw std::invalid_argument if the overlap is not smaller than the chunk_size
+         */
+        OverlapSaveReader(MappedFileReader<HeaderType>& reader
+                         , DimensionSize<units::Time> chunk_size
+                         , DimensionSize<units::Time> overlap
+                         , std::size_t buffer_chunks = 4);
+
+        /**
+         * @brief map the next chunk
+         * @return false if there is no more data
+         */
+        bool next();
+
+        /**
+         * @brief the current chunk
+         * @details only valid after next() has returned true, and until the next call to next()
+         */
+        ChunkType chunk() const;
+
+        /**
+         * @brief the index in the file of the first spectrum of the current chunk
+         */
+        DimensionIndex<units::Time> start() const;
+
+        DimensionSize<units::Time> chunk_size() const;
+        DimensionSize<units::Time> overlap() const;
+
+    private:
+        MappedFileReader<HeaderType>& _reader;
+        std::size_t _chunk_size;
+        std::size_t _overlap;
+        std::size_t _start;             // of the current chunk in the file
+        std::unique_ptr<WindowType> _window;
+};
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "detail/OverlapSaveReader.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_OVERLAPSAVEREADER_H
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_PACKEDBITS_H
+#define PSS_ASTROTYPES_SIGPROC_PACKEDBITS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief Pack and unpack samples of fewer than 8 bits (1, 2 or 4 bits)
+ * @details Samples are packed contiguously with the first sample in the least
+ *          significant bits of each byte (the sigproc convention).
+ *          The kernels work a whole byte at a time with a fixed (compile time)
+ *          number of samples per byte so the compiler is free to vectorise them.
+ * @tparam NBits the number of bits per sample
+ */
+template<unsigned NBits>
+struct PackedBits
+{
+    static_assert(NBits == 1 || NBits == 2 || NBits == 4, "PackedBits supports 1, 2 or 4 bit samples only");
+
+    /// the number of samples in each byte
+    static constexpr unsigned samples_per_byte = 8 / NBits;
+
+    /// the bits of a single sample
+    static constexpr uint8_t mask = (1U << NBits) - 1;
+
+    /**
+     * @brief the number of bytes required to store number_of_samples samples
+     */
+    static constexpr std::size_t bytes(std::size_t number_of_samples)
+    {
+        return (number_of_samples + samples_per_byte - 1) / samples_per_byte;
+    }
+
+    /**
+     * @brief unpack number_of_samples samples from packed into out
+     * @details out must have space for number_of_samples values of type T
+     */
+    template<typename T>
+    static void unpack(uint8_t const* packed, std::size_t number_of_samples, T* out);
+
+    /**
+     * @brief pack number_of_samples values from in into packed
+     * @details values are converted to unsigned integers and truncated to the lowest NBits bits.
+     *          Any unused bits in the last byte are set to zero.
+     */
+    template<typename T>
+    static void pack(T const* in, std::size_t number_of_samples, uint8_t* packed);
+};
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "detail/PackedBits.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_PACKEDBITS_H
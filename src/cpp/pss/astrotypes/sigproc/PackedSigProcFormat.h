@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_PACKEDSIGPROCFORMAT_H
+#define PSS_ASTROTYPES_SIGPROC_PACKEDSIGPROCFORMAT_H
+
+#include "SigProcFormat.h"
+#include "PackedBits.h"
+#include <iostream>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief stream adapter for sigproc data with fewer than 8 bits per sample (1, 2 or 4 bit data)
+ * @details Samples are unpacked on input into the element type of the data object (e.g uint8_t or float)
+ *          and packed again on output (values are truncated to the lowest NBits bits).
+ *          Any data type and ordering supported by SigProcFormat<Dimension1, Dimension2> is supported.
+ *
+ *          Each read or write is packed independently, so the data size must be a multiple of
+ *          the number of samples per byte (8/NBits), otherwise std::invalid_argument is thrown.
+ *          Bits left over in a partial byte cannot be carried on to the next chunk.
+ * @code
+ *      TimeFrequency<uint8_t> data(DimensionSize<units::Time>(1024), header.number_of_channels());
+ *      input_stream >> PackedSigProcFormat<units::Time, units::Frequency, 4>() >> data;
+ * @endcode
+ */
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+class PackedSigProcFormat
+{
+        typedef SigProcFormat<Dimension1, Dimension2> UnpackedFormat;
+        typedef PackedBits<NBits> PackedBitsType;
+
+    public:
+        class OSigProcFormat {
+                friend PackedSigProcFormat;
+
+            protected:
+                OSigProcFormat(std::ostream& os) : _os(os) {}
+
+            public:
+                template<typename T>
+                OSigProcFormat const& operator<<(T const&) const;
+
+            protected:
+                std::ostream& _os;
+        };
+
+        class ISigProcFormat {
+                friend PackedSigProcFormat;
+
+            protected:
+                ISigProcFormat(std::istream& is) : _is(is) {}
+
+            public:
+                template<typename T>
+                ISigProcFormat const& operator>>(T&) const;
+
+            protected:
+                std::istream& _is;
+        };
+
+    public:
+        PackedSigProcFormat() {}
+        OSigProcFormat operator<<(std::ostream&) const;
+        ISigProcFormat operator>>(std::istream&) const;
+};
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::OSigProcFormat operator<<(std::ostream& os, PackedSigProcFormat<Dimension1, Dimension2, NBits> const&);
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::ISigProcFormat operator>>(std::istream& os, PackedSigProcFormat<Dimension1, Dimension2, NBits> const&);
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "detail/PackedSigProcFormat.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_PACKEDSIGPROCFORMAT_H
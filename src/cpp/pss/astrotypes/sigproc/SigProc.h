@@ -29,8 +29,10 @@
  */
 #include "Header.h"
 #include "FileReader.h"
+#include "MappedFileReader.h"
 #include "DataFactory.h"
 #include "IStream.h"
 #include "OStream.h"
+#include "AsyncStreamReader.h"
 
 #endif // PSS_ASTROTYPES_SIGPROC_SIGPROC_H
@@ -25,6 +25,7 @@
 #define PSS_ASTROTYPES_SIGPROC_SIGPROCFORMAT_H
 
 #include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/units/Polarisation.h"
 #include <iostream>
 
 namespace pss {
@@ -73,6 +74,11 @@ class SigProcFormat<units::Time, units::Frequency>
                 typename std::enable_if<has_exact_dimensions<T, units::Frequency, units::Time>::value, OSigProcFormat const&>::type
                 operator<<(T const&) const;
 
+                /// write seperate polarisations interleaved for each channel
+                template<typename T>
+                typename std::enable_if<has_exact_dimensions<T, units::Time, units::Polarisation, units::Frequency>::value, OSigProcFormat const&>::type
+                operator<<(T const&) const;
+
             protected:
                 std::ostream& _os;
         };
@@ -95,6 +101,11 @@ class SigProcFormat<units::Time, units::Frequency>
                 typename std::enable_if<has_exact_dimensions<T, units::Frequency, units::Time>::value, ISigProcFormat const&>::type
                 operator>>(T&) const;
 
+                /// read polarisations interleaved for each channel (nifs > 1) into seperate blocks for each polarisation
+                template<typename T>
+                typename std::enable_if<has_exact_dimensions<T, units::Time, units::Polarisation, units::Frequency>::value, ISigProcFormat const&>::type
+                operator>>(T&) const;
+
             protected:
                 std::istream& _is;
         };
@@ -25,6 +25,7 @@
 #define PSS_ASTROTYPES_SIGPROC_SIGPROCFORMATADAPTERSELECTOR_H
 #include "Header.h"
 #include "SigProcFormat.h"
+#include "PackedSigProcFormat.h"
 
 namespace pss {
 namespace astrotypes {
@@ -32,27 +33,41 @@ namespace sigproc {
 
 /**
  * @brief static helper class to determine the type of SigProcFormat stream adapter
- *        given a DataaType from the Header::DataType
+ *        given a DataaType from the Header::DataType and the number of bits per sample
+ * @details data with less than 8 bits per sample uses the @ref PackedSigProcFormat adapters
  * @code
  *      typedef typename SigProcFormatAdapterSelector<Header::FilterBank>::type AdapterType;
+ *      typedef typename SigProcFormatAdapterSelector<Header::FilterBank, 4>::type FourBitAdapterType;
  * @endcode
  */
-template<Header::DataType HeaderDataType>
+template<Header::DataType HeaderDataType, unsigned NBits=8, bool Packed=(NBits < 8)>
 struct SigProcFormatAdapterSelector
 {};
 
-template<>
-struct SigProcFormatAdapterSelector<Header::DataType::FilterBank>
+template<unsigned NBits>
+struct SigProcFormatAdapterSelector<Header::DataType::FilterBank, NBits, false>
 {
     typedef SigProcFormat<units::Time, units::Frequency> type;
 };
 
-template<>
-struct SigProcFormatAdapterSelector<Header::DataType::TimeSeries>
+template<unsigned NBits>
+struct SigProcFormatAdapterSelector<Header::DataType::TimeSeries, NBits, false>
 {
     typedef SigProcFormat<units::Frequency, units::Time> type;
 };
 
+template<unsigned NBits>
+struct SigProcFormatAdapterSelector<Header::DataType::FilterBank, NBits, true>
+{
+    typedef PackedSigProcFormat<units::Time, units::Frequency, NBits> type;
+};
+
+template<unsigned NBits>
+struct SigProcFormatAdapterSelector<Header::DataType::TimeSeries, NBits, true>
+{
+    typedef PackedSigProcFormat<units::Frequency, units::Time, NBits> type;
+};
+
 } // namespace sigproc
 } // namespace astrotypes
 } // namespace pss
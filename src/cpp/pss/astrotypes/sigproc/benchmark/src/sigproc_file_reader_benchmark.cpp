@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/sigproc/FileReader.h"
+#include "pss/astrotypes/sigproc/MappedFileReader.h"
+#include "pss/astrotypes/sigproc/SigProc.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <unistd.h>
+
+/**
+ * Compares reading a filterbank file through the ifstream based FileReader with the
+ * memory mapped MappedFileReader. Each reads the data in windows of a fixed number of
+ * spectra and sums every sample so that the data is actually touched.
+ *
+ * usage: sigproc_file_reader_benchmark [filterbank_file] [window_size]
+ *
+ * If no (8 bit) file is given a temporary one of 4096 channels x 16384 spectra is generated.
+ * Note that the file will generally be in the page cache for both runs.
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+
+std::string generate_file(DimensionSize<Frequency> channels, DimensionSize<Time> spectra)
+{
+    char file_name[] = "/tmp/astrotypes_benchmark_XXXXXX";
+    int fd = mkstemp(file_name);
+    if(fd < 0) {
+        std::cerr << "error: unable to create temporary file" << std::endl;
+        std::exit(1);
+    }
+    close(fd);
+
+    sigproc::Header header;
+    header.number_of_channels(channels);
+    header.number_of_bits(8);
+    header.number_of_ifs(1);
+    header.data_type(sigproc::Header::DataType::FilterBank);
+
+    TimeFrequency<uint8_t> data(spectra, channels);
+    uint8_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n; });
+
+    std::ofstream os(file_name, std::ios::out | std::ios::binary);
+    os << header;
+    os << sigproc::SigProcFormat<Time, Frequency>() << data;
+    return file_name;
+}
+
+std::size_t read_ifstream(std::string const& file_name, DimensionSize<Time> window)
+{
+    sigproc::FileReader<> reader(file_name);
+    std::size_t const total_spectra = reader.dimension<Time>();
+    TimeFrequency<uint8_t> data(window, reader.dimension<Frequency>());
+    std::size_t sum = 0;
+    for(std::size_t spectrum = 0; spectrum + window <= total_spectra; spectrum += window) {
+        reader >> data;
+        sum = std::accumulate(data.cbegin(), data.cend(), sum);
+    }
+    return sum;
+}
+
+std::size_t read_mapped(std::string const& file_name, DimensionSize<Time> window)
+{
+    sigproc::MappedFileReader<> reader(file_name);
+    std::size_t const total_spectra = reader.dimension<Time>();
+    std::size_t sum = 0;
+    for(std::size_t spectrum = 0; spectrum + window <= total_spectra; spectrum += window) {
+        auto data = reader.next<uint8_t>(window);
+        sum = std::accumulate(data.cbegin(), data.cend(), sum);
+    }
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool const generated = (argc < 2);
+    std::string const file_name = generated ? generate_file(DimensionSize<Frequency>(4096), DimensionSize<Time>(16384)) : argv[1];
+    DimensionSize<Time> window(argc > 2 ? std::atoi(argv[2]) : 1024);
+
+    sigproc::FileReader<> reader(file_name);
+    if(reader.header().number_of_bits() != 8) {
+        std::cerr << "error: only 8 bit data is supported by this benchmark" << std::endl;
+        return 1;
+    }
+    double const bytes = (double)reader.number_of_data_points();
+
+    auto start = ClockType::now();
+    std::size_t const ifstream_sum = read_ifstream(file_name, window);
+    std::chrono::duration<double> ifstream_time = ClockType::now() - start;
+
+    start = ClockType::now();
+    std::size_t const mapped_sum = read_mapped(file_name, window);
+    std::chrono::duration<double> mapped_time = ClockType::now() - start;
+
+    if(generated) std::remove(file_name.c_str());
+
+    if(ifstream_sum != mapped_sum) {
+        std::cerr << "error: data read does not match" << std::endl;
+        return 1;
+    }
+
+    std::cout << "file=" << file_name << " window=" << window << " spectra (GB/s)\n";
+    std::cout << std::setw(16) << "ifstream" << std::setw(16) << "mmap" << "\n";
+    std::cout << std::setw(16) << bytes / ifstream_time.count() / 1e9
+              << std::setw(16) << bytes / mapped_time.count() / 1e9
+              << "\n";
+    return 0;
+}
@@ -0,0 +1,254 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+namespace {
+    // the number of bits each sample occupies in the stream
+    template<typename AdapterT, typename ValueT>
+    struct StreamSampleBits {
+        static constexpr std::size_t value = 8 * sizeof(ValueT);
+    };
+
+    template<typename Dimension1, typename Dimension2, unsigned NBits, typename ValueT>
+    struct StreamSampleBits<PackedSigProcFormat<Dimension1, Dimension2, NBits>, ValueT> {
+        static constexpr std::size_t value = NBits;
+    };
+} // namespace
+
+// ---------------- Chunk --------------------------
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::Chunk::Chunk(std::shared_ptr<SharedState> state, std::size_t index, DimensionSize<units::Time> number_of_spectra)
+    : _state(std::move(state))
+    , _index(index)
+    , _number_of_spectra(number_of_spectra)
+{
+}
+
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::Chunk::Chunk(Chunk&& chunk)
+    : _state(std::move(chunk._state))
+    , _index(chunk._index)
+    , _number_of_spectra(chunk._number_of_spectra)
+{
+}
+
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::Chunk::~Chunk()
+{
+    if(_state) _state->release(_index);
+}
+
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::Chunk::operator bool() const
+{
+    return _state != nullptr;
+}
+
+template<typename DataT, typename AdapterT>
+DataT& AsyncStreamReader<DataT, AdapterT>::Chunk::operator*() const
+{
+    return _state->buffers[_index];
+}
+
+template<typename DataT, typename AdapterT>
+DataT* AsyncStreamReader<DataT, AdapterT>::Chunk::operator->() const
+{
+    return &_state->buffers[_index];
+}
+
+template<typename DataT, typename AdapterT>
+DimensionSize<units::Time> AsyncStreamReader<DataT, AdapterT>::Chunk::number_of_spectra() const
+{
+    return _number_of_spectra;
+}
+
+template<typename DataT, typename AdapterT>
+bool AsyncStreamReader<DataT, AdapterT>::Chunk::partial() const
+{
+    return _state && _number_of_spectra < _state->buffers[_index].template dimension<units::Time>();
+}
+
+// ---------------- CountingStreamBuffer --------------------------
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::CountingStreamBuffer(std::streambuf* buffer)
+    : _buffer(buffer)
+    , _count(0)
+{
+}
+
+template<typename DataT, typename AdapterT>
+std::size_t AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::count() const
+{
+    return _count;
+}
+
+template<typename DataT, typename AdapterT>
+typename AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::int_type AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::underflow()
+{
+    return _buffer->sgetc();
+}
+
+template<typename DataT, typename AdapterT>
+typename AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::int_type AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::uflow()
+{
+    int_type c = _buffer->sbumpc();
+    if(!traits_type::eq_int_type(c, traits_type::eof())) ++_count;
+    return c;
+}
+
+template<typename DataT, typename AdapterT>
+std::streamsize AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::xsgetn(char_type* s, std::streamsize n)
+{
+    std::streamsize const read = _buffer->sgetn(s, n);
+    _count += read;
+    return read;
+}
+
+template<typename DataT, typename AdapterT>
+std::streamsize AsyncStreamReader<DataT, AdapterT>::CountingStreamBuffer::showmanyc()
+{
+    return _buffer->in_avail();
+}
+
+// ---------------- SharedState --------------------------
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::SharedState::SharedState(DataT const& prototype, std::size_t number_of_buffers)
+    : buffers(number_of_buffers, prototype)
+    , end_of_stream(false)
+    , stop(false)
+{
+    for(std::size_t i = 0; i < buffers.size(); ++i) {
+        free.push_back(i);
+    }
+}
+
+template<typename DataT, typename AdapterT>
+void AsyncStreamReader<DataT, AdapterT>::SharedState::release(std::size_t index)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        free.push_back(index);
+    }
+    free_condition.notify_one();
+}
+
+// ---------------- AsyncStreamReader --------------------------
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::AsyncStreamReader(std::istream& stream, DataT const& prototype, std::size_t number_of_buffers)
+    : _stream_buffer(stream.rdbuf())
+    , _stream(&_stream_buffer)
+    , _sample_bits(StreamSampleBits<AdapterT, typename std::decay<decltype(*prototype.begin())>::type>::value)
+    , _state(std::make_shared<SharedState>(prototype, std::max(number_of_buffers, std::size_t(2))))
+{
+    _thread = std::thread(&AsyncStreamReader::run, this);
+}
+
+template<typename DataT, typename AdapterT>
+AsyncStreamReader<DataT, AdapterT>::~AsyncStreamReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->stop = true;
+    }
+    _state->free_condition.notify_all();
+    _thread.join();
+}
+
+template<typename DataT, typename AdapterT>
+void AsyncStreamReader<DataT, AdapterT>::run()
+{
+    SharedState& state = *_state;
+    AdapterT adapter;
+    try {
+        while(true) {
+            std::size_t index;
+            {
+                std::unique_lock<std::mutex> lock(state.mutex);
+                state.free_condition.wait(lock, [&state]() { return state.stop || !state.free.empty(); });
+                if(state.stop) return;
+                index = state.free.front();
+                state.free.pop_front();
+            }
+
+            // read outside the lock
+            DataT& data = state.buffers[index];
+            std::size_t const start = _stream_buffer.count();
+            _stream >> adapter >> data;
+            std::size_t const number_of_samples = std::min(data.data_size(), (_stream_buffer.count() - start) * 8 / _sample_bits);
+            bool const end_of_stream = !_stream || number_of_samples < data.data_size();
+
+            // only whole spectra are reported, whatever the memory order of the data
+            std::size_t const samples_per_spectrum = data.data_size() / static_cast<std::size_t>(data.template dimension<units::Time>());
+            DimensionSize<units::Time> const number_of_spectra(number_of_samples / samples_per_spectrum);
+
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if(number_of_spectra > DimensionSize<units::Time>(0)) {
+                    state.filled.push_back(Filled{index, number_of_spectra});
+                }
+                else {
+                    state.free.push_back(index);
+                }
+                state.end_of_stream = end_of_stream;
+            }
+            state.filled_condition.notify_one();
+            if(end_of_stream) return;
+        }
+    }
+    catch(...) {
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.exception = std::current_exception();
+            state.end_of_stream = true;
+        }
+        state.filled_condition.notify_one();
+    }
+}
+
+template<typename DataT, typename AdapterT>
+typename AsyncStreamReader<DataT, AdapterT>::Chunk AsyncStreamReader<DataT, AdapterT>::next()
+{
+    SharedState& state = *_state;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.filled_condition.wait(lock, [&state]() { return !state.filled.empty() || state.end_of_stream; });
+    if(state.filled.empty()) {
+        if(state.exception) {
+            std::exception_ptr e = state.exception;
+            state.exception = nullptr;
+            std::rethrow_exception(e);
+        }
+        return Chunk(nullptr, 0, DimensionSize<units::Time>(0));
+    }
+    Filled const filled = state.filled.front();
+    state.filled.pop_front();
+    return Chunk(_state, filled.index, filled.number_of_spectra);
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
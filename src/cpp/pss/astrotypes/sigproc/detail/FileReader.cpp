@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <sys/stat.h>
 
 namespace pss {
 namespace astrotypes {
@@ -104,6 +105,15 @@ struct DimensionHelper<units::Frequency> {
     }
 };
 
+template<>
+struct DimensionHelper<units::Polarisation> {
+    template<typename HeaderType>
+    inline static DimensionSize<units::Polarisation> exec(FileReader<HeaderType> const& fr)
+    {
+        return DimensionSize<units::Polarisation>(fr.header().number_of_ifs());
+    }
+};
+
 } // namespace
 template<typename HeaderType>
 template<typename Dimension>
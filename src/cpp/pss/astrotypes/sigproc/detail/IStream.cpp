@@ -2,12 +2,12 @@ namespace pss {
 namespace astrotypes {
 namespace sigproc {
 
-template<Header::DataType HeaderDataType>
-typename AdaptedIStream<HeaderDataType>::AdapterType AdaptedIStream<HeaderDataType>::_adapter;
+template<Header::DataType HeaderDataType, unsigned NBits>
+typename AdaptedIStream<HeaderDataType, NBits>::AdapterType AdaptedIStream<HeaderDataType, NBits>::_adapter;
 
-template<Header::DataType HeaderDataType>
+template<Header::DataType HeaderDataType, unsigned NBits>
 template<typename Stream, typename DataType>
-void AdaptedIStream<HeaderDataType>::read(Stream& stream, DataType& data)
+void AdaptedIStream<HeaderDataType, NBits>::read(Stream& stream, DataType& data)
 {
     stream >> _adapter >> data;
 }
@@ -32,16 +32,37 @@ void IStream<HeaderT>::read(Stream& stream, DataType& data)
     switch(_header.data_type())
     {
         case HeaderT::DataType::FilterBank:
-            AdaptedIStream<HeaderT::DataType::FilterBank>::read(stream, data);
+            read_adapted<HeaderT::DataType::FilterBank>(stream, data);
             break;
         case HeaderT::DataType::TimeSeries:
-            AdaptedIStream<HeaderT::DataType::TimeSeries>::read(stream, data);
+            read_adapted<HeaderT::DataType::TimeSeries>(stream, data);
             break;
         default:
             throw std::runtime_error("unkonwn data type setting");
     }
 }
 
+template<typename HeaderT>
+template<Header::DataType HeaderDataType, typename Stream, typename DataType>
+void IStream<HeaderT>::read_adapted(Stream& stream, DataType& data)
+{
+    switch(_header.number_of_bits())
+    {
+        case 1:
+            AdaptedIStream<HeaderDataType, 1>::read(stream, data);
+            break;
+        case 2:
+            AdaptedIStream<HeaderDataType, 2>::read(stream, data);
+            break;
+        case 4:
+            AdaptedIStream<HeaderDataType, 4>::read(stream, data);
+            break;
+        default:
+            AdaptedIStream<HeaderDataType>::read(stream, data);
+            break;
+    }
+}
+
 } // namespace sigproc
 } // namespace astrotypes
 } // namespace pss
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+template<typename HeaderType>
+MappedFileReader<HeaderType>::MappedFileReader()
+    : _fd(-1)
+    , _data_size(0)
+    , _advice(Advice::Sequential)
+    , _position(0)
+{
+}
+
+template<typename HeaderType>
+MappedFileReader<HeaderType>::MappedFileReader(std::string const& file_name, Advice advice)
+    : _fd(-1)
+    , _data_size(0)
+    , _advice(advice)
+    , _position(0)
+{
+    do_open(file_name);
+}
+
+template<typename HeaderType>
+MappedFileReader<HeaderType>::~MappedFileReader()
+{
+    close();
+}
+
+template<typename HeaderType>
+void MappedFileReader<HeaderType>::open(std::string const& file_name)
+{
+    close();
+    do_open(file_name);
+}
+
+template<typename HeaderType>
+void MappedFileReader<HeaderType>::close()
+{
+    if(_fd >= 0) ::close(_fd);
+    _fd = -1;
+    _data_size = 0;
+    _position = DimensionIndex<units::Time>(0);
+}
+
+template<typename HeaderType>
+void MappedFileReader<HeaderType>::do_open(std::string const& file_name)
+{
+    {
+        std::ifstream stream(file_name, std::ios::in | std::ios::binary);
+        if(!stream) throw std::runtime_error(file_name + " failed to open");
+        this->new_header(stream);
+    }
+
+    _fd = ::open(file_name.c_str(), O_RDONLY);
+    if(_fd < 0) throw std::runtime_error(file_name + " failed to open");
+
+    struct stat file_info;
+    if(fstat(_fd, &file_info) != 0) {
+        close();
+        throw std::runtime_error(file_name + " unable to determine file size");
+    }
+    std::size_t const header_size = this->_header.size();
+    _data_size = (static_cast<std::size_t>(file_info.st_size) > header_size) ? file_info.st_size - header_size : 0;
+}
+
+template<typename HeaderType>
+void MappedFileReader<HeaderType>::advise(Advice advice)
+{
+    _advice = advice;
+}
+
+template<typename HeaderType>
+template<typename T>
+typename MappedFileReader<HeaderType>::template TimeFrequencyType<T> MappedFileReader<HeaderType>::map(DimensionIndex<units::Time> start, DimensionSize<units::Time> number_of_spectra) const
+{
+    if(_fd < 0) throw std::runtime_error("MappedFileReader: no file open");
+    if(sizeof(T) * 8 != this->_header.number_of_bits()) throw std::runtime_error("MappedFileReader: requested type does not match the nbits of the data");
+    if(this->_header.number_of_ifs() != 1) throw std::runtime_error("MappedFileReader: multiple IF data is not supported");
+
+    DimensionSize<units::Frequency> const number_of_channels = this->_header.number_of_channels();
+    DimensionSize<units::Time> const total_spectra = dimension<units::Time>();
+    std::size_t const first = std::min(static_cast<std::size_t>(start), static_cast<std::size_t>(total_spectra));
+    number_of_spectra = DimensionSize<units::Time>(std::min(static_cast<std::size_t>(number_of_spectra), static_cast<std::size_t>(total_spectra) - first));
+
+    std::size_t const spectrum_bytes = static_cast<std::size_t>(number_of_channels) * sizeof(T);
+    std::shared_ptr<MappedRegion> region = std::make_shared<MappedRegion>(_fd
+                                                                        , this->_header.size() + first * spectrum_bytes
+                                                                        , static_cast<std::size_t>(number_of_spectra) * spectrum_bytes);
+    region->advise(_advice);
+    return TimeFrequencyType<T>(MappedAllocator<T>(region), number_of_spectra, number_of_channels);
+}
+
+template<typename HeaderType>
+template<typename T>
+typename MappedFileReader<HeaderType>::template TimeFrequencyType<T> MappedFileReader<HeaderType>::next(DimensionSize<units::Time> number_of_spectra)
+{
+    TimeFrequencyType<T> data = map<T>(_position, number_of_spectra);
+    _position = DimensionIndex<units::Time>(_position + data.template dimension<units::Time>());
+    return data;
+}
+
+template<typename HeaderType>
+std::size_t MappedFileReader<HeaderType>::number_of_data_points() const
+{
+    return _data_size * 8 / this->_header.number_of_bits();
+}
+
+template<typename HeaderType>
+template<typename Dimension>
+DimensionSize<Dimension> MappedFileReader<HeaderType>::dimension() const
+{
+    static_assert(std::is_same<Dimension, units::Time>::value || std::is_same<Dimension, units::Frequency>::value, "dimension not supported");
+    if(std::is_same<Dimension, units::Frequency>::value) return DimensionSize<Dimension>(static_cast<std::size_t>(this->_header.number_of_channels()));
+    std::size_t const spectrum_size = this->_header.number_of_ifs() * this->_header.number_of_channels();
+    return DimensionSize<Dimension>(spectrum_size ? number_of_data_points() / spectrum_size : 0);
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+inline MappedRegion::MappedRegion(int fd, std::size_t offset, std::size_t length)
+    : _base(nullptr)
+    , _base_length(0)
+    , _data(nullptr)
+    , _length(length)
+{
+    // mmap requires a page aligned offset
+    std::size_t const page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t const base_offset = offset - (offset % page_size);
+    _base_length = length + (offset - base_offset);
+    if(_base_length == 0) return;
+
+    // private mapping: any writes to the data are local to this process and never reach the file
+    _base = mmap(nullptr, _base_length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(base_offset));
+    if(_base == MAP_FAILED) {
+        _base = nullptr;
+        throw std::runtime_error(std::string("mmap failed: ") + std::strerror(errno));
+    }
+    _data = static_cast<char*>(_base) + (offset - base_offset);
+}
+
+inline MappedRegion::~MappedRegion()
+{
+    if(_base) munmap(_base, _base_length);
+}
+
+inline char* MappedRegion::data() const
+{
+    return _data;
+}
+
+inline std::size_t MappedRegion::size() const
+{
+    return _length;
+}
+
+inline void MappedRegion::advise(Advice advice) const
+{
+    if(!_base) return;
+    int flag = MADV_NORMAL;
+    switch(advice)
+    {
+        case Advice::Normal:
+            flag = MADV_NORMAL;
+            break;
+        case Advice::Sequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case Advice::Random:
+            flag = MADV_RANDOM;
+            break;
+        case Advice::WillNeed:
+            flag = MADV_WILLNEED;
+            break;
+        case Advice::DontNeed:
+            flag = MADV_DONTNEED;
+            break;
+    }
+    // only a hint, so failure is not an error
+    madvise(_base, _base_length, flag);
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
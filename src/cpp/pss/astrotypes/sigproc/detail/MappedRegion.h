@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_MAPPEDREGION_H
+#define PSS_ASTROTYPES_SIGPROC_MAPPEDREGION_H
+
+#include "pss/astrotypes/multiarray/PointerAllocator.h"
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+/**
+ * @brief
+ *    A read only (copy on write) memory mapping of a section of a file
+ *
+ * @details
+ *    The offset need not be page aligned. The mapping is released on destruction.
+ */
+class MappedRegion
+{
+    public:
+        /// kernel access pattern hints (see madvise(2))
+        enum class Advice { Normal, Sequential, Random, WillNeed, DontNeed };
+
+    public:
+        /**
+         * @brief map length bytes of the open file descriptor fd starting from offset
+         * @throw std::runtime_error if the mapping fails
+         */
+        MappedRegion(int fd, std::size_t offset, std::size_t length);
+        MappedRegion(MappedRegion const&) = delete;
+        MappedRegion& operator=(MappedRegion const&) = delete;
+        ~MappedRegion();
+
+        /// pointer to the first byte of the requested region
+        char* data() const;
+
+        /// the number of bytes in the requested region
+        std::size_t size() const;
+
+        /// pass on an access pattern hint to the kernel for this region
+        void advise(Advice advice) const;
+
+    private:
+        void* _base;
+        std::size_t _base_length;
+        char* _data;
+        std::size_t _length;
+};
+
+/**
+ * @extends PointerAllocator<T>
+ * @brief Allocator handing out the memory of a @ref MappedRegion
+ * @details Keeps the mapping alive for as long as the allocator (or any copy of it) exists.
+ *          Default construction of elements is a no-op so that containers sized against the
+ *          mapping leave the mapped data untouched (and unread).
+ *          A copy constructed container does not share the mapping: it is given an allocator
+ *          without a region that allocates from the heap.
+ */
+template<typename T>
+class MappedAllocator : public PointerAllocator<T>
+{
+        typedef PointerAllocator<T> BaseT;
+
+    public:
+        using value_type = T;
+
+    public:
+        explicit MappedAllocator(std::shared_ptr<MappedRegion> const& region) noexcept
+            : BaseT(reinterpret_cast<T*>(region->data()))
+            , _region(region)
+        {
+        }
+
+        /// the mapped memory, or heap memory if there is no region
+        T* allocate(std::size_t n)
+        {
+            if(_region) return BaseT::allocate(n);
+            return StandardAllocator<T>::allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if(_region) return BaseT::deallocate(p, n);
+            StandardAllocator<T>::deallocate(p, n);
+        }
+
+        /// copies of a container get their own (heap) memory rather than aliasing the mapping
+        MappedAllocator select_on_container_copy_construction() const
+        {
+            return MappedAllocator();
+        }
+
+        /// leave the mapped data as it is
+        template<typename U>
+        void construct(U*) noexcept
+        {
+        }
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+
+        /// the underlying mapping (only valid if mapped() is true)
+        MappedRegion const& region() const
+        {
+            return *_region;
+        }
+
+        /// true if the memory handed out is that of a MappedRegion
+        bool mapped() const
+        {
+            return static_cast<bool>(_region);
+        }
+
+    private:
+        MappedAllocator() noexcept
+            : BaseT(nullptr)
+        {
+        }
+
+    private:
+        std::shared_ptr<MappedRegion> _region;
+};
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+#include "MappedRegion.cpp"
+
+#endif // PSS_ASTROTYPES_SIGPROC_MAPPEDREGION_H
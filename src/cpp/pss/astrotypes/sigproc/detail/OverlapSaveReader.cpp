@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <stdexcept>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+template<typename T, typename ReaderT>
+OverlapSaveReader<T, ReaderT>::OverlapSaveReader(ReaderT& reader
+                                                , DimensionSize<units::Time> chunk_size
+                                                , DimensionSize<units::Time> overlap
+                                                , std::size_t buffer_chunks)
+    : _reader(reader)
+    , _chunk_size(chunk_size)
+    , _overlap(overlap)
+    , _spectra_remaining(reader.template dimension<units::Time>())
+    , _offset(0)
+    , _length(0)
+    , _start(0)
+    , _started(false)
+{
+    if(_overlap >= _chunk_size) {
+        throw std::invalid_argument("OverlapSaveReader: the overlap must be smaller than the chunk size");
+    }
+    std::size_t const step = _chunk_size - _overlap;
+    _buffer.resize(DimensionSize<units::Time>(_overlap + std::max<std::size_t>(1, buffer_chunks) * step)
+                  , reader.template dimension<units::Frequency>());
+}
+
+template<typename T, typename ReaderT>
+bool OverlapSaveReader<T, ReaderT>::next()
+{
+    std::size_t const step = _chunk_size - _overlap;
+    std::size_t keep = 0; // spectra carried over from the previous chunk
+    if(_started) {
+        // a short chunk means we have already reached the end
+        if(_length < _chunk_size || _spectra_remaining == 0) return false;
+        _offset += step;
+        _start += step;
+        keep = _overlap;
+    }
+
+    std::size_t const count = std::min(_chunk_size - keep, _spectra_remaining);
+    if(count == 0) return false;
+
+    if(_offset + keep + count > static_cast<std::size_t>(_buffer.number_of_spectra())) {
+        // out of buffer: move the overlap back to the beginning
+        auto const begin = _buffer.begin();
+        std::size_t const channels = _buffer.number_of_channels();
+        std::copy(begin + _offset * channels, begin + (_offset + keep) * channels, begin);
+        _offset = 0;
+    }
+
+    auto new_data = _buffer.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(_offset + keep), DimensionSize<units::Time>(count)));
+    _reader >> new_data;
+    _spectra_remaining -= count;
+    _length = keep + count;
+    _started = true;
+    return true;
+}
+
+template<typename T, typename ReaderT>
+typename OverlapSaveReader<T, ReaderT>::ChunkType OverlapSaveReader<T, ReaderT>::chunk() const
+{
+    return _buffer.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(_offset), DimensionSize<units::Time>(_length)));
+}
+
+template<typename T, typename ReaderT>
+DimensionIndex<units::Time> OverlapSaveReader<T, ReaderT>::start() const
+{
+    return DimensionIndex<units::Time>(_start);
+}
+
+template<typename T, typename ReaderT>
+DimensionSize<units::Time> OverlapSaveReader<T, ReaderT>::chunk_size() const
+{
+    return DimensionSize<units::Time>(_chunk_size);
+}
+
+template<typename T, typename ReaderT>
+DimensionSize<units::Time> OverlapSaveReader<T, ReaderT>::overlap() const
+{
+    return DimensionSize<units::Time>(_overlap);
+}
+
+template<typename T, typename HeaderType>
+OverlapSaveReader<T, MappedFileReader<HeaderType>>::OverlapSaveReader(MappedFileReader<HeaderType>& reader
+                                                                      , DimensionSize<units::Time> chunk_size
+                                                                      , DimensionSize<units::Time> overlap
+                                                                      , std::size_t)
+    : _reader(reader)
+    , _chunk_size(chunk_size)
+    , _overlap(overlap)
+    , _start(0)
+{
+    if(_overlap >= _chunk_size) {
+        throw std::invalid_argument("OverlapSaveReader: the overlap must be smaller than the chunk size");
+    }
+}
+
+template<typename T, typename HeaderType>
+bool OverlapSaveReader<T, MappedFileReader<HeaderType>>::next()
+{
+    std::size_t start = 0;
+    std::size_t keep = 0; // spectra carried over from the previous chunk
+    if(_window) {
+        // a short chunk means we have already reached the end
+        if(static_cast<std::size_t>(_window->number_of_spectra()) < _chunk_size) return false;
+        start = _start + _chunk_size - _overlap;
+        keep = _overlap;
+    }
+    if(start + keep >= static_cast<std::size_t>(_reader.template dimension<units::Time>())) return false;
+
+    _window.reset(new WindowType(_reader.template map<T>(DimensionIndex<units::Time>(start), DimensionSize<units::Time>(_chunk_size))));
+    _start = start;
+    return true;
+}
+
+template<typename T, typename HeaderType>
+typename OverlapSaveReader<T, MappedFileReader<HeaderType>>::ChunkType OverlapSaveReader<T, MappedFileReader<HeaderType>>::chunk() const
+{
+    WindowType const& window = *_window;
+    return window.slice(DimensionSpan<units::Time>(window.template dimension<units::Time>()));
+}
+
+template<typename T, typename HeaderType>
+DimensionIndex<units::Time> OverlapSaveReader<T, MappedFileReader<HeaderType>>::start() const
+{
+    return DimensionIndex<units::Time>(_start);
+}
+
+template<typename T, typename HeaderType>
+DimensionSize<units::Time> OverlapSaveReader<T, MappedFileReader<HeaderType>>::chunk_size() const
+{
+    return DimensionSize<units::Time>(_chunk_size);
+}
+
+template<typename T, typename HeaderType>
+DimensionSize<units::Time> OverlapSaveReader<T, MappedFileReader<HeaderType>>::overlap() const
+{
+    return DimensionSize<units::Time>(_overlap);
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
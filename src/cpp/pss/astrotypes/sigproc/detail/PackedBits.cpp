@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+template<unsigned NBits>
+constexpr unsigned PackedBits<NBits>::samples_per_byte;
+
+template<unsigned NBits>
+constexpr uint8_t PackedBits<NBits>::mask;
+
+template<unsigned NBits>
+template<typename T>
+void PackedBits<NBits>::unpack(uint8_t const* packed, std::size_t number_of_samples, T* out)
+{
+    std::size_t const full_bytes = number_of_samples / samples_per_byte;
+    for(std::size_t i = 0; i < full_bytes; ++i) {
+        uint8_t const byte = packed[i];
+        for(unsigned j = 0; j < samples_per_byte; ++j) {
+            out[j] = static_cast<T>((byte >> (j * NBits)) & mask);
+        }
+        out += samples_per_byte;
+    }
+
+    // remaining samples in a partially filled byte
+    std::size_t const remainder = number_of_samples - full_bytes * samples_per_byte;
+    for(unsigned j = 0; j < remainder; ++j) {
+        out[j] = static_cast<T>((packed[full_bytes] >> (j * NBits)) & mask);
+    }
+}
+
+template<unsigned NBits>
+template<typename T>
+void PackedBits<NBits>::pack(T const* in, std::size_t number_of_samples, uint8_t* packed)
+{
+    std::size_t const full_bytes = number_of_samples / samples_per_byte;
+    for(std::size_t i = 0; i < full_bytes; ++i) {
+        uint8_t byte = 0;
+        for(unsigned j = 0; j < samples_per_byte; ++j) {
+            byte |= static_cast<uint8_t>((static_cast<unsigned>(in[j]) & mask) << (j * NBits));
+        }
+        packed[i] = byte;
+        in += samples_per_byte;
+    }
+
+    std::size_t const remainder = number_of_samples - full_bytes * samples_per_byte;
+    if(remainder) {
+        uint8_t byte = 0;
+        for(unsigned j = 0; j < remainder; ++j) {
+            byte |= static_cast<uint8_t>((static_cast<unsigned>(in[j]) & mask) << (j * NBits));
+        }
+        packed[full_bytes] = byte;
+    }
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ScratchBuffer.h"
+#include <algorithm>
+#include <stdexcept>
+#include <streambuf>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+
+namespace {
+    // number of packed bytes staged at a time between the packed stream and the unpacked format
+    constexpr std::size_t packed_block_bytes = 1 << 14;
+
+    // input stream buffer presenting number_of_samples packed samples of is as unpacked ValueT's,
+    // unpacking one fixed size block at a time
+    template<typename PackedBitsT, typename ValueT>
+    class UnpackingStreamBuffer : public std::streambuf
+    {
+            static constexpr std::size_t block_samples = packed_block_bytes * PackedBitsT::samples_per_byte;
+
+        public:
+            UnpackingStreamBuffer(std::istream& is, std::size_t number_of_samples)
+                : _is(is)
+                , _remaining(number_of_samples)
+                , _packed(packed_block_bytes)
+                , _unpacked(block_samples)
+            {
+            }
+
+        protected:
+            int_type underflow() override
+            {
+                if(_remaining == 0) return traits_type::eof();
+                std::size_t const n = std::min(_remaining, static_cast<std::size_t>(block_samples));
+                _is.read(reinterpret_cast<char*>(_packed.data()), PackedBitsT::bytes(n));
+                std::size_t const samples = std::min(n, static_cast<std::size_t>(_is.gcount()) * PackedBitsT::samples_per_byte);
+                _remaining = (samples == n) ? _remaining - n : 0;
+                if(samples == 0) return traits_type::eof();
+
+                PackedBitsT::unpack(_packed.data(), samples, _unpacked.data());
+                char* const begin = reinterpret_cast<char*>(_unpacked.data());
+                setg(begin, begin, begin + samples * sizeof(ValueT));
+                return traits_type::to_int_type(*begin);
+            }
+
+        private:
+            std::istream& _is;
+            std::size_t _remaining;
+            detail::ScratchBuffer<uint8_t, 1> _packed;
+            detail::ScratchBuffer<ValueT, 2> _unpacked;
+    };
+
+    // output stream buffer accepting unpacked ValueT's and writing them packed to os,
+    // packing one fixed size block at a time
+    template<typename PackedBitsT, typename ValueT>
+    class PackingStreamBuffer : public std::streambuf
+    {
+            static constexpr std::size_t block_samples = packed_block_bytes * PackedBitsT::samples_per_byte;
+
+        public:
+            PackingStreamBuffer(std::ostream& os)
+                : _os(os)
+                , _packed(packed_block_bytes)
+                , _unpacked(block_samples)
+            {
+                char* const begin = reinterpret_cast<char*>(_unpacked.data());
+                setp(begin, begin + block_samples * sizeof(ValueT));
+            }
+
+        protected:
+            int_type overflow(int_type c) override
+            {
+                write_block();
+                if(!traits_type::eq_int_type(c, traits_type::eof())) {
+                    *pptr() = traits_type::to_char_type(c);
+                    pbump(1);
+                }
+                return traits_type::not_eof(c);
+            }
+
+            int sync() override
+            {
+                write_block();
+                return _os ? 0 : -1;
+            }
+
+        private:
+            void write_block()
+            {
+                std::size_t const samples = (pptr() - pbase()) / sizeof(ValueT);
+                if(samples == 0) return;
+                PackedBitsT::pack(_unpacked.data(), samples, _packed.data());
+                _os.write(reinterpret_cast<const char*>(_packed.data()), PackedBitsT::bytes(samples));
+                setp(pbase(), epptr());
+            }
+
+        private:
+            std::ostream& _os;
+            detail::ScratchBuffer<uint8_t, 1> _packed;
+            detail::ScratchBuffer<ValueT, 2> _unpacked;
+    };
+
+    // each chunk is packed independently so it must fill a whole number of bytes
+    template<typename PackedBitsT>
+    void check_whole_bytes(std::size_t number_of_samples)
+    {
+        if(number_of_samples % PackedBitsT::samples_per_byte != 0) {
+            throw std::invalid_argument("PackedSigProcFormat: number of samples is not a whole number of bytes");
+        }
+    }
+} // namespace
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+template<typename T>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::ISigProcFormat const& PackedSigProcFormat<Dimension1, Dimension2, NBits>::ISigProcFormat::operator>>(T& data) const
+{
+    typedef typename std::decay<decltype(*data.begin())>::type ValueType;
+    std::size_t const number_of_samples = data.data_size();
+    check_whole_bytes<PackedBitsType>(number_of_samples);
+
+    // unpack on the fly and pass on to the unpacked format to take care of any reordering
+    UnpackingStreamBuffer<PackedBitsType, ValueType> buffer(_is, number_of_samples);
+    std::istream unpacked_stream(&buffer);
+    unpacked_stream >> UnpackedFormat() >> data;
+    return *this;
+}
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+template<typename T>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::OSigProcFormat const& PackedSigProcFormat<Dimension1, Dimension2, NBits>::OSigProcFormat::operator<<(T const& data) const
+{
+    typedef typename std::decay<decltype(*data.begin())>::type ValueType;
+    std::size_t const number_of_samples = data.data_size();
+    check_whole_bytes<PackedBitsType>(number_of_samples);
+
+    // use the unpacked format to take care of any reordering, packing on the fly
+    PackingStreamBuffer<PackedBitsType, ValueType> buffer(_os);
+    std::ostream unpacked_stream(&buffer);
+    unpacked_stream << UnpackedFormat() << data;
+    buffer.pubsync();
+    return *this;
+}
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::OSigProcFormat PackedSigProcFormat<Dimension1, Dimension2, NBits>::operator<<(std::ostream& os) const
+{
+    return OSigProcFormat(os);
+}
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::ISigProcFormat PackedSigProcFormat<Dimension1, Dimension2, NBits>::operator>>(std::istream& is) const
+{
+    return ISigProcFormat(is);
+}
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::OSigProcFormat operator<<(std::ostream& os, PackedSigProcFormat<Dimension1, Dimension2, NBits> const& f)
+{
+    return f << os;
+}
+
+template<typename Dimension1, typename Dimension2, unsigned NBits>
+typename PackedSigProcFormat<Dimension1, Dimension2, NBits>::ISigProcFormat operator>>(std::istream& is, PackedSigProcFormat<Dimension1, Dimension2, NBits> const& f)
+{
+    return f >> is;
+}
+
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_SIGPROC_DETAIL_SCRATCHBUFFER_H
+#define PSS_ASTROTYPES_SIGPROC_DETAIL_SCRATCHBUFFER_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace detail {
+
+/**
+ * @brief the largest scratch allocation (in bytes) that is kept alive between uses
+ */
+constexpr std::size_t scratch_buffer_max_bytes = 1 << 24;
+
+/**
+ * @brief Per thread scratch memory for reordering/unpacking data on its way to/from a stream
+ * @details Requests of up to scratch_buffer_max_bytes are served from memory kept for the lifetime
+ *          of the thread, so repeated reads of the same sized chunks do not allocate.
+ *          Larger requests get their own memory which is released when the ScratchBuffer goes out
+ *          of scope, so a single oversized chunk does not pin memory for the rest of the thread.
+ *          Use a different Tag for each buffer of the same type that is required at the same time.
+ */
+template<typename T, unsigned Tag=0>
+class ScratchBuffer
+{
+    public:
+        /**
+         * @param size the minimum number of elements required (contents unspecified)
+         */
+        explicit ScratchBuffer(std::size_t size)
+        {
+            if(size * sizeof(T) > scratch_buffer_max_bytes) {
+                _owned.reset(new T[size]);
+                _data = _owned.get();
+            }
+            else {
+                static thread_local std::vector<T> buffer;
+                if(buffer.size() < size) buffer.resize(size);
+                _data = buffer.data();
+            }
+        }
+
+        ScratchBuffer(ScratchBuffer const&) = delete;
+        ScratchBuffer& operator=(ScratchBuffer const&) = delete;
+
+        /**
+         * @brief pointer to the start of the scratch memory
+         */
+        T* data() const { return _data; }
+
+    private:
+        std::unique_ptr<T[]> _owned;
+        T* _data;
+};
+
+} // namespace detail
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
+
+#endif // PSS_ASTROTYPES_SIGPROC_DETAIL_SCRATCHBUFFER_H
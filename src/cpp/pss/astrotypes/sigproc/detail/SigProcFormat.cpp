@@ -22,13 +22,20 @@
  * SOFTWARE.
  */
 
+#include "ScratchBuffer.h"
+#include "pss/astrotypes/types/Stokes.h"
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
 namespace pss {
 namespace astrotypes {
 namespace sigproc {
 
 namespace {
     //should work with any iterator
-    template<typename IteratorType, typename IteratorTag, typename ValueType>
+    template<typename IteratorType, bool Contiguous, typename ValueType>
     struct do_write {
         static void exec(IteratorType begin, IteratorType const end, std::ostream& os) {
             while(begin != end) {
@@ -39,8 +46,9 @@ namespace {
     };
 
     // we can speed things up if the memory is contiguous
+    // (random access alone is not enough e.g. a strided Slice iterator)
     template<typename IteratorType, typename ValueType>
-    struct do_write<IteratorType, std::random_access_iterator_tag, ValueType>
+    struct do_write<IteratorType, true, ValueType>
     {
 
         static void exec(IteratorType begin, IteratorType const end, std::ostream& os) {
@@ -48,7 +56,7 @@ namespace {
         }
     };
 
-    template<typename IteratorType, typename IteratorTag, typename ValueType>
+    template<typename IteratorType, bool Contiguous, typename ValueType>
     struct do_read {
         static void exec(IteratorType begin, IteratorType const end, std::istream& is) {
             while(begin != end) {
@@ -59,18 +67,24 @@ namespace {
     };
 
     template<typename IteratorType, typename ValueType>
-    struct do_read<IteratorType, std::random_access_iterator_tag, ValueType>
+    struct do_read<IteratorType, true, ValueType>
     {
         static void exec(IteratorType begin, IteratorType const end, std::istream& is) {
             is.read(reinterpret_cast<char*>(&(*begin)), std::distance(begin, end) * sizeof(ValueType));
         }
     };
 
+    // only raw pointers are known to address contiguous memory
+    template<typename IteratorType>
+    struct is_contiguous_iterator : std::is_pointer<typename std::remove_reference<IteratorType>::type>
+    {
+    };
+
     // calls the correct specialization
     template<typename IteratorType>
     void write(IteratorType begin, IteratorType const end, std::ostream& os) {
         do_write<IteratorType
-                , typename std::iterator_traits<typename std::remove_reference<IteratorType>::type>::iterator_category
+                , is_contiguous_iterator<IteratorType>::value
                 , typename std::iterator_traits<typename std::remove_reference<IteratorType>::type>::value_type
                 >::exec(begin, end, os);
     }
@@ -78,17 +92,270 @@ namespace {
     template<typename IteratorType>
     void read(IteratorType begin, IteratorType const end, std::istream& is) {
         do_read<IteratorType
-               , typename std::iterator_traits<typename std::remove_reference<IteratorType>::type>::iterator_category
+               , is_contiguous_iterator<IteratorType>::value
                , typename std::iterator_traits<typename std::remove_reference<IteratorType>::type>::value_type
                >::exec(begin, end, is);
     }
+
+    // upper limit on the scratch memory used to reorder data between file and memory ordering
+    constexpr std::size_t staging_buffer_bytes = 1 << 20;
+
+    // number of blocks of block_size elements that will fit in the staging buffer
+    template<typename ValueType>
+    std::size_t staging_blocks(std::size_t block_size) {
+        std::size_t const n = staging_buffer_bytes / (block_size * sizeof(ValueType));
+        return (n == 0) ? 1 : n;
+    }
+
+    struct ReadRun {
+        ReadRun(std::istream& is) : _is(is) {}
+
+        template<typename T>
+        void operator()(T* begin, T* end) const {
+            _is.read(reinterpret_cast<char*>(begin), (end - begin) * sizeof(T));
+        }
+
+        std::istream& _is;
+    };
+
+    struct WriteRun {
+        WriteRun(std::ostream& os) : _os(os) {}
+
+        template<typename T>
+        void operator()(T const* begin, T const* end) const {
+            _os.write(reinterpret_cast<const char*>(begin), (end - begin) * sizeof(T));
+        }
+
+        std::ostream& _os;
+    };
+
+    // data in the same order as the file. Slices are read/written a contiguous run at a time
+    template<typename DataT>
+    typename std::enable_if<is_slice<DataT>::value>::type
+    read_data(DataT& d, std::istream& is) {
+        d.for_each_contiguous_run(ReadRun(is));
+    }
+
+    template<typename DataT>
+    typename std::enable_if<!is_slice<DataT>::value>::type
+    read_data(DataT& d, std::istream& is) {
+        read(d.begin(), d.end(), is);
+    }
+
+    template<typename DataT>
+    typename std::enable_if<is_slice<DataT>::value>::type
+    write_data(DataT const& d, std::ostream& os) {
+        d.for_each_contiguous_run(WriteRun(os));
+    }
+
+    template<typename DataT>
+    typename std::enable_if<!is_slice<DataT>::value>::type
+    write_data(DataT const& d, std::ostream& os) {
+        write(d.cbegin(), d.cend(), os);
+    }
+
+    // copy a block of complete spectra into runs made up of complete channels
+    template<typename ValueType>
+    struct ScatterSpectra {
+        ScatterSpectra(ValueType const* buffer, std::size_t number_of_channels, std::size_t number_of_spectra)
+            : _buffer(buffer), _number_of_channels(number_of_channels), _number_of_spectra(number_of_spectra), _channel(0) {}
+
+        template<typename T>
+        void operator()(T* begin, T* const end) {
+            for(; begin != end; begin += _number_of_spectra) {
+                ValueType const* in = _buffer + _channel;
+                for(std::size_t i=0; i < _number_of_spectra; ++i) {
+                    begin[i] = in[i * _number_of_channels];
+                }
+                ++_channel;
+            }
+        }
+
+        ValueType const* _buffer;
+        std::size_t _number_of_channels;
+        std::size_t _number_of_spectra;
+        std::size_t _channel;
+    };
+
+    // copy runs made up of complete channels into a block of complete spectra
+    template<typename ValueType>
+    struct GatherSpectra {
+        GatherSpectra(ValueType* buffer, std::size_t number_of_channels, std::size_t number_of_spectra)
+            : _buffer(buffer), _number_of_channels(number_of_channels), _number_of_spectra(number_of_spectra), _channel(0) {}
+
+        template<typename T>
+        void operator()(T const* begin, T const* const end) {
+            for(; begin != end; begin += _number_of_spectra) {
+                ValueType* out = _buffer + _channel;
+                for(std::size_t i=0; i < _number_of_spectra; ++i) {
+                    out[i * _number_of_channels] = begin[i];
+                }
+                ++_channel;
+            }
+        }
+
+        ValueType* _buffer;
+        std::size_t _number_of_channels;
+        std::size_t _number_of_spectra;
+        std::size_t _channel;
+    };
+
+    // spectrum ordered stream into channel ordered data. Read a block of spectra at a time into a
+    // staging buffer and scatter into the channels
+    template<typename DataT>
+    void read_spectra(DataT& d, std::istream& is) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_channels = d.template dimension<units::Frequency>();
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        if(number_of_channels == 0 || number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(number_of_channels), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size * number_of_channels);
+        ValueType* const buffer = scratch.data();
+        for(std::size_t spectrum = 0; spectrum < number_of_spectra; spectrum += block_size) {
+            std::size_t n = std::min(block_size, number_of_spectra - spectrum);
+            is.read(reinterpret_cast<char*>(buffer), n * number_of_channels * sizeof(ValueType));
+            n = is.gcount() / (number_of_channels * sizeof(ValueType)); // complete spectra only
+            if(n == 0) return;
+            auto block = d.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(spectrum), DimensionSize<units::Time>(n)));
+            ScatterSpectra<ValueType> scatter(buffer, number_of_channels, n);
+            block.for_each_contiguous_run(scatter);
+            if(!is) return;
+        }
+    }
+
+    // channel ordered data to a spectrum ordered stream
+    template<typename DataT>
+    void write_spectra(DataT const& d, std::ostream& os) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_channels = d.template dimension<units::Frequency>();
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        if(number_of_channels == 0 || number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(number_of_channels), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size * number_of_channels);
+        ValueType* const buffer = scratch.data();
+        for(std::size_t spectrum = 0; spectrum < number_of_spectra; spectrum += block_size) {
+            std::size_t const n = std::min(block_size, number_of_spectra - spectrum);
+            auto const block = d.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(spectrum), DimensionSize<units::Time>(n)));
+            GatherSpectra<ValueType> gather(buffer, number_of_channels, n);
+            block.for_each_contiguous_run(gather);
+            os.write(reinterpret_cast<const char*>(buffer), n * number_of_channels * sizeof(ValueType));
+        }
+    }
+
+    // channel ordered stream into spectrum ordered data. Each channel is read in blocks
+    // into a staging buffer and scattered across the spectra
+    template<typename DataT>
+    void read_channels(DataT& d, std::istream& is) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        if(number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(1), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size);
+        ValueType* const buffer = scratch.data();
+        for(DimensionIndex<units::Frequency> channel_num(0);  channel_num < d.template dimension<units::Frequency>(); ++channel_num)
+        {
+            auto channel = d[channel_num];
+            auto it = channel.begin();
+            for(std::size_t sample = 0; sample < number_of_spectra; sample += block_size) {
+                std::size_t n = std::min(block_size, number_of_spectra - sample);
+                is.read(reinterpret_cast<char*>(buffer), n * sizeof(ValueType));
+                n = is.gcount() / sizeof(ValueType);
+                it = std::copy(buffer, buffer + n, it);
+                if(!is) return;
+            }
+        }
+    }
+
+    // stream with interleaved polarisations into data with a block of channels for each polarisation.
+    // Read a block of spectra at a time into a staging buffer and deinterleave each spectrum
+    template<typename DataT>
+    void read_polarisations(DataT& d, std::istream& is) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_channels = d.template dimension<units::Frequency>();
+        std::size_t const number_of_polarisations = d.template dimension<units::Polarisation>();
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        std::size_t const spectrum_size = number_of_channels * number_of_polarisations;
+        if(spectrum_size == 0 || number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(spectrum_size), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size * spectrum_size);
+        ValueType* const buffer = scratch.data();
+        std::vector<ValueType*> pols(number_of_polarisations);
+        for(std::size_t spectrum = 0; spectrum < number_of_spectra; spectrum += block_size) {
+            std::size_t n = std::min(block_size, number_of_spectra - spectrum);
+            is.read(reinterpret_cast<char*>(buffer), n * spectrum_size * sizeof(ValueType));
+            n = is.gcount() / (spectrum_size * sizeof(ValueType)); // complete spectra only
+            for(std::size_t i = 0; i < n; ++i) {
+                auto s = d[DimensionIndex<units::Time>(spectrum + i)];
+                for(std::size_t pol = 0; pol < number_of_polarisations; ++pol) {
+                    pols[pol] = &*s[DimensionIndex<units::Polarisation>(pol)].begin();
+                }
+                deinterleave(buffer + i * spectrum_size, number_of_channels, number_of_polarisations, pols.data());
+            }
+            if(!is) return;
+        }
+    }
+
+    // data with a block of channels for each polarisation to a stream with interleaved polarisations
+    template<typename DataT>
+    void write_polarisations(DataT const& d, std::ostream& os) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_channels = d.template dimension<units::Frequency>();
+        std::size_t const number_of_polarisations = d.template dimension<units::Polarisation>();
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        std::size_t const spectrum_size = number_of_channels * number_of_polarisations;
+        if(spectrum_size == 0 || number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(spectrum_size), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size * spectrum_size);
+        ValueType* const buffer = scratch.data();
+        std::vector<ValueType const*> pols(number_of_polarisations);
+        for(std::size_t spectrum = 0; spectrum < number_of_spectra; spectrum += block_size) {
+            std::size_t const n = std::min(block_size, number_of_spectra - spectrum);
+            for(std::size_t i = 0; i < n; ++i) {
+                auto const s = d[DimensionIndex<units::Time>(spectrum + i)];
+                for(std::size_t pol = 0; pol < number_of_polarisations; ++pol) {
+                    pols[pol] = &*s[DimensionIndex<units::Polarisation>(pol)].cbegin();
+                }
+                interleave(pols.data(), number_of_channels, number_of_polarisations, buffer + i * spectrum_size);
+            }
+            os.write(reinterpret_cast<const char*>(buffer), n * spectrum_size * sizeof(ValueType));
+        }
+    }
+
+    // spectrum ordered data to a channel ordered stream
+    template<typename DataT>
+    void write_channels(DataT const& d, std::ostream& os) {
+        typedef typename std::decay<decltype(*d.begin())>::type ValueType;
+        std::size_t const number_of_spectra = d.template dimension<units::Time>();
+        if(number_of_spectra == 0) return;
+
+        std::size_t const block_size = std::min(staging_blocks<ValueType>(1), number_of_spectra);
+        detail::ScratchBuffer<ValueType> scratch(block_size);
+        ValueType* const buffer = scratch.data();
+        for(DimensionIndex<units::Frequency> channel_num(0);  channel_num < d.template dimension<units::Frequency>(); ++channel_num)
+        {
+            auto const channel = d[channel_num];
+            auto it = channel.cbegin();
+            for(std::size_t sample = 0; sample < number_of_spectra; sample += block_size) {
+                std::size_t const n = std::min(block_size, number_of_spectra - sample);
+                for(std::size_t i = 0; i < n; ++i, ++it) {
+                    buffer[i] = *it;
+                }
+                os.write(reinterpret_cast<const char*>(buffer), n * sizeof(ValueType));
+            }
+        }
+    }
 }
 
 template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time, units::Frequency>::value, SigProcFormat<units::Time, units::Frequency>::ISigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::ISigProcFormat::operator>>(T& d) const
 {
-    read(d.begin(), d.end(), _is);
+    read_data(d, _is);
     return *this;
 }
 
@@ -96,7 +363,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time>::value, SigProcFormat<units::Time, units::Frequency>::ISigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::ISigProcFormat::operator>>(T& d) const
 {
-    read(d.begin(), d.end(), _is);
+    read_data(d, _is);
     return *this;
 }
 
@@ -104,7 +371,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time, units::Frequency>::value, SigProcFormat<units::Time, units::Frequency>::OSigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::OSigProcFormat::operator<<(T const& d) const
 {
-    write(d.cbegin(), d.cend(), _os);
+    write_data(d, _os);
     return *this;
 }
 
@@ -112,11 +379,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Frequency, units::Time>::value, SigProcFormat<units::Time, units::Frequency>::ISigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::ISigProcFormat::operator>>(T& d) const
 {
-    for(DimensionIndex<units::Time> spectrum_num(0);  spectrum_num < d.template size<units::Time>(); ++spectrum_num)
-    {
-        auto spectrum = d[spectrum_num];
-        read(spectrum.begin(), spectrum.end(), _is);
-    }
+    read_spectra(d, _is);
     return *this;
 }
 
@@ -124,7 +387,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time>::value, SigProcFormat<units::Time, units::Frequency>::OSigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::OSigProcFormat::operator<<(T const& d) const
 {
-    write(d.cbegin(), d.cend(), _os);
+    write_data(d, _os);
     return *this;
 }
 
@@ -132,7 +395,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Frequency>::value, SigProcFormat<units::Time, units::Frequency>::OSigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::OSigProcFormat::operator<<(T const& d) const
 {
-    write(d.cbegin(), d.cend(), _os);
+    write_data(d, _os);
     return *this;
 }
 
@@ -140,22 +403,30 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Frequency, units::Time>::value, SigProcFormat<units::Time, units::Frequency>::OSigProcFormat const&>::type
 SigProcFormat<units::Time, units::Frequency>::OSigProcFormat::operator<<(T const& d) const
 {
-    for(DimensionIndex<units::Time> spectrum_num(0);  spectrum_num < d.template size<units::Time>(); ++spectrum_num)
-    {
-        auto const spectrum = d[spectrum_num];
-        write(spectrum.cbegin(), spectrum.cend(), _os);
-    }
+    write_spectra(d, _os);
+    return *this;
+}
+
+template<typename T>
+typename std::enable_if<has_exact_dimensions<T, units::Time, units::Polarisation, units::Frequency>::value, SigProcFormat<units::Time, units::Frequency>::ISigProcFormat const&>::type
+SigProcFormat<units::Time, units::Frequency>::ISigProcFormat::operator>>(T& d) const
+{
+    read_polarisations(d, _is);
+    return *this;
+}
+
+template<typename T>
+typename std::enable_if<has_exact_dimensions<T, units::Time, units::Polarisation, units::Frequency>::value, SigProcFormat<units::Time, units::Frequency>::OSigProcFormat const&>::type
+SigProcFormat<units::Time, units::Frequency>::OSigProcFormat::operator<<(T const& d) const
+{
+    write_polarisations(d, _os);
     return *this;
 }
 
 template<typename T, typename Alloc>
 typename SigProcFormat<units::Frequency, units::Time>::OSigProcFormat const& SigProcFormat<units::Frequency, units::Time>::OSigProcFormat::operator<<(astrotypes::TimeFrequency<T, Alloc> const& d)
 {
-    for(DimensionIndex<units::Frequency> channel_num(0);  channel_num < d.template size<units::Frequency>(); ++channel_num)
-    {
-        auto const& channel = d.channel(channel_num);
-        write(channel.cbegin(), channel.cend(), _os);
-    }
+    write_channels(d, _os);
     return *this;
 }
 
@@ -170,11 +441,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time, units::Frequency>::value, SigProcFormat<units::Frequency, units::Time>::ISigProcFormat const&>::type
 SigProcFormat<units::Frequency, units::Time>::ISigProcFormat::operator>>(T& d) const
 {
-    for(DimensionIndex<units::Frequency> channel_num(0);  channel_num < d.template size<units::Frequency>(); ++channel_num)
-    {
-        auto channel = d.channel(channel_num);
-        read(channel.begin(), channel.end(), _is);
-    }
+    read_channels(d, _is);
     return *this;
 }
 
@@ -182,7 +449,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Frequency, units::Time>::value, SigProcFormat<units::Frequency, units::Time>::ISigProcFormat const&>::type
 SigProcFormat<units::Frequency, units::Time>::ISigProcFormat::operator>>(T& d) const
 {
-    read(d.begin(), d.end(), _is);
+    read_data(d, _is);
     return *this;
 }
 
@@ -190,7 +457,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Time>::value, SigProcFormat<units::Frequency, units::Time>::OSigProcFormat const&>::type
 SigProcFormat<units::Frequency, units::Time>::OSigProcFormat::operator<<(T const& d) const
 {
-    write(d.cbegin(), d.cend(), _os);
+    write_data(d, _os);
     return *this;
 }
 
@@ -198,7 +465,7 @@ template<typename T>
 typename std::enable_if<has_exact_dimensions<T, units::Frequency>::value, SigProcFormat<units::Frequency, units::Time>::OSigProcFormat const&>::type
 SigProcFormat<units::Frequency, units::Time>::OSigProcFormat::operator<<(T const& d) const
 {
-    write(d.cbegin(), d.cend(), _os);
+    write_data(d, _os);
     return *this;
 }
 
@@ -23,6 +23,7 @@
  */
 #include "pss/astrotypes/sigproc/SigProc.h"
 #include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
 #include <fstream>
 void usage(const char* program_name)
 {
@@ -41,6 +42,20 @@ void usage(const char* program_name)
 template<typename SigProcTraits>
 struct CatData
 {
+    static
+    void write(std::ostream& output_file, typename SigProcTraits::DataType const& data, bool as_time_series)
+    {
+        // we output the data as contiguos spectra. To output as a series of channles
+        // use the SigProcFormat<pss::astrotypes::units::Frequency, pss::astrotypes::units::Time>() adapter
+        if(as_time_series) {
+            output_file << pss::astrotypes::sigproc::SigProcFormat<pss::astrotypes::units::Frequency, pss::astrotypes::units::Time>() << data;
+        }
+        else
+        {
+            output_file << pss::astrotypes::sigproc::SigProcFormat<pss::astrotypes::units::Time, pss::astrotypes::units::Frequency>() << data;
+        }
+    }
+
     static
     bool exec( pss::astrotypes::DimensionSize<pss::astrotypes::units::Frequency> number_of_channels
                  , std::ostream& output_file
@@ -52,36 +67,42 @@ struct CatData
         // Note that the number of samples in the file does not have to be a multiple of this value, the
         // streamer adapters will adjust the chunk size as necessary if there are insufficent data to fill a whole
         // data structure.
-        typename SigProcTraits::DataType data(number_of_channels,
+        typename SigProcTraits::DataType prototype(number_of_channels,
                     pss::astrotypes::DimensionSize<pss::astrotypes::units::Time>(1000));
 
-        typename SigProcTraits::Adapter sigproc_adapter;
-
         unsigned file_index = 0;
         while(true) {
-            while(!input_file.eof()) {
-                input_file >> sigproc_adapter >> data;
-                // we output the data as contiguos spectra. To output as a series of channles
-                // use the SigProcFormat<pss::astrotypes::units::Frequency, pss::astrotypes::units::Time>() adapter
-                if(as_time_series) {
-                    output_file << pss::astrotypes::sigproc::SigProcFormat<pss::astrotypes::units::Frequency, pss::astrotypes::units::Time>() << data;
-                }
-                else
-                {
-                    output_file << pss::astrotypes::sigproc::SigProcFormat<pss::astrotypes::units::Time, pss::astrotypes::units::Frequency>() << data;
+            {
+                // chunks are read in on a background thread whilst we write out the previous ones
+                typedef typename SigProcTraits::DataType DataType;
+                pss::astrotypes::sigproc::AsyncStreamReader<DataType, typename SigProcTraits::Adapter> reader(input_file, prototype);
+                while(auto chunk = reader.next()) {
+                    if(!chunk.partial()) {
+                        write(output_file, *chunk, as_time_series);
+                    }
+                    else {
+                        // the last chunk is not completely filled so we only output the spectra read
+                        // (copied through a slice so this works whatever the memory order of DataType)
+                        typedef pss::astrotypes::units::Time Time;
+                        DataType remainder(number_of_channels, chunk.number_of_spectra());
+                        auto const block = chunk->slice(pss::astrotypes::DimensionSpan<Time>(pss::astrotypes::DimensionIndex<Time>(0), chunk.number_of_spectra()));
+                        std::copy(block.begin(), block.end(), remainder.begin());
+                        write(output_file, remainder, as_time_series);
+                    }
                 }
             }
 
             // read in the next file and check the haader is consistent
             // with what we expect
             if(++file_index < files.size()) {
-                input_file.open(files[file_index]);
+                input_file.close();
+                input_file.open(files[file_index], std::ios::binary);
                 pss::astrotypes::sigproc::Header header;
                 input_file >> header;
-                if(header.number_of_bits() != sizeof(typename decltype(data)::value_type)) {
+                if(header.number_of_bits() != 8 * sizeof(typename SigProcTraits::DataType::value_type)) {
                     std::cerr << "Error: file " << files[file_index]
                               << " has " << header.number_of_bits() << " bit data."
-                              << " (expecting " << sizeof(typename decltype(data)::value_type) << " bits)";
+                              << " (expecting " << 8 * sizeof(typename SigProcTraits::DataType::value_type) << " bits)";
                     return 1;
                 }
                 continue;
@@ -96,25 +96,32 @@ struct SearchData
     {
         typedef pss::astrotypes::units::Time Time;
 
-        // read in data in 1024 spectral chunks
+        // read in data in 1024 spectral chunks. The next chunks are read in
+        // the background whilst we are searching the current one
         pss::astrotypes::DimensionSize<Time> number_of_spectra(1024);
-        typename SigProcTraits::DataType data(header.number_of_channels(), number_of_spectra);
-        typename SigProcTraits::Adapter sigproc_adapter;
+        typename SigProcTraits::DataType prototype(header.number_of_channels(), number_of_spectra);
+        pss::astrotypes::sigproc::AsyncStreamReader<typename SigProcTraits::DataType, typename SigProcTraits::Adapter> reader(input_file, prototype);
 
         pss::astrotypes::DimensionIndex<Time> s_num(0);
-        while(!input_file.eof()) {
-            input_file >> sigproc_adapter >> data;
+        while(auto chunk = reader.next()) {
+            auto const& data = *chunk;
+            // the last chunk may not be completely filled
+            pss::astrotypes::DimensionSize<Time> const spectra_read = chunk.number_of_spectra();
 
             ResultsWriter results;
-            for(pss::astrotypes::DimensionIndex<Time> spectrum_number(0);
-                spectrum_number < data.template dimension<Time>();
-                ++spectrum_number)
+            auto const block = data.slice(pss::astrotypes::DimensionSpan<Time>(pss::astrotypes::DimensionIndex<Time>(0), spectra_read));
+            for(auto const& spectrum : block.spectra())
             {
-                auto spectrum = data[spectrum_number];
-                typename SigProcTraits::DataType::value_type sum = 0.0;
-                for(auto const& sample : spectrum) {
-                    sum += sample;
-                }
+                // sum the samples a contiguous block at a time
+                // (simple pointer loops like this can be vectorised by the compiler)
+                typedef typename SigProcTraits::DataType::value_type ValueType;
+                ValueType sum = 0.0;
+                spectrum.for_each_contiguous_run([&](ValueType const* begin, ValueType const* end)
+                {
+                    for(ValueType const* sample = begin; sample != end; ++sample) {
+                        sum += *sample;
+                    }
+                });
                 if(sum == 0.0) {
                     results.mark(s_num);
                 }
@@ -0,0 +1,205 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../AsyncStreamReaderTest.h"
+#include "pss/astrotypes/sigproc/AsyncStreamReader.h"
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <sstream>
+
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace test {
+
+
+AsyncStreamReaderTest::AsyncStreamReaderTest()
+    : ::testing::Test()
+{
+}
+
+AsyncStreamReaderTest::~AsyncStreamReaderTest()
+{
+}
+
+void AsyncStreamReaderTest::SetUp()
+{
+}
+
+void AsyncStreamReaderTest::TearDown()
+{
+}
+
+TEST_F(AsyncStreamReaderTest, test_tf_data_partial_last_chunk)
+{
+    typedef TimeFrequency<uint8_t> DataType;
+    typedef SigProcFormat<units::Time, units::Frequency> AdapterType;
+
+    // 25 spectra of 8 channels read in 10 spectra chunks
+    DataType data(DimensionSize<units::Time>(25), DimensionSize<units::Frequency>(8));
+    uint8_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n; } );
+
+    std::stringstream ss;
+    ss << AdapterType() << data;
+
+    DataType prototype(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(8));
+    AsyncStreamReader<DataType, AdapterType> reader(ss, prototype);
+
+    std::vector<uint8_t> result;
+    std::vector<std::size_t> sizes;
+    while(auto chunk = reader.next()) {
+        sizes.push_back(chunk.number_of_spectra());
+        ASSERT_EQ(chunk.number_of_spectra() < chunk->dimension<units::Time>(), chunk.partial());
+        std::copy(chunk->begin(), chunk->begin() + chunk.number_of_spectra() * 8, std::back_inserter(result));
+    }
+    ASSERT_EQ(3U, sizes.size());
+    ASSERT_EQ(10U, sizes[0]);
+    ASSERT_EQ(10U, sizes[1]);
+    ASSERT_EQ(5U, sizes[2]);
+    ASSERT_TRUE(std::equal(data.begin(), data.end(), result.begin()));
+
+    // further calls continue to report the end of stream
+    ASSERT_FALSE(reader.next());
+}
+
+TEST_F(AsyncStreamReaderTest, test_ft_data_partial_last_chunk)
+{
+    // the stream is in spectrum order but the data is stored by channel
+    typedef FrequencyTime<uint8_t> DataType;
+    typedef SigProcFormat<units::Time, units::Frequency> AdapterType;
+
+    TimeFrequency<uint8_t> data(DimensionSize<units::Time>(25), DimensionSize<units::Frequency>(8));
+    uint8_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n; } );
+    std::stringstream ss;
+    ss << AdapterType() << data;
+
+    DataType prototype(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(8));
+    AsyncStreamReader<DataType, AdapterType> reader(ss, prototype);
+
+    std::size_t spectrum_number = 0;
+    while(auto chunk = reader.next()) {
+        ASSERT_EQ(chunk.number_of_spectra() < DimensionSize<units::Time>(10), chunk.partial());
+        for(std::size_t i = 0; i < chunk.number_of_spectra(); ++i) {
+            auto const expected = data.spectrum(spectrum_number);
+            auto const spectrum = chunk->spectrum(i);
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(), spectrum.begin())) << spectrum_number;
+            ++spectrum_number;
+        }
+    }
+    ASSERT_EQ(25U, spectrum_number);
+}
+
+TEST_F(AsyncStreamReaderTest, test_empty_stream)
+{
+    typedef TimeFrequency<uint8_t> DataType;
+    std::stringstream ss;
+    DataType prototype(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(8));
+    AsyncStreamReader<DataType, SigProcFormat<units::Time, units::Frequency>> reader(ss, prototype);
+    ASSERT_FALSE(reader.next());
+}
+
+TEST_F(AsyncStreamReaderTest, test_hold_all_buffers)
+{
+    // hold on to every buffer in turn and check none are overwritten whilst held
+    typedef TimeFrequency<uint16_t> DataType;
+    typedef SigProcFormat<units::Time, units::Frequency> AdapterType;
+
+    DataType data(DimensionSize<units::Time>(64), DimensionSize<units::Frequency>(4));
+    uint16_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n; } );
+    std::stringstream ss;
+    ss << AdapterType() << data;
+
+    DataType prototype(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+    AsyncStreamReader<DataType, AdapterType> reader(ss, prototype, 2);
+
+    std::size_t offset = 0;
+    while(true) {
+        auto chunk_1 = reader.next();
+        auto chunk_2 = reader.next();
+        if(!chunk_1) break;
+        ASSERT_TRUE(std::equal(chunk_1->begin(), chunk_1->end(), data.begin() + offset));
+        offset += chunk_1.number_of_spectra() * 4;
+        if(!chunk_2) break;
+        ASSERT_TRUE(std::equal(chunk_2->begin(), chunk_2->end(), data.begin() + offset));
+        offset += chunk_2.number_of_spectra() * 4;
+    }
+    ASSERT_EQ(data.data_size(), offset);
+}
+
+TEST_F(AsyncStreamReaderTest, test_packed_data)
+{
+    typedef TimeFrequency<uint8_t> DataType;
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 2> AdapterType;
+
+    DataType data(DimensionSize<units::Time>(7), DimensionSize<units::Frequency>(4));
+    uint8_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n % 4; } );
+    std::stringstream ss;
+    ss << AdapterType() << data;
+
+    DataType prototype(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+    AsyncStreamReader<DataType, AdapterType> reader(ss, prototype);
+
+    auto chunk_1 = reader.next();
+    ASSERT_TRUE(chunk_1);
+    ASSERT_EQ(DimensionSize<units::Time>(4), chunk_1.number_of_spectra());
+    ASSERT_TRUE(std::equal(chunk_1->begin(), chunk_1->end(), data.begin()));
+    auto chunk_2 = reader.next();
+    ASSERT_TRUE(chunk_2);
+    ASSERT_TRUE(chunk_2.partial());
+    ASSERT_EQ(DimensionSize<units::Time>(3), chunk_2.number_of_spectra());
+    ASSERT_TRUE(std::equal(chunk_2->begin(), chunk_2->begin() + 12, data.begin() + 16));
+    ASSERT_FALSE(reader.next());
+}
+
+TEST_F(AsyncStreamReaderTest, test_chunk_outlives_reader)
+{
+    typedef TimeFrequency<uint8_t> DataType;
+    typedef SigProcFormat<units::Time, units::Frequency> AdapterType;
+
+    DataType data(DimensionSize<units::Time>(8), DimensionSize<units::Frequency>(4));
+    uint8_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return ++n; } );
+    std::stringstream ss;
+    ss << AdapterType() << data;
+
+    DataType prototype(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+    std::unique_ptr<AsyncStreamReader<DataType, AdapterType>> reader(new AsyncStreamReader<DataType, AdapterType>(ss, prototype));
+    auto chunk = reader->next();
+    ASSERT_TRUE(chunk);
+    reader.reset();
+
+    // the buffer stays valid and is released safely without the reader
+    ASSERT_TRUE(std::equal(chunk->begin(), chunk->end(), data.begin()));
+}
+
+} // namespace test
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
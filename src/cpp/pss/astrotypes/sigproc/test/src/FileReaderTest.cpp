@@ -24,7 +24,13 @@
 #include "../FileReaderTest.h"
 #include "../SigProcTestFile.h"
 #include "pss/astrotypes/sigproc/FileReader.h"
+#include "pss/astrotypes/types/BufferPool.h"
+#include "pss/astrotypes/types/CircularTimeFrequency.h"
 #include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
 
 
 namespace pss {
@@ -96,6 +102,91 @@ TEST_F(FileReaderTest, test_filterbank_file_resize_frequency_tf_data)
     ASSERT_EQ(test_file.number_of_channels(), tf_data.dimension<astrotypes::units::Frequency>());
 }
 
+TEST_F(FileReaderTest, test_filterbank_file_4bit_tf_data)
+{
+    // generate a 4 bit file
+    char file_name[] = "/tmp/astrotypes_4bit_XXXXXX";
+    int fd = mkstemp(file_name);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    TimeFrequency<uint8_t> expected(DimensionSize<units::Time>(20), DimensionSize<units::Frequency>(6));
+    uint8_t n = 0;
+    std::generate(expected.begin(), expected.end(), [&]() { return ++n % 16; } );
+    {
+        Header header;
+        header.number_of_channels(expected.number_of_channels());
+        header.number_of_bits(4);
+        header.number_of_ifs(1);
+        header.data_type(Header::DataType::FilterBank);
+        std::ofstream os(file_name, std::ios::binary);
+        os << header;
+        os << PackedSigProcFormat<units::Time, units::Frequency, 4>() << expected;
+    }
+
+    TimeFrequency<uint8_t> tf_data;
+    sigproc::FileReader<> reader(file_name);
+    reader >> ResizeAdapter<units::Time, units::Frequency>() >> tf_data;
+    std::remove(file_name);
+
+    ASSERT_EQ(expected.number_of_channels(), tf_data.number_of_channels());
+    ASSERT_EQ(expected.number_of_spectra(), tf_data.number_of_spectra());
+    ASSERT_EQ(expected, tf_data);
+}
+
+TEST_F(FileReaderTest, test_filterbank_file_pooled_ft_data)
+{
+    // reading chunks into recycled buffers should only need a single buffer
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    FrequencyTime<uint8_t> expected;
+    {
+        sigproc::FileReader<> reader(test_file.file());
+        reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+    }
+
+    typedef BufferPool<FrequencyTime<uint8_t>> PoolType;
+    PoolType pool(PoolType::Initialisation::None);
+    DimensionSize<units::Time> const chunk_size(2);
+    sigproc::FileReader<> reader(test_file.file());
+    for(DimensionIndex<units::Time> spectrum(0); spectrum + chunk_size <= test_file.number_of_spectra(); spectrum += chunk_size) {
+        auto data = pool.acquire(chunk_size, reader.dimension<units::Frequency>());
+        reader >> *data;
+        auto const expected_chunk = expected.slice(DimensionSpan<units::Time>(spectrum, chunk_size));
+        ASSERT_TRUE(std::equal(expected_chunk.begin(), expected_chunk.end(), data->begin()));
+    }
+    ASSERT_EQ(1U, pool.misses());
+    ASSERT_EQ(static_cast<std::size_t>(test_file.number_of_spectra()) / static_cast<std::size_t>(chunk_size) - 1, pool.hits());
+}
+
+TEST_F(FileReaderTest, test_filterbank_file_circular_tf_data)
+{
+    // read chunks straight into the head of a ring buffer smaller than the file
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    TimeFrequency<uint8_t> expected;
+    {
+        sigproc::FileReader<> reader(test_file.file());
+        reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+    }
+    std::size_t const number_of_spectra = test_file.number_of_spectra();
+    ASSERT_GE(number_of_spectra, 4U);
+
+    CircularTimeFrequency<uint8_t> ring(DimensionSize<units::Time>(number_of_spectra / 2 + 1), expected.dimension<units::Frequency>());
+    sigproc::FileReader<> reader(test_file.file());
+    std::size_t spectra_read = 0;
+    while(spectra_read + 3 <= number_of_spectra) {
+        auto head = ring.head(DimensionSize<units::Time>(3));
+        reader >> head;
+        ring.commit(head.dimension<units::Time>());
+        spectra_read += head.dimension<units::Time>();
+
+        auto const window = ring.window();
+        auto const expected_window = expected.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(spectra_read - window.number_of_spectra())
+                                                                             , DimensionSize<units::Time>(window.number_of_spectra())));
+        ASSERT_TRUE(std::equal(expected_window.begin(), expected_window.end(), window.begin()));
+    }
+    ASSERT_TRUE(ring.full());
+}
+
 } // namespace test
 } // namespace sigproc
 } // namespace astrotypes
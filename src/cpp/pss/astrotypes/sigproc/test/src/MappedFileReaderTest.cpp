@@ -0,0 +1,147 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../MappedFileReaderTest.h"
+#include "../SigProcTestFile.h"
+#include "pss/astrotypes/sigproc/MappedFileReader.h"
+#include "pss/astrotypes/sigproc/FileReader.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace test {
+
+
+MappedFileReaderTest::MappedFileReaderTest()
+    : ::testing::Test()
+{
+}
+
+MappedFileReaderTest::~MappedFileReaderTest()
+{
+}
+
+void MappedFileReaderTest::SetUp()
+{
+}
+
+void MappedFileReaderTest::TearDown()
+{
+}
+
+TEST_F(MappedFileReaderTest, test_map_all_8bit)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    TimeFrequency<uint8_t> expected;
+    FileReader<> file_reader(test_file.file());
+    file_reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+
+    MappedFileReader<> reader(test_file.file());
+    ASSERT_EQ(test_file.number_of_channels(), reader.dimension<units::Frequency>());
+    ASSERT_EQ(test_file.number_of_spectra(), reader.dimension<units::Time>());
+    ASSERT_EQ(file_reader.number_of_data_points(), reader.number_of_data_points());
+
+    auto data = reader.map<uint8_t>(DimensionIndex<units::Time>(0), reader.dimension<units::Time>());
+    ASSERT_EQ(test_file.number_of_channels(), data.dimension<units::Frequency>());
+    ASSERT_EQ(test_file.number_of_spectra(), data.dimension<units::Time>());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), data.begin()));
+}
+
+TEST_F(MappedFileReaderTest, test_next_windows_16bit)
+{
+    SigProcFilterBankTestFile<uint16_t> test_file;
+    TimeFrequency<uint16_t> expected;
+    FileReader<> file_reader(test_file.file());
+    file_reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+
+    // window size does not divide the number of spectra
+    MappedFileReader<> reader(test_file.file(), MappedFileReader<>::Advice::WillNeed);
+    std::size_t const window = 50;
+    auto expected_it = expected.cbegin();
+    std::size_t spectra = 0;
+    while(true) {
+        auto data = reader.next<uint16_t>(DimensionSize<units::Time>(window));
+        if(data.number_of_spectra() == 0) break;
+        ASSERT_LE(data.number_of_spectra(), window);
+        ASSERT_EQ(test_file.number_of_channels(), data.number_of_channels());
+        ASSERT_TRUE(std::equal(data.cbegin(), data.cend(), expected_it));
+        expected_it += data.data_size();
+        spectra += data.number_of_spectra();
+    }
+    ASSERT_EQ(test_file.number_of_spectra(), spectra);
+}
+
+TEST_F(MappedFileReaderTest, test_map_offset_outlives_reader)
+{
+    SigProcFilterBankTestFile<float> test_file;
+    TimeFrequency<float> expected;
+    FileReader<> file_reader(test_file.file());
+    file_reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+
+    std::unique_ptr<MappedFileReader<>> reader(new MappedFileReader<>(test_file.file(), MappedFileReader<>::Advice::Random));
+    auto data = reader->map<float>(DimensionIndex<units::Time>(3), DimensionSize<units::Time>(10));
+    reader.reset();
+
+    ASSERT_EQ(10U, data.number_of_spectra());
+    for(std::size_t spectrum = 0; spectrum < data.number_of_spectra(); ++spectrum) {
+        auto expected_spectrum = expected.spectrum(spectrum + 3);
+        auto mapped_spectrum = data.spectrum(spectrum);
+        ASSERT_TRUE(std::equal(mapped_spectrum.begin(), mapped_spectrum.end(), expected_spectrum.begin()));
+    }
+
+    // modifications are private to the mapping
+    std::fill(data.begin(), data.end(), 0.0f);
+    MappedFileReader<> reader_2(test_file.file());
+    auto data_2 = reader_2.map<float>(DimensionIndex<units::Time>(0), reader_2.dimension<units::Time>());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), data_2.begin()));
+}
+
+TEST_F(MappedFileReaderTest, test_copy_owns_its_data)
+{
+    SigProcFilterBankTestFile<float> test_file;
+    MappedFileReader<> reader(test_file.file());
+    auto const data = reader.map<float>(DimensionIndex<units::Time>(0), reader.dimension<units::Time>());
+    auto copy = data;
+
+    ASSERT_NE(&*data.begin(), &*copy.begin());
+    ASSERT_TRUE(std::equal(data.begin(), data.end(), copy.begin()));
+    std::vector<float> const original(data.begin(), data.end());
+    std::fill(copy.begin(), copy.end(), -1.0f);
+    ASSERT_TRUE(std::equal(original.begin(), original.end(), data.begin()));
+}
+
+TEST_F(MappedFileReaderTest, test_type_mismatch)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    MappedFileReader<> reader(test_file.file());
+    ASSERT_THROW(reader.map<uint16_t>(DimensionIndex<units::Time>(0), DimensionSize<units::Time>(1)), std::runtime_error);
+}
+
+} // namespace test
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../OverlapSaveReaderTest.h"
+#include "../SigProcTestFile.h"
+#include "pss/astrotypes/sigproc/MappedFileReader.h"
+#include "pss/astrotypes/sigproc/OverlapSaveReader.h"
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace test {
+
+
+OverlapSaveReaderTest::OverlapSaveReaderTest()
+    : ::testing::Test()
+{
+}
+
+OverlapSaveReaderTest::~OverlapSaveReaderTest()
+{
+}
+
+void OverlapSaveReaderTest::SetUp()
+{
+}
+
+void OverlapSaveReaderTest::TearDown()
+{
+}
+
+namespace {
+template<typename ReaderT>
+void verify_chunks(ReaderT& file, TimeFrequency<uint8_t> const& expected, std::size_t chunk_size, std::size_t overlap, std::size_t buffer_chunks)
+{
+    std::size_t const number_of_spectra = expected.number_of_spectra();
+    sigproc::OverlapSaveReader<uint8_t, ReaderT> reader(file, DimensionSize<units::Time>(chunk_size), DimensionSize<units::Time>(overlap), buffer_chunks);
+    std::size_t start = 0;
+    std::size_t number_of_chunks = 0;
+    while(reader.next()) {
+        auto const chunk = reader.chunk();
+        std::size_t const length = std::min(chunk_size, number_of_spectra - start);
+        ASSERT_EQ(start, static_cast<std::size_t>(reader.start()));
+        ASSERT_EQ(length, static_cast<std::size_t>(chunk.template dimension<units::Time>()));
+        auto const expected_chunk = expected.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(start), DimensionSize<units::Time>(length)));
+        ASSERT_TRUE(std::equal(expected_chunk.begin(), expected_chunk.end(), chunk.begin())) << "chunk starting at " << start;
+        ++number_of_chunks;
+        if(start + chunk_size >= number_of_spectra) break;
+        start += chunk_size - overlap;
+    }
+    ASSERT_FALSE(reader.next());
+    ASSERT_EQ(1 + (number_of_spectra - overlap - 1) / (chunk_size - overlap), number_of_chunks);
+}
+} // namespace
+
+TEST_F(OverlapSaveReaderTest, test_chunks_match_file)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    TimeFrequency<uint8_t> expected;
+    {
+        sigproc::FileReader<> reader(test_file.file());
+        reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+    }
+    std::size_t const number_of_spectra = expected.number_of_spectra();
+    ASSERT_GE(number_of_spectra, 8U);
+
+    // exercise both the in buffer advance and the wrap back to the start of the buffer
+    for(std::size_t buffer_chunks : { 1U, 2U, 4U }) {
+        for(std::size_t overlap : { 0U, 1U, 3U }) {
+            sigproc::FileReader<> file(test_file.file());
+            verify_chunks(file, expected, 5, overlap, buffer_chunks);
+        }
+    }
+}
+
+TEST_F(OverlapSaveReaderTest, test_single_short_chunk)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    TimeFrequency<uint8_t> expected;
+    {
+        sigproc::FileReader<> reader(test_file.file());
+        reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+    }
+    std::size_t const number_of_spectra = expected.number_of_spectra();
+    sigproc::FileReader<> file(test_file.file());
+    verify_chunks(file, expected, number_of_spectra + 10, 2, 2);
+}
+
+TEST_F(OverlapSaveReaderTest, test_mapped_file_chunks_match_file)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    TimeFrequency<uint8_t> expected;
+    {
+        sigproc::FileReader<> reader(test_file.file());
+        reader >> ResizeAdapter<units::Time, units::Frequency>() >> expected;
+    }
+    std::size_t const number_of_spectra = expected.number_of_spectra();
+
+    for(std::size_t overlap : { 0U, 1U, 3U }) {
+        sigproc::MappedFileReader<> file(test_file.file());
+        verify_chunks(file, expected, 5, overlap, 1);
+    }
+    sigproc::MappedFileReader<> file(test_file.file());
+    verify_chunks(file, expected, number_of_spectra + 10, 2, 1);
+}
+
+TEST_F(OverlapSaveReaderTest, test_invalid_overlap)
+{
+    SigProcFilterBankTestFile<uint8_t> test_file;
+    sigproc::FileReader<> file(test_file.file());
+    typedef sigproc::OverlapSaveReader<uint8_t> ReaderType;
+    ASSERT_THROW(ReaderType(file, DimensionSize<units::Time>(4), DimensionSize<units::Time>(4)), std::invalid_argument);
+}
+
+} // namespace test
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
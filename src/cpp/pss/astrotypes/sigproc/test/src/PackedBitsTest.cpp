@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../PackedBitsTest.h"
+#include "pss/astrotypes/sigproc/PackedBits.h"
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace test {
+
+
+PackedBitsTest::PackedBitsTest()
+    : ::testing::Test()
+{
+}
+
+PackedBitsTest::~PackedBitsTest()
+{
+}
+
+void PackedBitsTest::SetUp()
+{
+}
+
+void PackedBitsTest::TearDown()
+{
+}
+
+TEST_F(PackedBitsTest, test_bit_order)
+{
+    // first sample in the least significant bits
+    std::vector<uint8_t> packed = { 0x1e };
+    std::vector<uint8_t> unpacked(8);
+
+    PackedBits<4>::unpack(packed.data(), 2, unpacked.data());
+    ASSERT_EQ(0xe, unpacked[0]);
+    ASSERT_EQ(0x1, unpacked[1]);
+
+    PackedBits<2>::unpack(packed.data(), 4, unpacked.data());
+    ASSERT_EQ(2U, unpacked[0]);
+    ASSERT_EQ(3U, unpacked[1]);
+    ASSERT_EQ(1U, unpacked[2]);
+    ASSERT_EQ(0U, unpacked[3]);
+
+    PackedBits<1>::unpack(packed.data(), 8, unpacked.data());
+    std::vector<uint8_t> const expected = { 0, 1, 1, 1, 1, 0, 0, 0 };
+    ASSERT_EQ(expected, unpacked);
+}
+
+template<unsigned NBits, typename T>
+void test_round_trip(std::size_t number_of_samples)
+{
+    std::vector<T> input(number_of_samples);
+    for(std::size_t i = 0; i < number_of_samples; ++i) {
+        input[i] = static_cast<T>((i * 7 + 3) % (1U << NBits));
+    }
+    std::vector<uint8_t> packed(PackedBits<NBits>::bytes(number_of_samples), 0xff);
+    PackedBits<NBits>::pack(input.data(), number_of_samples, packed.data());
+
+    std::vector<T> output(number_of_samples);
+    PackedBits<NBits>::unpack(packed.data(), number_of_samples, output.data());
+    ASSERT_EQ(input, output) << NBits << " bits, " << number_of_samples << " samples";
+
+    // unused bits are zeroed
+    std::size_t const remainder = number_of_samples % PackedBits<NBits>::samples_per_byte;
+    if(remainder) {
+        ASSERT_EQ(0, packed.back() >> (remainder * NBits));
+    }
+}
+
+TEST_F(PackedBitsTest, test_pack_unpack)
+{
+    for(std::size_t n : { 0, 1, 3, 8, 13, 64, 101 }) {
+        test_round_trip<1, uint8_t>(n);
+        test_round_trip<2, uint8_t>(n);
+        test_round_trip<4, uint8_t>(n);
+        test_round_trip<1, float>(n);
+        test_round_trip<2, float>(n);
+        test_round_trip<4, float>(n);
+    }
+}
+
+TEST_F(PackedBitsTest, test_pack_truncates)
+{
+    std::vector<uint8_t> input = { 0xff, 0x10 };
+    std::vector<uint8_t> packed(1);
+    PackedBits<4>::pack(input.data(), 2, packed.data());
+    ASSERT_EQ(0x0f, packed[0]);
+}
+
+} // namespace test
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../PackedSigProcFormatTest.h"
+#include "pss/astrotypes/sigproc/PackedSigProcFormat.h"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace pss {
+namespace astrotypes {
+namespace sigproc {
+namespace test {
+
+
+PackedSigProcFormatTest::PackedSigProcFormatTest()
+    : ::testing::Test()
+{
+}
+
+PackedSigProcFormatTest::~PackedSigProcFormatTest()
+{
+}
+
+void PackedSigProcFormatTest::SetUp()
+{
+}
+
+void PackedSigProcFormatTest::TearDown()
+{
+}
+
+TEST_F(PackedSigProcFormatTest, test_time_frequency_tf_data)
+{
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 4> TestType;
+    TimeFrequency<uint8_t> time_frequency(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(16));
+    uint8_t n = 0;
+    std::generate(time_frequency.begin(), time_frequency.end(), [&]() { return ++n % 16;} );
+
+    std::stringstream ss;
+    ss << TestType() << time_frequency;
+    ASSERT_EQ(time_frequency.data_size() / 2, ss.str().size());
+
+    TimeFrequency<uint8_t> time_frequency_2(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(16));
+    ss >> TestType() >> time_frequency_2;
+    ASSERT_EQ(time_frequency, time_frequency_2);
+}
+
+TEST_F(PackedSigProcFormatTest, test_time_frequency_ft_float_data)
+{
+    // unpack into a float type with a different memory ordering from the stream
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 2> TestType;
+    TimeFrequency<uint8_t> time_frequency(DimensionSize<units::Time>(12), DimensionSize<units::Frequency>(8));
+    uint8_t n = 0;
+    std::generate(time_frequency.begin(), time_frequency.end(), [&]() { return (n += 3) % 4;} );
+
+    std::stringstream ss;
+    ss << TestType() << time_frequency;
+    ASSERT_EQ(time_frequency.data_size() / 4, ss.str().size());
+
+    FrequencyTime<float> frequency_time(DimensionSize<units::Time>(12), DimensionSize<units::Frequency>(8));
+    ss >> TestType() >> frequency_time;
+    FrequencyTime<float> expected(time_frequency);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), frequency_time.begin()));
+
+    // and out again
+    std::stringstream ss_2;
+    ss_2 << TestType() << frequency_time;
+    ASSERT_EQ(ss.str(), ss_2.str());
+}
+
+TEST_F(PackedSigProcFormatTest, test_short_read)
+{
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 1> TestType;
+    std::stringstream ss;
+    ss.write("\xff", 1);
+
+    TimeFrequency<uint8_t> time_frequency(DimensionSize<units::Time>(2), DimensionSize<units::Frequency>(8));
+    std::fill(time_frequency.begin(), time_frequency.end(), 0);
+    ss >> TestType() >> time_frequency;
+    ASSERT_TRUE(ss.eof());
+    auto const spectrum = time_frequency.spectrum(0);
+    ASSERT_TRUE(std::all_of(spectrum.begin(), spectrum.end(), [](uint8_t v) { return v == 1; }));
+}
+
+TEST_F(PackedSigProcFormatTest, test_chunked_read)
+{
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 1> TestType;
+
+    // 3x3 1 bit samples do not fill a whole number of bytes in a chunk
+    TimeFrequency<uint8_t> time_frequency(DimensionSize<units::Time>(3), DimensionSize<units::Frequency>(3));
+    std::fill(time_frequency.begin(), time_frequency.end(), 1);
+    std::stringstream ss;
+    ASSERT_THROW(ss << TestType() << time_frequency, std::invalid_argument);
+    ASSERT_TRUE(ss.str().empty());
+
+    ss.write("\xff\xff", 2);
+    TimeFrequency<uint8_t> spectrum(DimensionSize<units::Time>(1), DimensionSize<units::Frequency>(3));
+    ASSERT_THROW(ss >> TestType() >> spectrum, std::invalid_argument);
+    ASSERT_EQ(std::streampos(0), ss.tellg()); // nothing consumed
+
+    // chunks that fill whole bytes continue where the last one left off
+    TimeFrequency<uint8_t> expected(DimensionSize<units::Time>(3), DimensionSize<units::Frequency>(8));
+    uint8_t n = 0;
+    std::generate(expected.begin(), expected.end(), [&]() { return ++n % 3 == 0; } );
+    std::stringstream ss_2;
+    ss_2 << TestType() << expected;
+    ASSERT_EQ(3U, ss_2.str().size());
+
+    TimeFrequency<uint8_t> chunk(DimensionSize<units::Time>(1), DimensionSize<units::Frequency>(8));
+    TestType adapter;
+    for(std::size_t spectrum_number = 0; spectrum_number < 3; ++spectrum_number) {
+        ss_2 >> adapter >> chunk;
+        auto const expected_spectrum = expected.spectrum(spectrum_number);
+        ASSERT_TRUE(std::equal(expected_spectrum.begin(), expected_spectrum.end(), chunk.begin())) << spectrum_number;
+    }
+}
+
+TEST_F(PackedSigProcFormatTest, test_multiple_staging_blocks)
+{
+    // large enough that the packed data is staged through more than one block in each direction
+    typedef PackedSigProcFormat<units::Time, units::Frequency, 2> TestType;
+    TimeFrequency<uint8_t> time_frequency(DimensionSize<units::Time>(1001), DimensionSize<units::Frequency>(128));
+    uint8_t n = 0;
+    std::generate(time_frequency.begin(), time_frequency.end(), [&]() { return (n += 7) % 4;} );
+
+    std::stringstream ss;
+    ss << TestType() << time_frequency;
+    ASSERT_EQ(time_frequency.data_size() / 4, ss.str().size());
+
+    FrequencyTime<uint8_t> frequency_time(DimensionSize<units::Time>(1001), DimensionSize<units::Frequency>(128));
+    ss >> TestType() >> frequency_time;
+    FrequencyTime<uint8_t> expected(time_frequency);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), frequency_time.begin()));
+}
+
+} // namespace test
+} // namespace sigproc
+} // namespace astrotypes
+} // namespace pss
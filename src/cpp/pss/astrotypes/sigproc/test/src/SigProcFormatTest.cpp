@@ -23,6 +23,8 @@
  */
 #include "pss/astrotypes/sigproc/test/SigProcFormatTest.h"
 #include "pss/astrotypes/sigproc/SigProcFormat.h"
+#include "pss/astrotypes/types/PolarisationTimeFrequency.h"
+#include <array>
 #include <algorithm>
 
 
@@ -128,6 +130,107 @@ TEST_F(SigProcFormatTest, test_frequency_time_ft_data)
     ASSERT_EQ(frequency_time, frequency_time_2);
 }
 
+TEST_F(SigProcFormatTest, test_time_frequency_tf_to_ft_data)
+{
+    // spectrum ordered stream read into channel ordered data
+    typedef SigProcFormat<units::Time, units::Frequency> TestType;
+    TimeFrequency<uint16_t> time_frequency(DimensionSize<units::Time>(11), DimensionSize<units::Frequency>(7));
+    uint16_t n = 0;
+    std::generate(time_frequency.begin(), time_frequency.end(), [&]() { return ++n;} );
+
+    std::stringstream ss;
+    ss << TestType() << time_frequency;
+
+    FrequencyTime<uint16_t> frequency_time(DimensionSize<units::Time>(11), DimensionSize<units::Frequency>(7));
+    ss >> TestType() >> frequency_time;
+    ASSERT_EQ(FrequencyTime<uint16_t>(time_frequency), frequency_time);
+
+    // and back out again
+    std::stringstream ss_2;
+    ss_2 << TestType() << frequency_time;
+    ASSERT_EQ(ss.str(), ss_2.str());
+}
+
+TEST_F(SigProcFormatTest, test_frequency_time_ft_to_tf_data)
+{
+    // channel ordered stream read into spectrum ordered data
+    typedef SigProcFormat<units::Frequency, units::Time> TestType;
+    FrequencyTime<uint16_t> frequency_time(DimensionSize<units::Time>(11), DimensionSize<units::Frequency>(7));
+    uint16_t n = 0;
+    std::generate(frequency_time.begin(), frequency_time.end(), [&]() { return ++n;} );
+
+    std::stringstream ss;
+    ss << TestType() << frequency_time;
+
+    TimeFrequency<uint16_t> time_frequency(DimensionSize<units::Time>(11), DimensionSize<units::Frequency>(7));
+    ss >> TestType() >> time_frequency;
+    ASSERT_EQ(TimeFrequency<uint16_t>(frequency_time), time_frequency);
+
+    std::stringstream ss_2;
+    ss_2 << TestType() << time_frequency;
+    ASSERT_EQ(ss.str(), ss_2.str());
+}
+
+TEST_F(SigProcFormatTest, test_time_frequency_slice_data)
+{
+    // read into and write from a slice that does not span the full channel range
+    typedef SigProcFormat<units::Time, units::Frequency> TestType;
+    TimeFrequency<uint16_t> source(DimensionSize<units::Time>(5), DimensionSize<units::Frequency>(3));
+    uint16_t n = 0;
+    std::generate(source.begin(), source.end(), [&]() { return ++n;} );
+
+    std::stringstream ss;
+    ss << TestType() << source;
+
+    TimeFrequency<uint16_t> time_frequency(DimensionSize<units::Time>(8), DimensionSize<units::Frequency>(10));
+    std::fill(time_frequency.begin(), time_frequency.end(), 0);
+    auto slice = time_frequency.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(2), DimensionSize<units::Time>(5))
+                                     , DimensionSpan<units::Frequency>(DimensionIndex<units::Frequency>(4), DimensionSize<units::Frequency>(3)));
+    ss >> TestType() >> slice;
+
+    for(std::size_t t = 0; t < time_frequency.dimension<units::Time>(); ++t) {
+        for(std::size_t f = 0; f < time_frequency.dimension<units::Frequency>(); ++f) {
+            bool const in_slice = t >= 2 && t < 7 && f >= 4 && f < 7;
+            uint16_t const expected = in_slice ? source[DimensionIndex<units::Time>(t - 2)][DimensionIndex<units::Frequency>(f - 4)] : 0;
+            ASSERT_EQ(expected, (time_frequency[DimensionIndex<units::Time>(t)][DimensionIndex<units::Frequency>(f)])) << "t=" << t << " f=" << f;
+        }
+    }
+
+    std::stringstream ss_2;
+    ss_2 << TestType() << slice;
+    ASSERT_EQ(ss.str(), ss_2.str());
+}
+
+TEST_F(SigProcFormatTest, test_time_frequency_polarisation_data)
+{
+    // stream with interleaved polarisations read into seperate polarisation blocks
+    typedef SigProcFormat<units::Time, units::Frequency> TestType;
+    TimeFrequency<std::array<uint16_t, 2>> interleaved(DimensionSize<units::Time>(11), DimensionSize<units::Frequency>(7));
+    uint16_t n = 0;
+    for(auto& value : interleaved) {
+        value[0] = ++n;
+        value[1] = n + 1000;
+    }
+
+    std::stringstream ss;
+    ss << TestType() << interleaved;
+
+    PolarisationTimeFrequency<uint16_t> data(DimensionSize<units::Time>(11), DimensionSize<units::Polarisation>(2), DimensionSize<units::Frequency>(7));
+    ss >> TestType() >> data;
+    for(std::size_t t = 0; t < 11; ++t) {
+        for(std::size_t f = 0; f < 7; ++f) {
+            auto const& expected = interleaved[DimensionIndex<units::Time>(t)][DimensionIndex<units::Frequency>(f)];
+            ASSERT_EQ(expected[0], (data.polarisation(0)[DimensionIndex<units::Time>(t)][DimensionIndex<units::Polarisation>(0)][DimensionIndex<units::Frequency>(f)])) << "t=" << t << " f=" << f;
+            ASSERT_EQ(expected[1], (data.polarisation(1)[DimensionIndex<units::Time>(t)][DimensionIndex<units::Polarisation>(0)][DimensionIndex<units::Frequency>(f)])) << "t=" << t << " f=" << f;
+        }
+    }
+
+    // and back out again
+    std::stringstream ss_2;
+    ss_2 << TestType() << data;
+    ASSERT_EQ(ss.str(), ss_2.str());
+}
+
 } // namespace test
 } // namespace sigproc
 } // namespace astrotypes
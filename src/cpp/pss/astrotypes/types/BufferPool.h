@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_TYPES_BUFFERPOOL_H
+#define PSS_ASTROTYPES_TYPES_BUFFERPOOL_H
+
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief A thread safe pool of recycled TimeFrequency or FrequencyTime data blocks
+ * @details Streaming pipelines typically need a new data block of the same shape for every chunk.
+ *          The pool keeps the blocks that have been released, keyed on their shape, and hands them
+ *          out again rather than allocating (and initialising) new ones.
+ *
+ *          Blocks are returned to the pool automatically when the BufferType returned by acquire() goes out of scope.
+ *          The pool may be destroyed before all blocks have been returned.
+ *
+ * @tparam DataT : TimeFrequency or FrequencyTime type
+ * @code
+ *      BufferPool<TimeFrequency<uint8_t>> pool(BufferPool<TimeFrequency<uint8_t>>::Initialisation::None);
+ *      while(file_reader.good()) {
+ *          auto data = pool.acquire(DimensionSize<Time>(8192), file_reader.dimension<Frequency>());
+ *          file_reader >> *data;
+ *          process(std::move(data));
+ *      }
+ * @endcode
+ */
+template<typename DataT>
+class BufferPool
+{
+        class Store;
+
+    public:
+        typedef DataT DataType;
+
+        /// what to do with the data in a block taken from the pool
+        enum class Initialisation {
+            Value,  ///< reset every element to value_type() (as for a newly constructed block)
+            None    ///< leave the data as it was when the block was released (new blocks are not initialised)
+        };
+
+        /// returns the data to the pool
+        class Releaser
+        {
+            public:
+                Releaser();
+                Releaser(std::shared_ptr<Store> const& store);
+                void operator()(DataT*) const;
+
+            private:
+                std::shared_ptr<Store> _store;
+        };
+
+        /// a block of data from the pool. The block is returned to the pool on destruction
+        typedef std::unique_ptr<DataT, Releaser> BufferType;
+
+    public:
+        BufferPool(Initialisation initialisation = Initialisation::Value);
+        BufferPool(BufferPool const&) = delete;
+        BufferPool& operator=(BufferPool const&) = delete;
+        ~BufferPool();
+
+        /**
+         * @brief return a block of the requested shape, reusing a released block where possible
+         */
+        BufferType acquire(DimensionSize<units::Time> number_of_spectra, DimensionSize<units::Frequency> number_of_channels);
+        BufferType acquire(DimensionSize<units::Frequency> number_of_channels, DimensionSize<units::Time> number_of_spectra);
+
+        /// number of acquire() calls satisfied from previously released blocks
+        std::size_t hits() const;
+
+        /// number of acquire() calls that required a new block
+        std::size_t misses() const;
+
+        /// the fraction of acquire() calls satisfied from previously released blocks
+        double hit_rate() const;
+
+        /// number of blocks acquired and not yet released
+        std::size_t outstanding() const;
+
+        /// number of released blocks held by the pool waiting to be reused
+        std::size_t available() const;
+
+        /// free all the released blocks held by the pool
+        void clear();
+
+    private:
+        std::shared_ptr<Store> _store;
+};
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/BufferPool.cpp"
+
+#endif // PSS_ASTROTYPES_TYPES_BUFFERPOOL_H
@@ -0,0 +1,247 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_TYPES_CIRCULARTIMEFREQUENCY_H
+#define PSS_ASTROTYPES_TYPES_CIRCULARTIMEFREQUENCY_H
+
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief A random access iterator over a block of memory treated as a ring
+ * @details Iterating past the physical end of the block continues from the physical beginning.
+ */
+template<typename T>
+class CircularIterator
+{
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_const<T>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+    public:
+        /**
+         * @param begin the start of the memory block
+         * @param size the number of elements in the block
+         * @param start the offset into the block of the logical first element
+         * @param index the logical position of this iterator
+         */
+        CircularIterator(T* begin, std::size_t size, std::size_t start, std::size_t index);
+
+        /// conversion to a const iterator
+        template<typename OtherT, typename Enable=typename std::enable_if<std::is_same<T, OtherT const>::value>::type>
+        CircularIterator(CircularIterator<OtherT> const&);
+
+        reference operator*() const;
+        pointer operator->() const;
+        reference operator[](difference_type n) const;
+
+        CircularIterator& operator++();
+        CircularIterator operator++(int);
+        CircularIterator& operator--();
+        CircularIterator operator--(int);
+        CircularIterator& operator+=(difference_type n);
+        CircularIterator& operator-=(difference_type n);
+        CircularIterator operator+(difference_type n) const;
+        CircularIterator operator-(difference_type n) const;
+        difference_type operator-(CircularIterator const&) const;
+
+        bool operator==(CircularIterator const&) const;
+        bool operator!=(CircularIterator const&) const;
+        bool operator<(CircularIterator const&) const;
+        bool operator>(CircularIterator const&) const;
+        bool operator<=(CircularIterator const&) const;
+        bool operator>=(CircularIterator const&) const;
+
+    private:
+        template<typename> friend class CircularIterator;
+        T* position(std::size_t index) const;
+
+    private:
+        T* _begin;
+        T* _end;
+        std::size_t _start;
+        std::size_t _index;
+        T* _ptr;
+};
+
+/**
+ * @brief A TimeFrequency block with a circular Time dimension, for keeping a rolling window of the most recent spectra
+ * @details Pushing new spectra overwrites the oldest ones in place, so no data is shifted or reallocated.
+ *          The spectra currently held are accessed in time order (oldest first) through a Window. A Window may
+ *          wrap around the physical end of the buffer; its iterators handle this transparently and
+ *          for_each_contiguous_run() will call its function at most twice.
+ *
+ *          Data can be read directly into the buffer with any reader that accepts a TimeFrequency slice
+ *          (e.g. sigproc::FileReader) using head() and commit().
+ *
+ * @code
+ *      CircularTimeFrequency<uint8_t> ring(DimensionSize<Time>(16384), reader.dimension<Frequency>());
+ *      while(reader.good()) {
+ *          auto head = ring.head(DimensionSize<Time>(1024));   // contiguous space at the head of the ring
+ *          reader >> head;
+ *          ring.commit(head.dimension<Time>());
+ *          process(ring.window());                             // the most recent 16384 (or fewer) spectra
+ *      }
+ * @endcode
+ */
+template<typename T, typename Alloc=std::allocator<T>>
+class CircularTimeFrequency
+{
+    public:
+        typedef TimeFrequency<T, Alloc> StorageType;
+        typedef typename StorageType::SliceType SliceType;
+        typedef typename StorageType::Spectra Spectra;
+        typedef typename StorageType::ConstSpectra ConstSpectra;
+        typedef T value_type;
+
+        /**
+         * @brief a view of a sequence of consecutive spectra held in the buffer, in time order
+         */
+        template<bool is_const>
+        class WindowType
+        {
+                typedef typename std::conditional<is_const, T const, T>::type ElementT;
+                typedef typename std::conditional<is_const, StorageType const, StorageType>::type StorageT;
+
+            public:
+                typedef CircularIterator<ElementT> iterator;
+                typedef CircularIterator<T const> const_iterator;
+                typedef typename std::conditional<is_const, ConstSpectra, Spectra>::type SpectrumType;
+
+            public:
+                WindowType(StorageT& storage, std::size_t first_spectrum, std::size_t number_of_spectra);
+
+                /// iterate over all the elements, spectrum by spectrum
+                iterator begin() const;
+                iterator end() const;
+                const_iterator cbegin() const;
+                const_iterator cend() const;
+
+                /**
+                 * @brief call fn(begin, end) for each contiguous block of data (at most twice)
+                 */
+                template<typename FunctionT>
+                void for_each_contiguous_run(FunctionT&& fn) const;
+
+                /// the spectrum at the given offset from the start of the window
+                SpectrumType spectrum(std::size_t offset) const;
+                SpectrumType operator[](DimensionIndex<units::Time> offset) const;
+
+                std::size_t number_of_spectra() const;
+                std::size_t number_of_channels() const;
+
+                template<typename Dimension>
+                typename std::enable_if<std::is_same<Dimension, units::Time>::value, DimensionSize<units::Time>>::type
+                dimension() const;
+
+                template<typename Dimension>
+                typename std::enable_if<std::is_same<Dimension, units::Frequency>::value, DimensionSize<units::Frequency>>::type
+                dimension() const;
+
+                /// the total number of elements
+                std::size_t data_size() const;
+
+            private:
+                StorageT* _storage;
+                std::size_t _first;
+                std::size_t _size;
+        };
+
+        typedef WindowType<false> Window;
+        typedef WindowType<true> ConstWindow;
+
+    public:
+        CircularTimeFrequency(DimensionSize<units::Time> capacity, DimensionSize<units::Frequency> number_of_channels);
+        CircularTimeFrequency(Alloc const&, DimensionSize<units::Time> capacity, DimensionSize<units::Frequency> number_of_channels);
+
+        /**
+         * @brief copy the spectra in data into the buffer, overwriting the oldest spectra if the buffer is full
+         * @details data may be any type with Time and Frequency dimensions (e.g. a TimeFrequency or one of its slices).
+         *          If data has more spectra than the capacity only the most recent are kept.
+         * @throw std::invalid_argument if the number of channels does not match
+         */
+        template<typename DataT>
+        void push(DataT const& data);
+
+        /**
+         * @brief the space for up to number_of_spectra new spectra at the head of the buffer
+         * @details the slice returned is contiguous in memory and so may be shorter than requested
+         *          if the head is near the physical end of the buffer. The new data does not become
+         *          part of the buffer until commit() is called.
+         */
+        SliceType head(DimensionSize<units::Time> number_of_spectra);
+
+        /**
+         * @brief add the number_of_spectra spectra at the head of the buffer (e.g. after filling the slice returned by head())
+         * @throw std::out_of_range if more spectra are committed than are available at the head
+         */
+        void commit(DimensionSize<units::Time> number_of_spectra);
+
+        /// all the spectra held, oldest first
+        Window window();
+        ConstWindow window() const;
+
+        /// the number_of_spectra spectra starting at offset from the oldest
+        /// @throw std::out_of_range if the window would extend beyond the spectra held
+        Window window(DimensionIndex<units::Time> offset, DimensionSize<units::Time> number_of_spectra);
+        ConstWindow window(DimensionIndex<units::Time> offset, DimensionSize<units::Time> number_of_spectra) const;
+
+        /// remove all the spectra
+        void clear();
+
+        /// the number of spectra currently held
+        std::size_t number_of_spectra() const;
+
+        /// the maximum number of spectra that can be held
+        std::size_t capacity() const;
+
+        std::size_t number_of_channels() const;
+
+        bool empty() const;
+        bool full() const;
+
+        /// the underlying storage, in physical order
+        StorageType const& storage() const;
+
+    private:
+        std::size_t oldest() const;
+
+    private:
+        StorageType _data;
+        std::size_t _head; // physical index of the next spectrum to write
+        std::size_t _size;
+};
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/CircularTimeFrequency.cpp"
+
+#endif // PSS_ASTROTYPES_TYPES_CIRCULARTIMEFREQUENCY_H
@@ -25,6 +25,7 @@
 #define PSS_ASTROTYPES_TYPES_PHASE_FREQUENCY_ARRAY_H
 
 #include "pss/astrotypes/multiarray/MultiArray.h"
+#include "pss/astrotypes/multiarray/SliceRange.h"
 #include "pss/astrotypes/units/Phase.h"
 
 namespace pss {
@@ -54,6 +55,10 @@ class PhaseFrequencyArrayInterface : public SliceT
         typedef typename SliceType::template ConstOperatorSliceType<units::Frequency>::type ConstChannel;
         typedef typename SliceType::template OperatorSliceType<units::PhaseAngle>::type PhaseBin;
         typedef typename SliceType::template ConstOperatorSliceType<units::PhaseAngle>::type ConstPhaseBin;
+        typedef multiarray::SliceRange<Channel, units::Frequency> ChannelRange;
+        typedef multiarray::SliceRange<ConstChannel, units::Frequency> ConstChannelRange;
+        typedef multiarray::SliceRange<PhaseBin, units::PhaseAngle> PhaseBinRange;
+        typedef multiarray::SliceRange<ConstPhaseBin, units::PhaseAngle> ConstPhaseBinRange;
 
 
     public:
@@ -106,6 +111,27 @@ class PhaseFrequencyArrayInterface : public SliceT
         PhaseBin phase_bin(std::size_t phase_bin_number);
         ConstPhaseBin phase_bin(std::size_t phase_bin_number) const;
 
+        /** @brief   Iterate over each frequency channel in turn
+         *
+         *  @details A single Channel object is stepped through the data, rather than
+         *           constructing a new one for each channel as channel(n) does
+         *
+         *  @example
+         *  @code
+         *  for(auto& channel : phase_frequency_array.channels()) {
+         *      std::fill(channel.begin(), channel.end(), 0);
+         *  }
+         *  @endcode
+         */
+        ChannelRange channels();
+        ConstChannelRange channels() const;
+
+        /** @brief   Iterate over each phase bin in turn
+         *  @details As channels() but stepping along the PhaseAngle dimension
+         */
+        PhaseBinRange phase_bins();
+        ConstPhaseBinRange phase_bins() const;
+
         /** @brief   Return the number of frequency channels in the data structure
          *  @details A synonym for dimension<Frequency>()
          */
@@ -146,6 +172,10 @@ class PhaseFrequencyArray : public PhaseFrequencyArrayInterface<
         typedef typename BaseT::ConstChannel ConstChannel;
         typedef typename BaseT::PhaseBin PhaseBin;
         typedef typename BaseT::ConstPhaseBin ConstPhaseBin;
+        typedef typename BaseT::ChannelRange ChannelRange;
+        typedef typename BaseT::ConstChannelRange ConstChannelRange;
+        typedef typename BaseT::PhaseBinRange PhaseBinRange;
+        typedef typename BaseT::ConstPhaseBinRange ConstPhaseBinRange;
 
         typedef typename BaseT::SliceType SliceType;
 
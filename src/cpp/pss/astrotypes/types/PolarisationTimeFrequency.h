@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_TYPES_POLARISATIONTIMEFREQUENCY_H
+#define PSS_ASTROTYPES_TYPES_POLARISATIONTIMEFREQUENCY_H
+
+#include "pss/astrotypes/multiarray/MultiArray.h"
+#include "pss/astrotypes/units/Time.h"
+#include "pss/astrotypes/units/Frequency.h"
+#include "pss/astrotypes/units/Polarisation.h"
+#include <memory>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief methods common to PolarisationTimeFrequency and its slices
+ */
+template<typename SliceType>
+class PolarisationTimeFreqCommon : public SliceType
+{
+    public:
+        typedef typename SliceType::template OperatorSliceType<units::Time>::type Spectra;
+        typedef typename SliceType::template ConstOperatorSliceType<units::Time>::type ConstSpectra;
+
+        using SliceType::SliceType;
+
+    public:
+        PolarisationTimeFreqCommon();
+        PolarisationTimeFreqCommon(PolarisationTimeFreqCommon const&);
+        PolarisationTimeFreqCommon(SliceType const& t);
+        PolarisationTimeFreqCommon(SliceType&& t);
+
+        PolarisationTimeFreqCommon& operator=(PolarisationTimeFreqCommon const&);
+
+        /// @brief return a single spectrum (all polarisations) from the specified offset
+        Spectra spectrum(std::size_t offset);
+        ConstSpectra spectrum(std::size_t offset) const;
+
+        /// @brief return the number of channels in the data structure
+        std::size_t number_of_channels() const;
+
+        /// @brief return the number of spectra in the data structure
+        std::size_t number_of_spectra() const;
+
+        /// @brief return the number of polarisations in the data structure
+        std::size_t number_of_polarisations() const;
+};
+
+/**
+ * @brief
+ *       Time/frequency data with more than one polarisation (or IF stream) per channel
+ *
+ * @details
+ *       Each spectrum is stored with the polarisations as seperate contiguous blocks of channels
+ *       (a structure of arrays), rather than as interleaved values per channel. Per polarisation
+ *       work then runs over contiguous memory. See Stokes.h for kernels to convert from the
+ *       interleaved layout and to form Stokes parameters.
+ * @code
+ *       PolarisationTimeFrequency<uint8_t> data(DimensionSize<Time>(1024)
+ *                                             , DimensionSize<Polarisation>(2)
+ *                                             , DimensionSize<Frequency>(4096));
+ *       auto aa = data.polarisation(0);
+ * @endcode
+ */
+template<typename T, typename Alloc=std::allocator<T>>
+class PolarisationTimeFrequency : public PolarisationTimeFreqCommon<multiarray::MultiArray<Alloc, T, PolarisationTimeFreqCommon, units::Time, units::Polarisation, units::Frequency>>
+{
+    private:
+        typedef PolarisationTimeFreqCommon<multiarray::MultiArray<Alloc, T, PolarisationTimeFreqCommon, units::Time, units::Polarisation, units::Frequency>> BaseT;
+
+    public:
+        typedef typename BaseT::Spectra Spectra;
+        typedef typename BaseT::ConstSpectra ConstSpectra;
+        typedef typename BaseT::SliceType PolarisationBlock;
+        typedef typename BaseT::ConstSliceType ConstPolarisationBlock;
+
+    public:
+        PolarisationTimeFrequency();
+        PolarisationTimeFrequency(DimensionSize<units::Time>, DimensionSize<units::Polarisation>, DimensionSize<units::Frequency>);
+
+        /// @brief construct using a specific allocator instance (e.g. for stateful allocators)
+        PolarisationTimeFrequency(Alloc const&, DimensionSize<units::Time>, DimensionSize<units::Polarisation>, DimensionSize<units::Frequency>);
+
+        /// @brief construct without initialising the data (e.g. when it is about to be read from a file)
+        PolarisationTimeFrequency(NoInitialisation const&, DimensionSize<units::Time>, DimensionSize<units::Polarisation>, DimensionSize<units::Frequency>);
+
+        ~PolarisationTimeFrequency();
+
+        /**
+         * @brief return the time/frequency data of a single polarisation
+         * @details the type returned is a MultiArray @class Slice covering all spectra and channels
+         *          with a Polarisation dimension of size 1
+         */
+        PolarisationBlock polarisation(std::size_t index);
+        ConstPolarisationBlock polarisation(std::size_t index) const;
+};
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/PolarisationTimeFrequency.cpp"
+
+#endif // PSS_ASTROTYPES_TYPES_POLARISATIONTIMEFREQUENCY_H
@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_TYPES_STOKES_H
+#define PSS_ASTROTYPES_TYPES_STOKES_H
+
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/types/PolarisationTimeFrequency.h"
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief Kernels for polarisation data
+ * @details Interleaved data has the values of every polarisation of a channel next to each other
+ *          (i.e. TimeFrequency<std::array<T, N>>, as produced by the sigproc DataFactory for nifs > 1).
+ *          The PolarisationTimeFrequency type holds each polarisation as a seperate block of channels.
+ *
+ *          Stokes I is formed as the sum of the first two polarisations. This is correct for both
+ *          dual polarisation power data (AA, BB) and the 4 coherency products (AA, BB, Re(AB*), Im(AB*)).
+ */
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief copy a single spectrum of interleaved values into seperate blocks for each polarisation
+ * @param in  number_of_channels * NumberOfPolarisations interleaved values
+ * @param out an array of NumberOfPolarisations pointers, each to space for number_of_channels values
+ * @details The number of polarisations is a compile time constant so the compiler can vectorise the
+ *          strided loads.
+ */
+template<std::size_t NumberOfPolarisations, typename T, typename OutT>
+void deinterleave(T const* in, std::size_t number_of_channels, OutT* const* out);
+
+/**
+ * @brief as above with the number of polarisations known only at runtime
+ * @details the common cases of 1, 2 and 4 polarisations are dispatched to the fixed size kernel
+ */
+template<typename T, typename OutT>
+void deinterleave(T const* in, std::size_t number_of_channels, std::size_t number_of_polarisations, OutT* const* out);
+
+/**
+ * @brief the inverse of deinterleave
+ */
+template<typename T, typename OutT>
+void interleave(T const* const* in, std::size_t number_of_channels, std::size_t number_of_polarisations, OutT* out);
+
+/**
+ * @brief convert interleaved polarisation data to a PolarisationTimeFrequency
+ * @details out is resized to match the input
+ */
+template<typename T, std::size_t N, typename AllocIn, typename AllocOut>
+void deinterleave(TimeFrequency<std::array<T, N>, AllocIn> const& in, PolarisationTimeFrequency<T, AllocOut>& out);
+
+/**
+ * @brief form Stokes I from a PolarisationTimeFrequency
+ * @details out is resized to match the input. Single polarisation data is copied as is.
+ *          The sum is made in OutT so choose a wider type to avoid overflow (e.g. uint16_t for uint8_t data)
+ */
+template<typename T, typename AllocIn, typename OutT, typename AllocOut>
+void stokes_i(PolarisationTimeFrequency<T, AllocIn> const& in, TimeFrequency<OutT, AllocOut>& out);
+
+/**
+ * @brief form Stokes I directly from interleaved polarisation data in a single pass
+ * @details out is resized to match the input. No intermediate deinterleaved copy is made.
+ */
+template<typename T, std::size_t N, typename AllocIn, typename OutT, typename AllocOut>
+void stokes_i(TimeFrequency<std::array<T, N>, AllocIn> const& in, TimeFrequency<OutT, AllocOut>& out);
+
+/**
+ * @brief form the full Stokes parameters (I, Q, U, V) from the 4 coherency products
+ * @details The input polarisations must be AA, BB, Re(AB*), Im(AB*) (linear feeds). Then
+ *          I = AA + BB, Q = AA - BB, U = 2Re(AB*), V = 2Im(AB*).
+ *          OutT should be a signed type. out is resized to match the input.
+ * @throw std::invalid_argument if the input does not have 4 polarisations
+ */
+template<typename T, typename AllocIn, typename OutT, typename AllocOut>
+void full_stokes(PolarisationTimeFrequency<T, AllocIn> const& in, PolarisationTimeFrequency<OutT, AllocOut>& out);
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/Stokes.cpp"
+
+#endif // PSS_ASTROTYPES_TYPES_STOKES_H
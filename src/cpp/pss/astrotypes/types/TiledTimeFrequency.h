@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PSS_ASTROTYPES_TYPES_TILEDTIMEFREQUENCY_H
+#define PSS_ASTROTYPES_TYPES_TILEDTIMEFREQUENCY_H
+
+#include "pss/astrotypes/multiarray/TiledMultiArray.h"
+#include "pss/astrotypes/units/Time.h"
+#include "pss/astrotypes/units/Frequency.h"
+#include <memory>
+
+namespace pss {
+namespace astrotypes {
+
+/**
+ * @brief Time/Frequency data stored in tiles of spectra x channels
+ * @details Use when an algorithm sweeps both along spectra and along channels of the same block
+ *          (e.g. dedispersion). Convert to and from TimeFrequency or FrequencyTime with the copy
+ *          constructor and copy_to(). See TiledMultiArray for direct tile access.
+ *      @code
+ *      TiledTimeFrequency<float> tiled(tf);
+ *      for(float sample : tiled.channel(10)) { ... }
+ *      @endcode
+ * @tparam LayoutT : the size of each tile (spectra, channels)
+ */
+template<typename T, typename LayoutT=multiarray::TileLayout<64, 64>, typename Alloc=std::allocator<T>>
+class TiledTimeFrequency : public multiarray::TiledMultiArray<T, LayoutT, units::Time, units::Frequency, Alloc>
+{
+        typedef multiarray::TiledMultiArray<T, LayoutT, units::Time, units::Frequency, Alloc> BaseT;
+
+    public:
+        typedef typename BaseT::OuterLineType Spectra;
+        typedef typename BaseT::ConstOuterLineType ConstSpectra;
+        typedef typename BaseT::InnerLineType Channel;
+        typedef typename BaseT::ConstInnerLineType ConstChannel;
+
+    public:
+        using BaseT::BaseT;
+        TiledTimeFrequency();
+
+        /// all the channels of a single spectrum
+        Spectra spectrum(std::size_t offset);
+        ConstSpectra spectrum(std::size_t offset) const;
+
+        /// a single channel across all spectra
+        Channel channel(std::size_t channel_number);
+        ConstChannel channel(std::size_t channel_number) const;
+
+        DimensionSize<units::Time> number_of_spectra() const;
+        DimensionSize<units::Frequency> number_of_channels() const;
+};
+
+} // namespace astrotypes
+} // namespace pss
+#include "detail/TiledTimeFrequency.cpp"
+
+#endif // PSS_ASTROTYPES_TYPES_TILEDTIMEFREQUENCY_H
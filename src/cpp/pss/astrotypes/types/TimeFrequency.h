@@ -27,11 +27,24 @@
 #include "pss/astrotypes/units/Time.h"
 #include "pss/astrotypes/units/Frequency.h"
 #include "pss/astrotypes/multiarray/MultiArray.h"
+#include "pss/astrotypes/multiarray/SliceRange.h"
 #include <memory>
+#include <type_traits>
 
 namespace pss {
 namespace astrotypes {
 
+/**
+ * @brief the Frequency entry of the dimension list of a TimeFrequency or FrequencyTime type
+ * @details units::Frequency if the number of channels is only known at runtime (0),
+ *          StaticDimensionSize<units::Frequency, NumberOfChannels> otherwise
+ */
+template<std::size_t NumberOfChannels>
+using FrequencyDimension = typename std::conditional<NumberOfChannels == 0
+                                                    , units::Frequency
+                                                    , StaticDimensionSize<units::Frequency, NumberOfChannels>
+                                                    >::type;
+
 template<typename SliceType>
 class TimeFreqCommon : public SliceType
 {
@@ -40,6 +53,10 @@ class TimeFreqCommon : public SliceType
         typedef typename SliceType::template ConstOperatorSliceType<units::Frequency>::type ConstChannel;
         typedef typename SliceType::template OperatorSliceType<units::Time>::type Spectra;
         typedef typename SliceType::template ConstOperatorSliceType<units::Time>::type ConstSpectra;
+        typedef multiarray::SliceRange<Channel, units::Frequency> ChannelRange;
+        typedef multiarray::SliceRange<ConstChannel, units::Frequency> ConstChannelRange;
+        typedef multiarray::SliceRange<Spectra, units::Time> SpectraRange;
+        typedef multiarray::SliceRange<ConstSpectra, units::Time> ConstSpectraRange;
 
         using SliceType::SliceType;
 
@@ -93,6 +110,24 @@ class TimeFreqCommon : public SliceType
         Spectra spectrum(std::size_t offset);
         ConstSpectra spectrum(std::size_t offset) const;
 
+        /// @brief iterate over each spectrum in turn
+        //  @details a single Spectra object is stepped through the data, rather than constructing
+        //           a new one for each spectrum as spectrum(n) does
+        //  @example
+        //  @code
+        //  for(auto const& spectrum : tf.spectra()) {
+        //      float sum = std::accumulate(spectrum.begin(), spectrum.end(), 0.0f);
+        //  }
+        //  @endcode
+        //
+        SpectraRange spectra();
+        ConstSpectraRange spectra() const;
+
+        /// @brief iterate over each channel in turn
+        //  @details as spectra() but stepping along the Frequency dimension
+        ChannelRange channels();
+        ConstChannelRange channels() const;
+
         /// @brief return the number of channels in the data structure
         //  @details a synonym for dimension<Frequency>()
         std::size_t number_of_channels() const;
@@ -109,25 +144,39 @@ class TimeFreqCommon : public SliceType
  *
  * @details
  *       Stored as a contiguous block af complete spectrum.
+ *       A non zero NumberOfChannels fixes the number of channels at compile time
+ *       (see StaticDimensionSize).
  */
 
-template<typename T, typename Alloc=std::allocator<T>>
-class TimeFrequency : public TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Time, units::Frequency>>
+template<typename T, typename Alloc=std::allocator<T>, std::size_t NumberOfChannels=0>
+class TimeFrequency : public TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Time, FrequencyDimension<NumberOfChannels>>>
 {
     private:
-        typedef TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Time, units::Frequency>> BaseT;
+        typedef TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Time, FrequencyDimension<NumberOfChannels>>> BaseT;
 
     public:
         typedef typename BaseT::Channel Channel;
         typedef typename BaseT::ConstChannel ConstChannel;
         typedef typename BaseT::Spectra Spectra;
         typedef typename BaseT::ConstSpectra ConstSpectra;
+        typedef typename BaseT::ChannelRange ChannelRange;
+        typedef typename BaseT::ConstChannelRange ConstChannelRange;
+        typedef typename BaseT::SpectraRange SpectraRange;
+        typedef typename BaseT::ConstSpectraRange ConstSpectraRange;
 
     public:
         TimeFrequency();
         TimeFrequency(DimensionSize<units::Time>, DimensionSize<units::Frequency>);
         TimeFrequency(DimensionSize<units::Frequency>, DimensionSize<units::Time>);
 
+        /// @brief construct using a specific allocator instance (e.g. for stateful allocators)
+        TimeFrequency(Alloc const&, DimensionSize<units::Time>, DimensionSize<units::Frequency>);
+        TimeFrequency(Alloc const&, DimensionSize<units::Frequency>, DimensionSize<units::Time>);
+
+        /// @brief construct without initialising the data (e.g. when it is about to be read from a file)
+        TimeFrequency(NoInitialisation const&, DimensionSize<units::Time>, DimensionSize<units::Frequency>);
+        TimeFrequency(NoInitialisation const&, DimensionSize<units::Frequency>, DimensionSize<units::Time>);
+
         /**
          * @brief The transpose constructor
          * @details copy data from a FrequencyTime object
@@ -148,24 +197,37 @@ class TimeFrequency : public TimeFreqCommon<multiarray::MultiArray<Alloc, T, Tim
  *       Stored as a multiple contiguous time series. This can be used in exactly the same
  *       calls as the TimeFrequency object. They are designed to be interchangable
  *       without having to rewrite any code that uses this interface.
+ *       A non zero NumberOfChannels fixes the number of channels at compile time.
  */
-template<typename T, typename Alloc=std::allocator<T>>
-class FrequencyTime : public TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Frequency, units::Time>>
+template<typename T, typename Alloc=std::allocator<T>, std::size_t NumberOfChannels=0>
+class FrequencyTime : public TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, FrequencyDimension<NumberOfChannels>, units::Time>>
 {
     private:
-        typedef TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, units::Frequency, units::Time>> BaseT;
+        typedef TimeFreqCommon<multiarray::MultiArray<Alloc, T, TimeFreqCommon, FrequencyDimension<NumberOfChannels>, units::Time>> BaseT;
 
     public:
         typedef typename BaseT::Channel Channel;
         typedef typename BaseT::ConstChannel ConstChannel;
         typedef typename BaseT::Spectra Spectra;
         typedef typename BaseT::ConstSpectra ConstSpectra;
+        typedef typename BaseT::ChannelRange ChannelRange;
+        typedef typename BaseT::ConstChannelRange ConstChannelRange;
+        typedef typename BaseT::SpectraRange SpectraRange;
+        typedef typename BaseT::ConstSpectraRange ConstSpectraRange;
 
     public:
         FrequencyTime();
         FrequencyTime(DimensionSize<units::Frequency>, DimensionSize<units::Time>);
         FrequencyTime(DimensionSize<units::Time>, DimensionSize<units::Frequency>);
 
+        /// @brief construct using a specific allocator instance (e.g. for stateful allocators)
+        FrequencyTime(Alloc const&, DimensionSize<units::Frequency>, DimensionSize<units::Time>);
+        FrequencyTime(Alloc const&, DimensionSize<units::Time>, DimensionSize<units::Frequency>);
+
+        /// @brief construct without initialising the data (e.g. when it is about to be read from a file)
+        FrequencyTime(NoInitialisation const&, DimensionSize<units::Frequency>, DimensionSize<units::Time>);
+        FrequencyTime(NoInitialisation const&, DimensionSize<units::Time>, DimensionSize<units::Frequency>);
+
         /**
          * @brief The transpose constructor
          * @details copy data from a TimeFrequency object
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/Stokes.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Compares ways of forming Stokes I from dual polarisation data with interleaved polarisations:
+ * an element by element loop over the interleaved TimeFrequency, the fused stokes_i kernel, and
+ * deinterleaving to a PolarisationTimeFrequency first.
+ *
+ * usage: stokes_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint8_t T;
+typedef std::array<T, 2> InterleavedT;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+void report(std::string const& name, double seconds, double bytes)
+{
+    std::cout << std::setw(28) << name
+              << std::setw(16) << seconds * 1e3
+              << std::setw(16) << bytes / seconds / 1e9
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 128.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(InterleavedT) * channels)));
+    double const bytes = sizeof(InterleavedT) * static_cast<double>(static_cast<std::size_t>(spectra) * static_cast<std::size_t>(channels));
+
+    TimeFrequency<InterleavedT> interleaved(spectra, channels);
+    T n = 0;
+    for(auto& value : interleaved) {
+        value[0] = n++;
+        value[1] = n;
+    }
+    TimeFrequency<uint16_t> expected(spectra, channels);
+    TimeFrequency<uint16_t> stokes(spectra, channels);
+    PolarisationTimeFrequency<T> deinterleaved;
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of 2 x uint8_t)\n";
+    std::cout << std::setw(28) << "method"
+              << std::setw(16) << "time (ms)"
+              << std::setw(16) << "input (GB/s)"
+              << "\n";
+
+    report("element loop", time_it(iterations, [&]() {
+        std::transform(interleaved.cbegin(), interleaved.cend(), expected.begin()
+                      , [](InterleavedT const& v) { return static_cast<uint16_t>(v[0] + v[1]); });
+    }), bytes);
+
+    report("fused stokes_i", time_it(iterations, [&]() { stokes_i(interleaved, stokes); }), bytes);
+    if(!(stokes == expected)) {
+        std::cerr << "error: fused stokes_i produced unexpected values" << std::endl;
+        return 1;
+    }
+
+    report("deinterleave", time_it(iterations, [&]() { deinterleave(interleaved, deinterleaved); }), bytes);
+    report("stokes_i (deinterleaved)", time_it(iterations, [&]() { stokes_i(deinterleaved, stokes); }), bytes);
+    if(!(stokes == expected)) {
+        std::cerr << "error: stokes_i produced unexpected values" << std::endl;
+        return 1;
+    }
+    return 0;
+}
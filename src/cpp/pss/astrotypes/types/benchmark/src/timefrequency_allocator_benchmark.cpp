@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/multiarray/AlignedAllocator.h"
+#include "pss/astrotypes/multiarray/HugePageAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Compares full array iteration over a large TimeFrequency block with different allocators.
+ * Reports the time to first touch (page faults), the read throughput and, where the kernel
+ * allows access to the performance counters, the number of data TLB misses during the read.
+ *
+ * usage: timefrequency_allocator_benchmark [size_in_GB] [numa_node]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+// counts dTLB read misses for the calling thread (Linux perf events)
+class TlbMissCounter
+{
+    public:
+        TlbMissCounter() : _fd(-1)
+        {
+#if defined(__linux__)
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB
+                        | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                        | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            _fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+        }
+
+        ~TlbMissCounter()
+        {
+#if defined(__linux__)
+            if(_fd >= 0) ::close(_fd);
+#endif
+        }
+
+        void start()
+        {
+#if defined(__linux__)
+            if(_fd < 0) return;
+            ::ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+
+        /// the number of misses since start() as a string ("n/a" if unavailable)
+        std::string stop()
+        {
+#if defined(__linux__)
+            long long count = 0;
+            if(_fd >= 0) {
+                ::ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+                if(::read(_fd, &count, sizeof(count)) == sizeof(count)) return std::to_string(count);
+            }
+#endif
+            return "n/a";
+        }
+
+    private:
+        int _fd;
+};
+
+template<typename AllocatorT>
+void run(std::string const& name, AllocatorT const& allocator, DimensionSize<Time> spectra, DimensionSize<Frequency> channels)
+{
+    typedef std::chrono::high_resolution_clock ClockType;
+    typedef typename AllocatorT::value_type T;
+    double const bytes = sizeof(T) * static_cast<double>(static_cast<std::size_t>(spectra) * static_cast<std::size_t>(channels));
+
+    // allocation and first touch (the constructor value initialises all the data)
+    auto start = ClockType::now();
+    TimeFrequency<T, AllocatorT> tf(allocator, spectra, channels);
+    std::chrono::duration<double> touch_time = ClockType::now() - start;
+
+    std::fill(tf.begin(), tf.end(), 1);
+
+    TlbMissCounter tlb_misses;
+    tlb_misses.start();
+    start = ClockType::now();
+    double const sum = std::accumulate(tf.begin(), tf.end(), 0.0);
+    std::chrono::duration<double> read_time = ClockType::now() - start;
+    std::string const misses = tlb_misses.stop();
+
+    if(sum != static_cast<double>(tf.data_size())) {
+        std::cerr << "error: unexpected sum" << std::endl;
+        std::exit(1);
+    }
+
+    std::cout << std::setw(26) << name
+              << std::setw(16) << touch_time.count()
+              << std::setw(16) << bytes / read_time.count() / 1e9
+              << std::setw(16) << misses
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const gb = argc > 1 ? std::atof(argv[1]) : 1.0;
+    int const numa_node = argc > 2 ? std::atoi(argv[2]) : HugePageAllocator<float>::any_numa_node;
+
+    typedef float T;
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(gb * 1024 * 1024 * 1024 / (sizeof(T) * channels)));
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << gb << " GB of float)\n";
+    std::cout << std::setw(26) << "allocator"
+              << std::setw(16) << "touch (s)"
+              << std::setw(16) << "read (GB/s)"
+              << std::setw(16) << "dTLB misses"
+              << "\n";
+    run("std::allocator", std::allocator<T>(), spectra, channels);
+    run("AlignedAllocator", AlignedAllocator<T>(), spectra, channels);
+    run("HugePageAllocator(THP)", HugePageAllocator<T>(HugePagePolicy::Transparent, numa_node), spectra, channels);
+    run("HugePageAllocator(TLB)", HugePageAllocator<T>(HugePagePolicy::HugeTlb, numa_node), spectra, channels);
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/multiarray/Algorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Compares element by element copy, fill and compare through the slice iterators with the run aware
+ * bulk_copy, bulk_fill and bulk_equal, for a block of complete spectra and for a sub-band (a slice in
+ * both dimensions) copied between two TimeFrequency buffers.
+ *
+ * usage: timefrequency_bulk_copy_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint8_t T;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+void report(std::string const& name, double element_time, double bulk_time, double bytes)
+{
+    std::cout << std::setw(16) << name
+              << std::setw(16) << bytes / element_time / 1e9
+              << std::setw(16) << bytes / bulk_time / 1e9
+              << std::setw(12) << element_time / bulk_time
+              << "\n";
+}
+
+template<typename SrcT, typename DstT>
+void run(std::string const& label, SrcT const& src, DstT&& dst, unsigned iterations)
+{
+    double const bytes = static_cast<double>(src.data_size() * sizeof(T));
+    bool same = true;
+
+    double const copy_element = time_it(iterations, [&]() { std::copy(src.cbegin(), src.cend(), dst.begin()); });
+    double const copy_bulk = time_it(iterations, [&]() { multiarray::bulk_copy(src, dst); });
+    report(label + " copy", copy_element, copy_bulk, bytes);
+
+    double const fill_element = time_it(iterations, [&]() { std::fill(dst.begin(), dst.end(), 3); });
+    double const fill_bulk = time_it(iterations, [&]() { multiarray::bulk_fill(dst, 3); });
+    report(label + " fill", fill_element, fill_bulk, bytes);
+
+    multiarray::bulk_copy(src, dst);
+    double const equal_element = time_it(iterations, [&]() { same = same && std::equal(src.cbegin(), src.cend(), dst.cbegin()); });
+    double const equal_bulk = time_it(iterations, [&]() { same = same && multiarray::bulk_equal(src, dst); });
+    report(label + " equal", equal_element, equal_bulk, bytes);
+    if(!same) {
+        std::cerr << "error: copies differ" << std::endl;
+        std::exit(1);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 128.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(T) * channels)));
+
+    TimeFrequency<T> a(spectra, channels);
+    TimeFrequency<T> b(spectra, channels);
+    T n = 0;
+    std::generate(a.begin(), a.end(), [&]() { return n++; });
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of uint8_t)\n";
+    std::cout << std::setw(16) << "operation"
+              << std::setw(16) << "element (GB/s)"
+              << std::setw(16) << "bulk (GB/s)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    // half the spectra, copied to a different offset
+    DimensionSize<Time> const half(spectra / 2);
+    run("spectra"
+       , a.slice(DimensionSpan<Time>(DimensionIndex<Time>(0), half))
+       , b.slice(DimensionSpan<Time>(DimensionIndex<Time>(spectra - half), half))
+       , iterations);
+
+    // the middle of the band for half the spectra
+    DimensionSpan<Frequency> const band(DimensionIndex<Frequency>(1024), DimensionSize<Frequency>(2048));
+    run("sub-band"
+       , a.slice(DimensionSpan<Time>(DimensionIndex<Time>(0), half), band)
+       , b.slice(DimensionSpan<Time>(DimensionIndex<Time>(spectra - half), half), band)
+       , iterations);
+    return 0;
+}
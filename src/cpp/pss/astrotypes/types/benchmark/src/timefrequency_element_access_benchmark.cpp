@@ -0,0 +1,214 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/types/PolarisationTimeFrequency.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Compares single element access to a TimeFrequency through the chained operator[] (which constructs
+ * intermediate slices) with operator() and at() (a multiply-add over the cached strides), for
+ * nested loops over every element and for random access. The nested loops are repeated for a
+ * (rank 3) PolarisationTimeFrequency where the operator[] chain constructs two intermediate slices.
+ *
+ * usage: timefrequency_element_access_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint32_t T;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+void report(std::string const& name, double time, double baseline, std::size_t n)
+{
+    std::cout << std::setw(24) << name
+              << std::setw(16) << n / time / 1e6
+              << std::setw(12) << baseline / time
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 64.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(T) * channels)));
+
+    TimeFrequency<T> tf(spectra, channels);
+    T n = 0;
+    std::generate(tf.begin(), tf.end(), [&]() { return n++; });
+    TimeFrequency<T> const& const_tf = tf;
+
+    std::size_t const number_of_spectra = spectra;
+    std::size_t const number_of_channels = channels;
+    std::size_t const random_accesses = tf.data_size() / 4;
+    std::vector<std::pair<DimensionIndex<Time>, DimensionIndex<Frequency>>> random_indexes;
+    random_indexes.reserve(random_accesses);
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> time_distribution(0, number_of_spectra - 1);
+    std::uniform_int_distribution<std::size_t> channel_distribution(0, number_of_channels - 1);
+    for(std::size_t i = 0; i < random_accesses; ++i) {
+        random_indexes.emplace_back(DimensionIndex<Time>(time_distribution(generator)), DimensionIndex<Frequency>(channel_distribution(generator)));
+    }
+
+    std::vector<std::size_t> sums;
+    std::size_t sum = 0;
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of uint32_t)\n";
+    std::cout << std::setw(24) << "access"
+              << std::setw(16) << "Melements/s"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    // nested loops
+    double const nested_chain = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(DimensionIndex<Time> t(0); t < number_of_spectra; ++t) {
+            for(DimensionIndex<Frequency> f(0); f < number_of_channels; ++f) {
+                total += const_tf[t][f];
+            }
+        }
+        sum = total;
+    });
+    sums.push_back(sum);
+    double const nested_direct = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(DimensionIndex<Time> t(0); t < number_of_spectra; ++t) {
+            for(DimensionIndex<Frequency> f(0); f < number_of_channels; ++f) {
+                total += const_tf(t, f);
+            }
+        }
+        sum = total;
+    });
+    sums.push_back(sum);
+    double const nested_at = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(DimensionIndex<Time> t(0); t < number_of_spectra; ++t) {
+            for(DimensionIndex<Frequency> f(0); f < number_of_channels; ++f) {
+                total += const_tf.at(t, f);
+            }
+        }
+        sum = total;
+    });
+    sums.push_back(sum);
+    report("nested operator[][]", nested_chain, nested_chain, tf.data_size());
+    report("nested operator()", nested_direct, nested_chain, tf.data_size());
+    report("nested at()", nested_at, nested_chain, tf.data_size());
+
+    // random access
+    std::vector<std::size_t> random_sums;
+    double const random_chain = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(auto const& index : random_indexes) total += const_tf[index.first][index.second];
+        sum = total;
+    });
+    random_sums.push_back(sum);
+    double const random_direct = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(auto const& index : random_indexes) total += const_tf(index.first, index.second);
+        sum = total;
+    });
+    random_sums.push_back(sum);
+    double const random_at = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(auto const& index : random_indexes) total += const_tf.at(index.second, index.first);
+        sum = total;
+    });
+    random_sums.push_back(sum);
+    report("random operator[][]", random_chain, random_chain, random_accesses);
+    report("random operator()", random_direct, random_chain, random_accesses);
+    report("random at()", random_at, random_chain, random_accesses);
+
+    // rank 3
+    DimensionSize<units::Polarisation> polarisations(4);
+    PolarisationTimeFrequency<T> ptf(DimensionSize<Time>(number_of_spectra / polarisations), polarisations, channels);
+    n = 0;
+    std::generate(ptf.begin(), ptf.end(), [&]() { return n++; });
+    PolarisationTimeFrequency<T> const& const_ptf = ptf;
+    std::size_t const ptf_spectra = ptf.number_of_spectra();
+    std::vector<std::size_t> ptf_sums;
+    double const ptf_chain = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(DimensionIndex<Time> t(0); t < ptf_spectra; ++t) {
+            for(DimensionIndex<units::Polarisation> p(0); p < polarisations; ++p) {
+                for(DimensionIndex<Frequency> f(0); f < number_of_channels; ++f) {
+                    total += const_ptf[t][p][f];
+                }
+            }
+        }
+        sum = total;
+    });
+    ptf_sums.push_back(sum);
+    double const ptf_direct = time_it(iterations, [&]() {
+        std::size_t total = 0;
+        for(DimensionIndex<Time> t(0); t < ptf_spectra; ++t) {
+            for(DimensionIndex<units::Polarisation> p(0); p < polarisations; ++p) {
+                for(DimensionIndex<Frequency> f(0); f < number_of_channels; ++f) {
+                    total += const_ptf(t, p, f);
+                }
+            }
+        }
+        sum = total;
+    });
+    ptf_sums.push_back(sum);
+    report("rank 3 operator[][][]", ptf_chain, ptf_chain, ptf.data_size());
+    report("rank 3 operator()", ptf_direct, ptf_chain, ptf.data_size());
+
+    if(ptf_sums[0] != ptf_sums[1]
+       || std::count(sums.begin(), sums.end(), sums[0]) != (long)sums.size()
+       || std::count(random_sums.begin(), random_sums.end(), random_sums[0]) != (long)random_sums.size())
+    {
+        std::cerr << "error: access methods disagree" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Compares allocating a large TimeFrequency block and then overwriting all of it (as when reading
+ * from a file) with the data value initialised by the constructor and with NoInitialisation.
+ * The "overwrite" is a copy from an existing block so the difference is the memory bandwidth
+ * saved by not zero filling the new block first.
+ *
+ * usage: timefrequency_no_initialisation_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+
+template<typename T, typename FactoryT>
+double time_it(TimeFrequency<T> const& source, unsigned iterations, FactoryT const& factory)
+{
+    std::chrono::duration<double> total(0);
+    std::size_t check = 0;
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        TimeFrequency<T> tf = factory();
+        std::copy(source.cbegin(), source.cend(), tf.begin());
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        check += *(tf.cend() - 1);
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    if(check != iterations + 1) {
+        std::cerr << "error: unexpected data" << std::endl;
+        std::exit(1);
+    }
+    return total.count() / iterations;
+}
+
+void report(std::string const& name, double seconds, double bytes)
+{
+    std::cout << std::setw(20) << name
+              << std::setw(16) << seconds * 1e3
+              << std::setw(16) << bytes / seconds / 1e9
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 256.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 10;
+
+    typedef uint8_t T;
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(T) * channels)));
+    double const bytes = sizeof(T) * static_cast<double>(static_cast<std::size_t>(spectra) * static_cast<std::size_t>(channels));
+
+    TimeFrequency<T> source(spectra, channels);
+    std::fill(source.begin(), source.end(), 1);
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of uint8_t)\n";
+    std::cout << std::setw(20) << "construction"
+              << std::setw(16) << "time (ms)"
+              << std::setw(16) << "fill (GB/s)"
+              << "\n";
+
+    double const value_time = time_it(source, iterations, [&]() { return TimeFrequency<T>(spectra, channels); });
+    report("value initialised", value_time, bytes);
+    double const no_init_time = time_it(source, iterations, [&]() { return TimeFrequency<T>(NoInitialisation(), spectra, channels); });
+    report("NoInitialisation", no_init_time, bytes);
+    std::cout << "speedup: " << value_time / no_init_time << "\n";
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/multiarray/Reduce.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <vector>
+
+/**
+ * Compares a zero-DM time series (the sum over Frequency) and a bandpass (the sum over Time) made by
+ * accumulating along each output slice (std::accumulate over tf[DimensionIndex<Time>(i)] etc.) against
+ * multiarray::reduce, for TimeFrequency and FrequencyTime layouts of uint8_t, uint16_t and float data.
+ * The float data is also reduced with the PairwiseSum and KahanSum algorithms.
+ * Throughput is reported in GB/s of input data.
+ *
+ * usage: timefrequency_reduce_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+void report(std::string const& label, std::size_t bytes, double slice_time, double reduce_time)
+{
+    std::cout << std::setw(28) << label
+              << std::setw(16) << bytes / slice_time * 1e-9
+              << std::setw(16) << bytes / reduce_time * 1e-9
+              << std::setw(12) << slice_time / reduce_time
+              << "\n";
+}
+
+template<typename VectorT, typename ArrayT>
+void check(std::string const& label, VectorT const& expected, ArrayT const& result)
+{
+    if(expected.size() != result.data_size() || !std::equal(expected.begin(), expected.end(), result.begin())) {
+        std::cerr << "error: " << label << " results differ" << std::endl;
+        std::exit(1);
+    }
+}
+
+// sum over Dimension by accumulating each slice of the other dimension
+template<typename Dimension, typename OtherDimension, typename DataT, typename AccT>
+void slice_sums(DataT const& data, std::vector<AccT>& out)
+{
+    for(DimensionIndex<OtherDimension> i(0); i < out.size(); ++i) {
+        auto const slice = data[i];
+        out[i] = std::accumulate(slice.begin(), slice.end(), AccT(0));
+    }
+}
+
+template<typename Dimension, typename OtherDimension, typename DataT, typename AlgorithmT>
+void run_one(std::string const& label, DataT const& data, unsigned iterations, AlgorithmT const& algorithm, bool compare)
+{
+    typedef typename multiarray::ReducedArrayType<Dimension, DataT>::type ResultT;
+    typedef typename std::decay<decltype(*std::declval<ResultT&>().begin())>::type AccT;
+
+    std::size_t const bytes = data.data_size() * sizeof(*data.begin());
+    std::vector<AccT> expected(static_cast<std::size_t>(data.template dimension<OtherDimension>()));
+    ResultT result(data.template dimension<OtherDimension>());
+
+    double slice_time = time_it(iterations, [&]() { slice_sums<Dimension, OtherDimension>(data, expected); });
+    double reduce_time = time_it(iterations, [&]() { multiarray::reduce<Dimension>(data, result, algorithm); });
+    if(compare) check(label, expected, result);
+    report(label, bytes, slice_time, reduce_time);
+}
+
+template<typename DataT, typename AlgorithmT>
+void run(std::string const& label, DataT const& data, unsigned iterations, AlgorithmT const& algorithm, bool compare)
+{
+    run_one<Frequency, Time>(label + " zero-DM", data, iterations, algorithm, compare);
+    run_one<Time, Frequency>(label + " bandpass", data, iterations, algorithm, compare);
+}
+
+template<typename T>
+void run_type(std::string const& type_name, std::size_t mb, unsigned iterations)
+{
+    std::size_t const channels = 4096;
+    std::size_t const samples = mb * 1024 * 1024 / sizeof(T);
+    TimeFrequency<T> tf(DimensionSize<Time>(samples / channels), DimensionSize<Frequency>(channels));
+    std::size_t n = 0;
+    // small integer values so that every summation order gives the same result
+    std::generate(tf.begin(), tf.end(), [&]() { return static_cast<T>(n++ % 13); });
+    FrequencyTime<T> ft(tf);
+
+    run("TF " + type_name, tf, iterations, multiarray::reduction::Sum(), true);
+    run("FT " + type_name, ft, iterations, multiarray::reduction::Sum(), true);
+    if(std::is_floating_point<T>::value) {
+        run("TF " + type_name + " pairwise", tf, iterations, multiarray::reduction::PairwiseSum(), true);
+        run("FT " + type_name + " pairwise", ft, iterations, multiarray::reduction::PairwiseSum(), true);
+        run("TF " + type_name + " kahan", tf, iterations, multiarray::reduction::KahanSum(), true);
+        run("FT " + type_name + " kahan", ft, iterations, multiarray::reduction::KahanSum(), true);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t const mb = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 64;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    std::cout << "(" << mb << " MB, 4096 channels)\n";
+    std::cout << std::setw(28) << "reduction"
+              << std::setw(16) << "slices (GB/s)"
+              << std::setw(16) << "reduce (GB/s)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    run_type<uint8_t>("uint8", mb, iterations);
+    run_type<uint16_t>("uint16", mb, iterations);
+    run_type<float>("float", mb, iterations);
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Compares per spectrum and per channel loops that build a new slice for each index
+ * (tf[DimensionIndex<Time>(i)]) against the spectra() and channels() ranges, which step a single slice
+ * through the data. Each loop visits every slice and sums its first and last few samples so that
+ * the cost of obtaining the slice dominates, for a wide (4096 channel) and a narrow (16 channel) band.
+ *
+ * usage: timefrequency_slice_range_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint32_t T;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+// a small amount of work on each slice
+template<typename SliceT>
+inline T touch(SliceT const& slice)
+{
+    auto it = slice.begin();
+    return *it + *(it + 1) + *(it + (slice.data_size() - 1));
+}
+
+void report(std::string const& label, std::size_t slices, double index_time, double range_time)
+{
+    std::cout << std::setw(20) << label
+              << std::setw(12) << slices
+              << std::setw(16) << index_time * 1e9 / slices
+              << std::setw(16) << range_time * 1e9 / slices
+              << std::setw(12) << index_time / range_time
+              << "\n";
+}
+
+void check(std::string const& label, T a, T b)
+{
+    if(a != b) {
+        std::cerr << "error: " << label << " results differ" << std::endl;
+        std::exit(1);
+    }
+}
+
+template<typename DataT>
+void run(std::string const& label, DataT const& data, unsigned iterations)
+{
+    std::size_t const spectra = data.number_of_spectra();
+    std::size_t const channels = data.number_of_channels();
+
+    T index_sum = 0;
+    T range_sum = 0;
+    double index_time = time_it(iterations, [&]() {
+        index_sum = 0;
+        for(DimensionIndex<Time> t(0); t < spectra; ++t) {
+            index_sum += touch(data[t]);
+        }
+    });
+    double range_time = time_it(iterations, [&]() {
+        range_sum = 0;
+        for(auto const& spectrum : data.spectra()) {
+            range_sum += touch(spectrum);
+        }
+    });
+    check(label + " spectra", index_sum, range_sum);
+    report(label + " spectra", spectra, index_time, range_time);
+
+    index_time = time_it(iterations, [&]() {
+        index_sum = 0;
+        for(DimensionIndex<Frequency> f(0); f < channels; ++f) {
+            index_sum += touch(data[f]);
+        }
+    });
+    range_time = time_it(iterations, [&]() {
+        range_sum = 0;
+        for(auto const& channel : data.channels()) {
+            range_sum += touch(channel);
+        }
+    });
+    check(label + " channels", index_sum, range_sum);
+    report(label + " channels", channels, index_time, range_time);
+}
+
+template<typename DataT>
+void fill(DataT& data)
+{
+    T n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return n++; });
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 64.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+    std::size_t const samples = static_cast<std::size_t>(mb * 1024 * 1024 / sizeof(T));
+
+    std::cout << "(" << mb << " MB of uint32_t)\n";
+    std::cout << std::setw(20) << "loop"
+              << std::setw(12) << "slices"
+              << std::setw(16) << "tf[i] (ns)"
+              << std::setw(16) << "range (ns)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    for(std::size_t channels : { std::size_t(4096), std::size_t(16) }) {
+        DimensionSize<Frequency> number_of_channels(channels);
+        DimensionSize<Time> number_of_spectra(samples / channels);
+        std::string const shape = std::to_string(channels) + "ch";
+
+        TimeFrequency<T> tf(number_of_spectra, number_of_channels);
+        fill(tf);
+        run("TF " + shape, tf, iterations);
+
+        FrequencyTime<T> ft(tf);
+        run("FT " + shape, ft, iterations);
+    }
+    return 0;
+}
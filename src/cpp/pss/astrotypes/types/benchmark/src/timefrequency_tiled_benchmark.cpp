@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/types/TiledTimeFrequency.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <vector>
+
+/**
+ * Compares summing every channel and summing every spectrum of the same data held as a
+ * TimeFrequency, a FrequencyTime and a TiledTimeFrequency. Each plain layout is fast in one
+ * direction and slow in the other; the tiled layout should be close to the fast case in both.
+ * A tile aware channel sum, walking the tiles directly, is also reported.
+ *
+ * usage: timefrequency_tiled_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint16_t T;
+typedef TiledTimeFrequency<T> TiledType;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+template<typename DataT>
+void channel_sums(DataT const& data, std::vector<uint64_t>& sums)
+{
+    for(std::size_t c = 0; c < sums.size(); ++c) {
+        auto const channel = data.channel(c);
+        sums[c] = std::accumulate(channel.cbegin(), channel.cend(), uint64_t(0));
+    }
+}
+
+template<typename DataT>
+void spectrum_sums(DataT const& data, std::vector<uint64_t>& sums)
+{
+    for(std::size_t s = 0; s < sums.size(); ++s) {
+        auto const spectrum = data.spectrum(s);
+        sums[s] = std::accumulate(spectrum.cbegin(), spectrum.cend(), uint64_t(0));
+    }
+}
+
+void tile_channel_sums(TiledType const& data, std::vector<uint64_t>& sums)
+{
+    std::fill(sums.begin(), sums.end(), 0);
+    std::size_t const inner_tile = TiledType::LayoutType::inner_tile_size;
+    for(std::size_t t = 0; t < data.number_of_tiles<Time>(); ++t) {
+        for(std::size_t f = 0; f < data.number_of_tiles<Frequency>(); ++f) {
+            auto const tile = data.tile(DimensionIndex<Time>(t), DimensionIndex<Frequency>(f));
+            std::size_t const rows = tile.dimension<Time>();
+            std::size_t const cols = tile.dimension<Frequency>();
+            uint64_t* out = &sums[f * inner_tile];
+            for(std::size_t r = 0; r < rows; ++r) {
+                T const* row = tile.row(DimensionIndex<Time>(r));
+                for(std::size_t c = 0; c < cols; ++c) {
+                    out[c] += row[c];
+                }
+            }
+        }
+    }
+}
+
+void report(std::string const& name, double channel_time, double spectrum_time)
+{
+    std::cout << std::setw(24) << name
+              << std::setw(16) << channel_time * 1e3
+              << std::setw(16) << spectrum_time * 1e3
+              << "\n";
+}
+
+void check(std::vector<uint64_t> const& expected, std::vector<uint64_t> const& sums, std::string const& name)
+{
+    if(expected != sums) {
+        std::cerr << "error: " << name << " produced unexpected sums" << std::endl;
+        std::exit(1);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 64.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(T) * channels)));
+
+    TimeFrequency<T> tf(spectra, channels);
+    T n = 0;
+    std::generate(tf.begin(), tf.end(), [&]() { return n++; });
+    FrequencyTime<T> ft(tf);
+    TiledType tiled(tf);
+
+    std::vector<uint64_t> expected_channels(channels);
+    std::vector<uint64_t> expected_spectra(spectra);
+    channel_sums(tf, expected_channels);
+    spectrum_sums(tf, expected_spectra);
+    std::vector<uint64_t> channel_result(channels);
+    std::vector<uint64_t> spectrum_result(spectra);
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of uint16_t)\n";
+    std::cout << std::setw(24) << "layout"
+              << std::setw(16) << "channels (ms)"
+              << std::setw(16) << "spectra (ms)"
+              << "\n";
+
+    double ct = time_it(iterations, [&]() { channel_sums(tf, channel_result); });
+    check(expected_channels, channel_result, "TimeFrequency");
+    double st = time_it(iterations, [&]() { spectrum_sums(tf, spectrum_result); });
+    check(expected_spectra, spectrum_result, "TimeFrequency");
+    report("TimeFrequency", ct, st);
+
+    ct = time_it(iterations, [&]() { channel_sums(ft, channel_result); });
+    check(expected_channels, channel_result, "FrequencyTime");
+    st = time_it(iterations, [&]() { spectrum_sums(ft, spectrum_result); });
+    check(expected_spectra, spectrum_result, "FrequencyTime");
+    report("FrequencyTime", ct, st);
+
+    ct = time_it(iterations, [&]() { channel_sums(tiled, channel_result); });
+    check(expected_channels, channel_result, "TiledTimeFrequency");
+    st = time_it(iterations, [&]() { spectrum_sums(tiled, spectrum_result); });
+    check(expected_spectra, spectrum_result, "TiledTimeFrequency");
+    report("TiledTimeFrequency", ct, st);
+
+    ct = time_it(iterations, [&]() { tile_channel_sums(tiled, channel_result); });
+    check(expected_channels, channel_result, "tile aware");
+    report("tile aware channels", ct, 0.0);
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+/**
+ * Compares the cache blocked transpose used by the FrequencyTime/TimeFrequency
+ * transpose constructors with a slice by slice copy (the previous implementation).
+ *
+ * usage: timefrequency_transpose_benchmark [number_of_channels] [number_of_spectra]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+template<typename T>
+void run(DimensionSize<Frequency> channels, DimensionSize<Time> spectra)
+{
+    typedef std::chrono::high_resolution_clock ClockType;
+    double const bytes = 2.0 * sizeof(T) * (std::size_t)channels * (std::size_t)spectra;
+
+    TimeFrequency<T> tf(spectra, channels);
+    T n = 0;
+    std::generate(tf.begin(), tf.end(), [&]() { return ++n; });
+
+    // slice by slice copy, one channel at a time
+    FrequencyTime<T> ft_slice(spectra, channels);
+    auto start = ClockType::now();
+    for(DimensionIndex<Frequency> channel(0); channel < channels; ++channel) {
+        auto input = tf[channel];
+        auto output = ft_slice[channel];
+        std::copy(input.begin(), input.end(), output.begin());
+    }
+    std::chrono::duration<double> slice_time = ClockType::now() - start;
+
+    // transpose constructor
+    start = ClockType::now();
+    FrequencyTime<T> ft(tf);
+    std::chrono::duration<double> tiled_time = ClockType::now() - start;
+
+    // and back again
+    start = ClockType::now();
+    TimeFrequency<T> tf_out(ft);
+    std::chrono::duration<double> tiled_back_time = ClockType::now() - start;
+
+    if(!std::equal(ft.begin(), ft.end(), ft_slice.begin()) || !std::equal(tf.begin(), tf.end(), tf_out.begin())) {
+        std::cerr << "error: transposed data does not match" << std::endl;
+        std::exit(1);
+    }
+
+    std::cout << std::setw(10) << sizeof(T) * 8 << " bit"
+              << std::setw(16) << bytes / slice_time.count() / 1e9
+              << std::setw(16) << bytes / tiled_time.count() / 1e9
+              << std::setw(16) << bytes / tiled_back_time.count() / 1e9
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    DimensionSize<Frequency> channels(argc > 1 ? std::atoi(argv[1]) : 4096);
+    DimensionSize<Time> spectra(argc > 2 ? std::atoi(argv[2]) : 16384);
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (GB/s, read + write)\n";
+    std::cout << std::setw(14) << "type"
+              << std::setw(16) << "slice TF->FT"
+              << std::setw(16) << "tiled TF->FT"
+              << std::setw(16) << "tiled FT->TF"
+              << "\n";
+    run<uint8_t>(channels, spectra);
+    run<uint16_t>(channels, spectra);
+    run<float>(channels, spectra);
+    return 0;
+}
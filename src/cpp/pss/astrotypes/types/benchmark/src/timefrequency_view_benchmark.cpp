@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/multiarray/View.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+/**
+ * Compares a dense copy of a channel remapped TimeFrequency made element by element through
+ * operator[] against View::materialise (run by run gather) and a plain copy through the View iterators,
+ * for a band flip and for a band flip with ~10% of the channels flagged.
+ *
+ * usage: timefrequency_view_benchmark [size_in_MB] [iterations]
+ */
+
+using namespace pss::astrotypes;
+using units::Time;
+using units::Frequency;
+
+namespace {
+
+typedef std::chrono::high_resolution_clock ClockType;
+typedef uint8_t T;
+
+template<typename FunctorT>
+double time_it(unsigned iterations, FunctorT const& fn)
+{
+    std::chrono::duration<double> total(0);
+    for(unsigned i=0; i <= iterations; ++i) {
+        auto start = ClockType::now();
+        fn();
+        std::chrono::duration<double> elapsed = ClockType::now() - start;
+        if(i > 0) total += elapsed; // first pass is a warm up
+    }
+    return total.count() / iterations;
+}
+
+void run(std::string const& label, TimeFrequency<T> const& tf, multiarray::IndexMapper<Frequency> const& mapper, unsigned iterations)
+{
+    auto view = multiarray::make_view(tf, mapper);
+    TimeFrequency<T> element(NoInitialisation(), tf.dimension<Time>(), mapper.size());
+    TimeFrequency<T> iterated(NoInitialisation(), tf.dimension<Time>(), mapper.size());
+    TimeFrequency<T> gathered(NoInitialisation(), tf.dimension<Time>(), mapper.size());
+
+    std::size_t const spectra = tf.number_of_spectra();
+    std::size_t const channels = mapper.size();
+    double const element_time = time_it(iterations, [&]() {
+        for(std::size_t t = 0; t < spectra; ++t) {
+            auto const spectrum = tf.spectrum(t);
+            auto out = element.spectrum(t);
+            for(std::size_t f = 0; f < channels; ++f) {
+                out[DimensionIndex<Frequency>(f)] = spectrum[mapper(DimensionIndex<Frequency>(f))];
+            }
+        }
+    });
+    double const iterator_time = time_it(iterations, [&]() { std::copy(view.cbegin(), view.cend(), iterated.begin()); });
+    double const gather_time = time_it(iterations, [&]() { view.materialise(gathered); });
+
+    if(!std::equal(element.begin(), element.end(), gathered.begin())
+       || !std::equal(element.begin(), element.end(), iterated.begin()))
+    {
+        std::cerr << "error: " << label << " copies differ" << std::endl;
+        std::exit(1);
+    }
+
+    std::cout << std::setw(12) << label
+              << std::setw(8) << mapper.runs().size()
+              << std::setw(16) << element_time * 1e3
+              << std::setw(16) << iterator_time * 1e3
+              << std::setw(18) << gather_time * 1e3
+              << std::setw(12) << element_time / gather_time
+              << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double const mb = argc > 1 ? std::atof(argv[1]) : 128.0;
+    unsigned const iterations = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 5;
+
+    DimensionSize<Frequency> channels(4096);
+    DimensionSize<Time> spectra(static_cast<std::size_t>(mb * 1024 * 1024 / (sizeof(T) * channels)));
+
+    TimeFrequency<T> tf(spectra, channels);
+    T n = 0;
+    std::generate(tf.begin(), tf.end(), [&]() { return n++; });
+
+    std::cout << "channels=" << channels << " spectra=" << spectra << " (" << mb << " MB of uint8_t)\n";
+    std::cout << std::setw(12) << "map"
+              << std::setw(8) << "runs"
+              << std::setw(16) << "element (ms)"
+              << std::setw(16) << "iterator (ms)"
+              << std::setw(18) << "materialise (ms)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    auto const flip = multiarray::IndexMapper<Frequency>::reverse(channels);
+    run("flip", tf, flip, iterations);
+
+    // flag blocks of channels, as a typical RFI mask would
+    std::vector<bool> flags(channels, false);
+    for(std::size_t c = 0; c < channels; c += 512) {
+        std::fill(flags.begin() + c + 100, flags.begin() + c + 150, true);
+    }
+    auto const unflagged = multiarray::IndexMapper<Frequency>::exclude_flagged(flags);
+    run("flagged", tf, unflagged, iterations);
+
+    std::vector<std::size_t> table;
+    for(std::size_t i = unflagged.size(); i > 0; --i) table.push_back(unflagged(i - 1));
+    run("flip+flagged", tf, multiarray::IndexMapper<Frequency>(table), iterations);
+    return 0;
+}
@@ -0,0 +1,247 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+
+namespace pss {
+namespace astrotypes {
+
+// the state shared between the pool and any outstanding blocks
+template<typename DataT>
+class BufferPool<DataT>::Store
+{
+    public:
+        typedef std::pair<std::size_t, std::size_t> KeyType;
+
+    private:
+        // new blocks need not be initialised either, if the type supports it
+        template<typename... Args>
+        static
+        typename std::enable_if<std::is_constructible<DataT, NoInitialisation, Args...>::value, DataT*>::type
+        create(NoInitialisation const& tag, Args&&... args)
+        {
+            return new DataT(tag, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        static
+        typename std::enable_if<!std::is_constructible<DataT, NoInitialisation, Args...>::value, DataT*>::type
+        create(NoInitialisation const&, Args&&... args)
+        {
+            return new DataT(std::forward<Args>(args)...);
+        }
+
+    public:
+        Store(Initialisation initialisation)
+            : _initialisation(initialisation)
+            , _hits(0)
+            , _misses(0)
+            , _outstanding(0)
+            , _available(0)
+        {
+        }
+
+        DataT* acquire(DimensionSize<units::Time> number_of_spectra, DimensionSize<units::Frequency> number_of_channels)
+        {
+            KeyType const key(number_of_spectra, number_of_channels);
+            std::unique_ptr<DataT> data;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                ++_outstanding;
+                auto it = _free.find(key);
+                if(it != _free.end() && !it->second.empty()) {
+                    data = std::move(it->second.back());
+                    it->second.pop_back();
+                    --_available;
+                    ++_hits;
+                }
+                else {
+                    ++_misses;
+                }
+            }
+
+            if(data) {
+                if(_initialisation == Initialisation::Value) {
+                    typedef typename std::decay<decltype(*data->begin())>::type ValueType;
+                    std::fill(data->begin(), data->end(), ValueType());
+                }
+                return data.release();
+            }
+
+            try {
+                if(_initialisation == Initialisation::None) {
+                    return create(NoInitialisation(), number_of_spectra, number_of_channels);
+                }
+                return new DataT(number_of_spectra, number_of_channels);
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                --_outstanding;
+                throw;
+            }
+        }
+
+        void release(DataT* data)
+        {
+            std::unique_ptr<DataT> block(data);
+            KeyType const key(data->template dimension<units::Time>(), data->template dimension<units::Frequency>());
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_outstanding;
+            try {
+                _free[key].push_back(std::move(block));
+                ++_available;
+            }
+            catch(...) {
+                // unable to store the block so we just let it go
+            }
+        }
+
+        void clear()
+        {
+            std::map<KeyType, std::vector<std::unique_ptr<DataT>>> free;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _free.swap(free);
+                _available = 0;
+            }
+        }
+
+        std::size_t hits() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _hits;
+        }
+
+        std::size_t misses() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _misses;
+        }
+
+        std::size_t outstanding() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _outstanding;
+        }
+
+        std::size_t available() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _available;
+        }
+
+    private:
+        Initialisation const _initialisation;
+        mutable std::mutex _mutex;
+        std::map<KeyType, std::vector<std::unique_ptr<DataT>>> _free;
+        std::size_t _hits;
+        std::size_t _misses;
+        std::size_t _outstanding;
+        std::size_t _available;
+};
+
+template<typename DataT>
+BufferPool<DataT>::Releaser::Releaser()
+{
+}
+
+template<typename DataT>
+BufferPool<DataT>::Releaser::Releaser(std::shared_ptr<Store> const& store)
+    : _store(store)
+{
+}
+
+template<typename DataT>
+void BufferPool<DataT>::Releaser::operator()(DataT* data) const
+{
+    if(_store) {
+        _store->release(data);
+    }
+    else {
+        delete data;
+    }
+}
+
+template<typename DataT>
+BufferPool<DataT>::BufferPool(Initialisation initialisation)
+    : _store(std::make_shared<Store>(initialisation))
+{
+}
+
+template<typename DataT>
+BufferPool<DataT>::~BufferPool()
+{
+}
+
+template<typename DataT>
+typename BufferPool<DataT>::BufferType BufferPool<DataT>::acquire(DimensionSize<units::Time> number_of_spectra, DimensionSize<units::Frequency> number_of_channels)
+{
+    return BufferType(_store->acquire(number_of_spectra, number_of_channels), Releaser(_store));
+}
+
+template<typename DataT>
+typename BufferPool<DataT>::BufferType BufferPool<DataT>::acquire(DimensionSize<units::Frequency> number_of_channels, DimensionSize<units::Time> number_of_spectra)
+{
+    return acquire(number_of_spectra, number_of_channels);
+}
+
+template<typename DataT>
+std::size_t BufferPool<DataT>::hits() const
+{
+    return _store->hits();
+}
+
+template<typename DataT>
+std::size_t BufferPool<DataT>::misses() const
+{
+    return _store->misses();
+}
+
+template<typename DataT>
+double BufferPool<DataT>::hit_rate() const
+{
+    std::size_t const hits = _store->hits();
+    std::size_t const total = hits + _store->misses();
+    return (total == 0) ? 0.0 : static_cast<double>(hits) / total;
+}
+
+template<typename DataT>
+std::size_t BufferPool<DataT>::outstanding() const
+{
+    return _store->outstanding();
+}
+
+template<typename DataT>
+std::size_t BufferPool<DataT>::available() const
+{
+    return _store->available();
+}
+
+template<typename DataT>
+void BufferPool<DataT>::clear()
+{
+    _store->clear();
+}
+
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,434 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <stdexcept>
+
+namespace pss {
+namespace astrotypes {
+
+// ------------------------------------------------------------------
+// --------------- CircularIterator ---------------------------------
+// ------------------------------------------------------------------
+template<typename T>
+CircularIterator<T>::CircularIterator(T* begin, std::size_t size, std::size_t start, std::size_t index)
+    : _begin(begin)
+    , _end(begin + size)
+    , _start(start)
+    , _index(index)
+    , _ptr(position(index))
+{
+}
+
+template<typename T>
+template<typename OtherT, typename Enable>
+CircularIterator<T>::CircularIterator(CircularIterator<OtherT> const& other)
+    : _begin(other._begin)
+    , _end(other._end)
+    , _start(other._start)
+    , _index(other._index)
+    , _ptr(other._ptr)
+{
+}
+
+template<typename T>
+inline T* CircularIterator<T>::position(std::size_t index) const
+{
+    std::size_t const size = _end - _begin;
+    if(size == 0) return _begin;
+    return _begin + (_start + index) % size;
+}
+
+template<typename T>
+inline typename CircularIterator<T>::reference CircularIterator<T>::operator*() const
+{
+    return *_ptr;
+}
+
+template<typename T>
+inline typename CircularIterator<T>::pointer CircularIterator<T>::operator->() const
+{
+    return _ptr;
+}
+
+template<typename T>
+inline typename CircularIterator<T>::reference CircularIterator<T>::operator[](difference_type n) const
+{
+    return *position(_index + n);
+}
+
+template<typename T>
+inline CircularIterator<T>& CircularIterator<T>::operator++()
+{
+    ++_index;
+    if(++_ptr == _end) _ptr = _begin;
+    return *this;
+}
+
+template<typename T>
+inline CircularIterator<T> CircularIterator<T>::operator++(int)
+{
+    CircularIterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+template<typename T>
+inline CircularIterator<T>& CircularIterator<T>::operator--()
+{
+    --_index;
+    if(_ptr == _begin) _ptr = _end;
+    --_ptr;
+    return *this;
+}
+
+template<typename T>
+inline CircularIterator<T> CircularIterator<T>::operator--(int)
+{
+    CircularIterator tmp(*this);
+    --*this;
+    return tmp;
+}
+
+template<typename T>
+inline CircularIterator<T>& CircularIterator<T>::operator+=(difference_type n)
+{
+    _index += n;
+    _ptr = position(_index);
+    return *this;
+}
+
+template<typename T>
+inline CircularIterator<T>& CircularIterator<T>::operator-=(difference_type n)
+{
+    return *this += -n;
+}
+
+template<typename T>
+inline CircularIterator<T> CircularIterator<T>::operator+(difference_type n) const
+{
+    CircularIterator tmp(*this);
+    return tmp += n;
+}
+
+template<typename T>
+inline CircularIterator<T> CircularIterator<T>::operator-(difference_type n) const
+{
+    CircularIterator tmp(*this);
+    return tmp -= n;
+}
+
+template<typename T>
+inline typename CircularIterator<T>::difference_type CircularIterator<T>::operator-(CircularIterator const& other) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator==(CircularIterator const& other) const
+{
+    return _index == other._index;
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator!=(CircularIterator const& other) const
+{
+    return _index != other._index;
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator<(CircularIterator const& other) const
+{
+    return _index < other._index;
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator>(CircularIterator const& other) const
+{
+    return _index > other._index;
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator<=(CircularIterator const& other) const
+{
+    return _index <= other._index;
+}
+
+template<typename T>
+inline bool CircularIterator<T>::operator>=(CircularIterator const& other) const
+{
+    return _index >= other._index;
+}
+
+// ------------------------------------------------------------------
+// --------------- CircularTimeFrequency::WindowType ----------------
+// ------------------------------------------------------------------
+template<typename T, typename Alloc>
+template<bool is_const>
+CircularTimeFrequency<T, Alloc>::WindowType<is_const>::WindowType(StorageT& storage, std::size_t first_spectrum, std::size_t number_of_spectra)
+    : _storage(&storage)
+    , _first(first_spectrum)
+    , _size(number_of_spectra)
+{
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::iterator CircularTimeFrequency<T, Alloc>::WindowType<is_const>::begin() const
+{
+    std::size_t const channels = _storage->number_of_channels();
+    return iterator(&*_storage->begin(), _storage->data_size(), _first * channels, 0);
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::iterator CircularTimeFrequency<T, Alloc>::WindowType<is_const>::end() const
+{
+    std::size_t const channels = _storage->number_of_channels();
+    return iterator(&*_storage->begin(), _storage->data_size(), _first * channels, _size * channels);
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::const_iterator CircularTimeFrequency<T, Alloc>::WindowType<is_const>::cbegin() const
+{
+    return begin();
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::const_iterator CircularTimeFrequency<T, Alloc>::WindowType<is_const>::cend() const
+{
+    return end();
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+template<typename FunctionT>
+void CircularTimeFrequency<T, Alloc>::WindowType<is_const>::for_each_contiguous_run(FunctionT&& fn) const
+{
+    if(_size == 0) return;
+    std::size_t const channels = _storage->number_of_channels();
+    std::size_t const capacity = _storage->number_of_spectra();
+    ElementT* const data = &*_storage->begin();
+
+    std::size_t const first_run = std::min(_size, capacity - _first);
+    fn(data + _first * channels, data + (_first + first_run) * channels);
+    if(first_run < _size) {
+        // wrapped around the physical end
+        fn(data, data + (_size - first_run) * channels);
+    }
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::SpectrumType CircularTimeFrequency<T, Alloc>::WindowType<is_const>::spectrum(std::size_t offset) const
+{
+    return _storage->spectrum((_first + offset) % _storage->number_of_spectra());
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+typename CircularTimeFrequency<T, Alloc>::template WindowType<is_const>::SpectrumType CircularTimeFrequency<T, Alloc>::WindowType<is_const>::operator[](DimensionIndex<units::Time> offset) const
+{
+    return spectrum(static_cast<std::size_t>(offset));
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+std::size_t CircularTimeFrequency<T, Alloc>::WindowType<is_const>::number_of_spectra() const
+{
+    return _size;
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+std::size_t CircularTimeFrequency<T, Alloc>::WindowType<is_const>::number_of_channels() const
+{
+    return _storage->number_of_channels();
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+template<typename Dimension>
+typename std::enable_if<std::is_same<Dimension, units::Time>::value, DimensionSize<units::Time>>::type
+CircularTimeFrequency<T, Alloc>::WindowType<is_const>::dimension() const
+{
+    return DimensionSize<units::Time>(_size);
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+template<typename Dimension>
+typename std::enable_if<std::is_same<Dimension, units::Frequency>::value, DimensionSize<units::Frequency>>::type
+CircularTimeFrequency<T, Alloc>::WindowType<is_const>::dimension() const
+{
+    return _storage->template dimension<units::Frequency>();
+}
+
+template<typename T, typename Alloc>
+template<bool is_const>
+std::size_t CircularTimeFrequency<T, Alloc>::WindowType<is_const>::data_size() const
+{
+    return _size * _storage->number_of_channels();
+}
+
+// ------------------------------------------------------------------
+// --------------- CircularTimeFrequency ----------------------------
+// ------------------------------------------------------------------
+template<typename T, typename Alloc>
+CircularTimeFrequency<T, Alloc>::CircularTimeFrequency(DimensionSize<units::Time> capacity, DimensionSize<units::Frequency> number_of_channels)
+    : CircularTimeFrequency(Alloc(), capacity, number_of_channels)
+{
+}
+
+template<typename T, typename Alloc>
+CircularTimeFrequency<T, Alloc>::CircularTimeFrequency(Alloc const& allocator, DimensionSize<units::Time> capacity, DimensionSize<units::Frequency> number_of_channels)
+    : _data(allocator, capacity, number_of_channels)
+    , _head(0)
+    , _size(0)
+{
+    if(capacity == 0) {
+        throw std::invalid_argument("CircularTimeFrequency: capacity must be greater than zero");
+    }
+}
+
+template<typename T, typename Alloc>
+template<typename DataT>
+void CircularTimeFrequency<T, Alloc>::push(DataT const& data)
+{
+    if(data.template dimension<units::Frequency>() != _data.template dimension<units::Frequency>()) {
+        throw std::invalid_argument("CircularTimeFrequency: number of channels does not match");
+    }
+
+    std::size_t const number_of_spectra = data.template dimension<units::Time>();
+    std::size_t const channels = number_of_channels();
+    T* const buffer = &*_data.begin();
+
+    // anything beyond the capacity would be overwritten anyway
+    for(std::size_t i = number_of_spectra - std::min(number_of_spectra, capacity()); i < number_of_spectra; ++i) {
+        auto const spectrum = data[DimensionIndex<units::Time>(i)];
+        std::copy(spectrum.begin(), spectrum.end(), buffer + _head * channels);
+        commit(DimensionSize<units::Time>(1));
+    }
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::SliceType CircularTimeFrequency<T, Alloc>::head(DimensionSize<units::Time> number_of_spectra)
+{
+    std::size_t const size = std::min(static_cast<std::size_t>(number_of_spectra), capacity() - _head);
+    return _data.slice(DimensionSpan<units::Time>(DimensionIndex<units::Time>(_head), DimensionSize<units::Time>(size)));
+}
+
+template<typename T, typename Alloc>
+void CircularTimeFrequency<T, Alloc>::commit(DimensionSize<units::Time> number_of_spectra)
+{
+    std::size_t const n = number_of_spectra;
+    if(n > capacity() - _head) {
+        throw std::out_of_range("CircularTimeFrequency: commit beyond the space available at the head");
+    }
+    _head = (_head + n) % capacity();
+    _size = std::min(_size + n, capacity());
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::Window CircularTimeFrequency<T, Alloc>::window()
+{
+    return Window(_data, oldest(), _size);
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::ConstWindow CircularTimeFrequency<T, Alloc>::window() const
+{
+    return ConstWindow(_data, oldest(), _size);
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::Window CircularTimeFrequency<T, Alloc>::window(DimensionIndex<units::Time> offset, DimensionSize<units::Time> number_of_spectra)
+{
+    if(static_cast<std::size_t>(offset) + static_cast<std::size_t>(number_of_spectra) > _size) {
+        throw std::out_of_range("CircularTimeFrequency: window extends beyond the data held");
+    }
+    return Window(_data, (oldest() + offset) % capacity(), number_of_spectra);
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::ConstWindow CircularTimeFrequency<T, Alloc>::window(DimensionIndex<units::Time> offset, DimensionSize<units::Time> number_of_spectra) const
+{
+    if(static_cast<std::size_t>(offset) + static_cast<std::size_t>(number_of_spectra) > _size) {
+        throw std::out_of_range("CircularTimeFrequency: window extends beyond the data held");
+    }
+    return ConstWindow(_data, (oldest() + offset) % capacity(), number_of_spectra);
+}
+
+template<typename T, typename Alloc>
+void CircularTimeFrequency<T, Alloc>::clear()
+{
+    _head = 0;
+    _size = 0;
+}
+
+template<typename T, typename Alloc>
+std::size_t CircularTimeFrequency<T, Alloc>::number_of_spectra() const
+{
+    return _size;
+}
+
+template<typename T, typename Alloc>
+std::size_t CircularTimeFrequency<T, Alloc>::capacity() const
+{
+    return _data.number_of_spectra();
+}
+
+template<typename T, typename Alloc>
+std::size_t CircularTimeFrequency<T, Alloc>::number_of_channels() const
+{
+    return _data.number_of_channels();
+}
+
+template<typename T, typename Alloc>
+bool CircularTimeFrequency<T, Alloc>::empty() const
+{
+    return _size == 0;
+}
+
+template<typename T, typename Alloc>
+bool CircularTimeFrequency<T, Alloc>::full() const
+{
+    return _size == capacity();
+}
+
+template<typename T, typename Alloc>
+typename CircularTimeFrequency<T, Alloc>::StorageType const& CircularTimeFrequency<T, Alloc>::storage() const
+{
+    return _data;
+}
+
+template<typename T, typename Alloc>
+std::size_t CircularTimeFrequency<T, Alloc>::oldest() const
+{
+    return (_head + capacity() - _size) % capacity();
+}
+
+} // namespace astrotypes
+} // namespace pss
@@ -85,6 +85,34 @@ typename PhaseFrequencyArrayInterface<SliceT>::ConstPhaseBin
     return (*this)[DimensionIndex<units::PhaseAngle>(phase_bin_number)];
 }
 
+template<typename SliceT>
+typename PhaseFrequencyArrayInterface<SliceT>::ChannelRange
+    PhaseFrequencyArrayInterface<SliceT>::channels()
+{
+    return ChannelRange(channel(0), this->template dimension<units::Frequency>(), multiarray::slice_range_stride<units::Frequency>(*this));
+}
+
+template<typename SliceT>
+typename PhaseFrequencyArrayInterface<SliceT>::ConstChannelRange
+    PhaseFrequencyArrayInterface<SliceT>::channels() const
+{
+    return ConstChannelRange(channel(0), this->template dimension<units::Frequency>(), multiarray::slice_range_stride<units::Frequency>(*this));
+}
+
+template<typename SliceT>
+typename PhaseFrequencyArrayInterface<SliceT>::PhaseBinRange
+    PhaseFrequencyArrayInterface<SliceT>::phase_bins()
+{
+    return PhaseBinRange(phase_bin(0), this->template dimension<units::PhaseAngle>(), multiarray::slice_range_stride<units::PhaseAngle>(*this));
+}
+
+template<typename SliceT>
+typename PhaseFrequencyArrayInterface<SliceT>::ConstPhaseBinRange
+    PhaseFrequencyArrayInterface<SliceT>::phase_bins() const
+{
+    return ConstPhaseBinRange(phase_bin(0), this->template dimension<units::PhaseAngle>(), multiarray::slice_range_stride<units::PhaseAngle>(*this));
+}
+
 template<typename SliceT>
 std::size_t PhaseFrequencyArrayInterface<SliceT>::number_of_channels() const
 {
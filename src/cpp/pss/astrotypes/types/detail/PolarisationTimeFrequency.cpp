@@ -0,0 +1,133 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+
+template<typename T, typename Alloc>
+PolarisationTimeFrequency<T, Alloc>::PolarisationTimeFrequency()
+    : BaseT(DimensionSize<units::Time>(0), DimensionSize<units::Polarisation>(0), DimensionSize<units::Frequency>(0))
+{
+}
+
+template<typename T, typename Alloc>
+PolarisationTimeFrequency<T, Alloc>::PolarisationTimeFrequency(DimensionSize<units::Time> time_size, DimensionSize<units::Polarisation> pol_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(time_size, pol_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc>
+PolarisationTimeFrequency<T, Alloc>::PolarisationTimeFrequency(Alloc const& allocator, DimensionSize<units::Time> time_size, DimensionSize<units::Polarisation> pol_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(allocator, time_size, pol_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc>
+PolarisationTimeFrequency<T, Alloc>::PolarisationTimeFrequency(NoInitialisation const& tag, DimensionSize<units::Time> time_size, DimensionSize<units::Polarisation> pol_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(tag, time_size, pol_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc>
+PolarisationTimeFrequency<T, Alloc>::~PolarisationTimeFrequency()
+{
+}
+
+template<typename T, typename Alloc>
+typename PolarisationTimeFrequency<T, Alloc>::PolarisationBlock PolarisationTimeFrequency<T, Alloc>::polarisation(std::size_t index)
+{
+    return this->slice(DimensionSpan<units::Polarisation>(DimensionIndex<units::Polarisation>(index), DimensionSize<units::Polarisation>(1)));
+}
+
+template<typename T, typename Alloc>
+typename PolarisationTimeFrequency<T, Alloc>::ConstPolarisationBlock PolarisationTimeFrequency<T, Alloc>::polarisation(std::size_t index) const
+{
+    return this->slice(DimensionSpan<units::Polarisation>(DimensionIndex<units::Polarisation>(index), DimensionSize<units::Polarisation>(1)));
+}
+
+// ***************************************************************
+// --------------  PolarisationTimeFreqCommon ---------------------
+// ***************************************************************
+template<typename SliceType>
+PolarisationTimeFreqCommon<SliceType>::PolarisationTimeFreqCommon()
+{
+}
+
+template<typename SliceType>
+PolarisationTimeFreqCommon<SliceType>::PolarisationTimeFreqCommon(PolarisationTimeFreqCommon const& t)
+    : SliceType(static_cast<SliceType const&>(t))
+{
+}
+
+template<typename SliceType>
+PolarisationTimeFreqCommon<SliceType>::PolarisationTimeFreqCommon(SliceType const& t)
+    : SliceType(t)
+{
+}
+
+template<typename SliceType>
+PolarisationTimeFreqCommon<SliceType>::PolarisationTimeFreqCommon(SliceType&& t)
+    : SliceType(std::move(t))
+{
+}
+
+template<typename SliceType>
+PolarisationTimeFreqCommon<SliceType>& PolarisationTimeFreqCommon<SliceType>::operator=(PolarisationTimeFreqCommon const& t)
+{
+    static_cast<SliceType&>(*this) = static_cast<SliceType const&>(t);
+    return *this;
+}
+
+template<typename SliceType>
+typename PolarisationTimeFreqCommon<SliceType>::Spectra PolarisationTimeFreqCommon<SliceType>::spectrum(std::size_t offset)
+{
+    return (*this)[DimensionIndex<units::Time>(offset)];
+}
+
+template<typename SliceType>
+typename PolarisationTimeFreqCommon<SliceType>::ConstSpectra PolarisationTimeFreqCommon<SliceType>::spectrum(std::size_t offset) const
+{
+    return (*this)[DimensionIndex<units::Time>(offset)];
+}
+
+template<typename SliceType>
+std::size_t PolarisationTimeFreqCommon<SliceType>::number_of_channels() const
+{
+    return this->template dimension<units::Frequency>();
+}
+
+template<typename SliceType>
+std::size_t PolarisationTimeFreqCommon<SliceType>::number_of_spectra() const
+{
+    return this->template dimension<units::Time>();
+}
+
+template<typename SliceType>
+std::size_t PolarisationTimeFreqCommon<SliceType>::number_of_polarisations() const
+{
+    return this->template dimension<units::Polarisation>();
+}
+
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace pss {
+namespace astrotypes {
+namespace detail {
+
+// sum of the first two of NumberOfPolarisations interleaved values for size channels
+template<std::size_t NumberOfPolarisations, typename T, typename OutT>
+void interleaved_stokes_i(T const* in, std::size_t size, OutT* out)
+{
+    for(std::size_t i = 0; i < size; ++i) {
+        out[i] = static_cast<OutT>(in[i * NumberOfPolarisations]) + static_cast<OutT>(in[i * NumberOfPolarisations + 1]);
+    }
+}
+
+template<typename T, typename OutT>
+void interleaved_stokes_i(T const* in, std::size_t size, std::size_t number_of_polarisations, OutT* out)
+{
+    switch(number_of_polarisations) {
+        case 1:
+            std::copy(in, in + size, out);
+            break;
+        case 2:
+            interleaved_stokes_i<2>(in, size, out);
+            break;
+        case 4:
+            interleaved_stokes_i<4>(in, size, out);
+            break;
+        default:
+            for(std::size_t i = 0; i < size; ++i) {
+                out[i] = static_cast<OutT>(in[i * number_of_polarisations]) + static_cast<OutT>(in[i * number_of_polarisations + 1]);
+            }
+            break;
+    }
+}
+
+} // namespace detail
+
+template<std::size_t NumberOfPolarisations, typename T, typename OutT>
+void deinterleave(T const* in, std::size_t number_of_channels, OutT* const* out)
+{
+    for(std::size_t pol = 0; pol < NumberOfPolarisations; ++pol) {
+        T const* const pol_in = in + pol;
+        OutT* const pol_out = out[pol];
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+            pol_out[channel] = pol_in[channel * NumberOfPolarisations];
+        }
+    }
+}
+
+template<typename T, typename OutT>
+void deinterleave(T const* in, std::size_t number_of_channels, std::size_t number_of_polarisations, OutT* const* out)
+{
+    switch(number_of_polarisations) {
+        case 1:
+            std::copy(in, in + number_of_channels, out[0]);
+            break;
+        case 2:
+            deinterleave<2>(in, number_of_channels, out);
+            break;
+        case 4:
+            deinterleave<4>(in, number_of_channels, out);
+            break;
+        default:
+            for(std::size_t pol = 0; pol < number_of_polarisations; ++pol) {
+                for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+                    out[pol][channel] = in[channel * number_of_polarisations + pol];
+                }
+            }
+            break;
+    }
+}
+
+template<typename T, typename OutT>
+void interleave(T const* const* in, std::size_t number_of_channels, std::size_t number_of_polarisations, OutT* out)
+{
+    for(std::size_t pol = 0; pol < number_of_polarisations; ++pol) {
+        T const* const pol_in = in[pol];
+        OutT* const pol_out = out + pol;
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+            pol_out[channel * number_of_polarisations] = pol_in[channel];
+        }
+    }
+}
+
+template<typename T, std::size_t N, typename AllocIn, typename AllocOut>
+void deinterleave(TimeFrequency<std::array<T, N>, AllocIn> const& in, PolarisationTimeFrequency<T, AllocOut>& out)
+{
+    static_assert(sizeof(std::array<T, N>) == N * sizeof(T), "std::array is expected to be unpadded");
+    std::size_t const number_of_spectra = in.number_of_spectra();
+    std::size_t const number_of_channels = in.number_of_channels();
+    out.resize(NoInitialisation(), DimensionSize<units::Time>(number_of_spectra), DimensionSize<units::Polarisation>(N), DimensionSize<units::Frequency>(number_of_channels));
+    if(number_of_spectra == 0 || number_of_channels == 0) return;
+
+    T const* in_ptr = in.cbegin()->data();
+    T* out_ptr = &*out.begin();
+    std::array<T*, N> pols;
+    for(std::size_t spectrum = 0; spectrum < number_of_spectra; ++spectrum) {
+        for(std::size_t pol = 0; pol < N; ++pol) {
+            pols[pol] = out_ptr + pol * number_of_channels;
+        }
+        deinterleave<N>(in_ptr, number_of_channels, pols.data());
+        in_ptr += N * number_of_channels;
+        out_ptr += N * number_of_channels;
+    }
+}
+
+template<typename T, typename AllocIn, typename OutT, typename AllocOut>
+void stokes_i(PolarisationTimeFrequency<T, AllocIn> const& in, TimeFrequency<OutT, AllocOut>& out)
+{
+    std::size_t const number_of_spectra = in.number_of_spectra();
+    std::size_t const number_of_channels = in.number_of_channels();
+    std::size_t const number_of_polarisations = in.number_of_polarisations();
+    out.resize(NoInitialisation(), DimensionSize<units::Time>(number_of_spectra), DimensionSize<units::Frequency>(number_of_channels));
+    if(number_of_spectra == 0 || number_of_channels == 0) return;
+    if(number_of_polarisations == 0) throw std::invalid_argument("stokes_i: no polarisations");
+
+    T const* in_ptr = &*in.cbegin();
+    OutT* out_ptr = &*out.begin();
+    for(std::size_t spectrum = 0; spectrum < number_of_spectra; ++spectrum) {
+        if(number_of_polarisations == 1) {
+            std::copy(in_ptr, in_ptr + number_of_channels, out_ptr);
+        }
+        else {
+            T const* const aa = in_ptr;
+            T const* const bb = in_ptr + number_of_channels;
+            for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+                out_ptr[channel] = static_cast<OutT>(aa[channel]) + static_cast<OutT>(bb[channel]);
+            }
+        }
+        in_ptr += number_of_polarisations * number_of_channels;
+        out_ptr += number_of_channels;
+    }
+}
+
+template<typename T, std::size_t N, typename AllocIn, typename OutT, typename AllocOut>
+void stokes_i(TimeFrequency<std::array<T, N>, AllocIn> const& in, TimeFrequency<OutT, AllocOut>& out)
+{
+    static_assert(sizeof(std::array<T, N>) == N * sizeof(T), "std::array is expected to be unpadded");
+    std::size_t const number_of_spectra = in.number_of_spectra();
+    std::size_t const number_of_channels = in.number_of_channels();
+    out.resize(NoInitialisation(), DimensionSize<units::Time>(number_of_spectra), DimensionSize<units::Frequency>(number_of_channels));
+    if(number_of_spectra == 0 || number_of_channels == 0) return;
+
+    // both blocks are contiguous so treat them as a single long spectrum
+    detail::interleaved_stokes_i(in.cbegin()->data(), number_of_spectra * number_of_channels, N, &*out.begin());
+}
+
+template<typename T, typename AllocIn, typename OutT, typename AllocOut>
+void full_stokes(PolarisationTimeFrequency<T, AllocIn> const& in, PolarisationTimeFrequency<OutT, AllocOut>& out)
+{
+    if(in.number_of_polarisations() != 4) throw std::invalid_argument("full_stokes: expecting 4 coherency products");
+    std::size_t const number_of_spectra = in.number_of_spectra();
+    std::size_t const number_of_channels = in.number_of_channels();
+    out.resize(NoInitialisation(), DimensionSize<units::Time>(number_of_spectra), DimensionSize<units::Polarisation>(4), DimensionSize<units::Frequency>(number_of_channels));
+    if(number_of_spectra == 0 || number_of_channels == 0) return;
+
+    T const* in_ptr = &*in.cbegin();
+    OutT* out_ptr = &*out.begin();
+    for(std::size_t spectrum = 0; spectrum < number_of_spectra; ++spectrum) {
+        T const* const aa = in_ptr;
+        T const* const bb = aa + number_of_channels;
+        T const* const cr = bb + number_of_channels;
+        T const* const ci = cr + number_of_channels;
+        OutT* const i = out_ptr;
+        OutT* const q = i + number_of_channels;
+        OutT* const u = q + number_of_channels;
+        OutT* const v = u + number_of_channels;
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+            OutT const a = static_cast<OutT>(aa[channel]);
+            OutT const b = static_cast<OutT>(bb[channel]);
+            i[channel] = a + b;
+            q[channel] = a - b;
+            u[channel] = 2 * static_cast<OutT>(cr[channel]);
+            v[channel] = 2 * static_cast<OutT>(ci[channel]);
+        }
+        in_ptr += 4 * number_of_channels;
+        out_ptr += 4 * number_of_channels;
+    }
+}
+
+} // namespace astrotypes
+} // namespace pss
@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace pss {
+namespace astrotypes {
+
+template<typename T, typename LayoutT, typename Alloc>
+TiledTimeFrequency<T, LayoutT, Alloc>::TiledTimeFrequency()
+{
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+typename TiledTimeFrequency<T, LayoutT, Alloc>::Spectra TiledTimeFrequency<T, LayoutT, Alloc>::spectrum(std::size_t offset)
+{
+    return (*this)[DimensionIndex<units::Time>(offset)];
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+typename TiledTimeFrequency<T, LayoutT, Alloc>::ConstSpectra TiledTimeFrequency<T, LayoutT, Alloc>::spectrum(std::size_t offset) const
+{
+    return (*this)[DimensionIndex<units::Time>(offset)];
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+typename TiledTimeFrequency<T, LayoutT, Alloc>::Channel TiledTimeFrequency<T, LayoutT, Alloc>::channel(std::size_t channel_number)
+{
+    return (*this)[DimensionIndex<units::Frequency>(channel_number)];
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+typename TiledTimeFrequency<T, LayoutT, Alloc>::ConstChannel TiledTimeFrequency<T, LayoutT, Alloc>::channel(std::size_t channel_number) const
+{
+    return (*this)[DimensionIndex<units::Frequency>(channel_number)];
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+DimensionSize<units::Time> TiledTimeFrequency<T, LayoutT, Alloc>::number_of_spectra() const
+{
+    return this->template dimension<units::Time>();
+}
+
+template<typename T, typename LayoutT, typename Alloc>
+DimensionSize<units::Frequency> TiledTimeFrequency<T, LayoutT, Alloc>::number_of_channels() const
+{
+    return this->template dimension<units::Frequency>();
+}
+
+} // namespace astrotypes
+} // namespace pss
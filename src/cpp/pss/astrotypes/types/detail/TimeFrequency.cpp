@@ -25,33 +25,57 @@
 namespace pss {
 namespace astrotypes {
 
-template<typename T, typename Alloc>
-TimeFrequency<T, Alloc>::TimeFrequency()
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency()
     : BaseT(DimensionSize<units::Time>(0), DimensionSize<units::Frequency>(0))
 {
 }
 
-template<typename T, typename Alloc>
-TimeFrequency<T, Alloc>::TimeFrequency(DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
     : BaseT(time_size, freq_size)
 {
 }
 
-template<typename T, typename Alloc>
-TimeFrequency<T, Alloc>::TimeFrequency(DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
     : BaseT(time_size, freq_size)
 {
 }
 
-template<typename T, typename Alloc>
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(Alloc const& allocator, DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(allocator, time_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(Alloc const& allocator, DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+    : BaseT(allocator, time_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(NoInitialisation const& tag, DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(tag, time_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(NoInitialisation const& tag, DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+    : BaseT(tag, time_size, freq_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
 template<typename FrequencyTimeType, typename Enable>
-TimeFrequency<T, Alloc>::TimeFrequency(FrequencyTimeType const& ft)
+TimeFrequency<T, Alloc, NumberOfChannels>::TimeFrequency(FrequencyTimeType const& ft)
     : BaseT(ft)
 {
 }
 
-template<typename T, typename Alloc>
-TimeFrequency<T, Alloc>::~TimeFrequency()
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+TimeFrequency<T, Alloc, NumberOfChannels>::~TimeFrequency()
 {
 }
 
@@ -59,33 +83,57 @@ TimeFrequency<T, Alloc>::~TimeFrequency()
 // --------------    FrequencyTime    ----------------------------
 // ***************************************************************
 //
-template<typename T, typename Alloc>
-FrequencyTime<T, Alloc>::FrequencyTime()
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime()
     : BaseT(DimensionSize<units::Frequency>(0), DimensionSize<units::Time>(0))
 {
 }
 
-template<typename T, typename Alloc>
-FrequencyTime<T, Alloc>::FrequencyTime(DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
     : BaseT(freq_size, time_size)
 {
 }
 
-template<typename T, typename Alloc>
-FrequencyTime<T, Alloc>::FrequencyTime(DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
     : BaseT(freq_size, time_size)
 {
 }
 
-template<typename T, typename Alloc>
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(Alloc const& allocator, DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+    : BaseT(allocator, freq_size, time_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(Alloc const& allocator, DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(allocator, freq_size, time_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(NoInitialisation const& tag, DimensionSize<units::Time> time_size, DimensionSize<units::Frequency> freq_size)
+    : BaseT(tag, freq_size, time_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(NoInitialisation const& tag, DimensionSize<units::Frequency> freq_size, DimensionSize<units::Time> time_size)
+    : BaseT(tag, freq_size, time_size)
+{
+}
+
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
 template<typename TimeFrequencyType, typename Enable>
-FrequencyTime<T, Alloc>::FrequencyTime(TimeFrequencyType const& tf)
+FrequencyTime<T, Alloc, NumberOfChannels>::FrequencyTime(TimeFrequencyType const& tf)
     : BaseT(tf)
 {
 }
 
-template<typename T, typename Alloc>
-FrequencyTime<T, Alloc>::~FrequencyTime()
+template<typename T, typename Alloc, std::size_t NumberOfChannels>
+FrequencyTime<T, Alloc, NumberOfChannels>::~FrequencyTime()
 {
 }
 
@@ -96,7 +144,7 @@ TimeFreqCommon<SliceType>::TimeFreqCommon()
 
 template<typename SliceType>
 TimeFreqCommon<SliceType>::TimeFreqCommon(TimeFreqCommon const& t)
-    : SliceType(t)
+    : SliceType(static_cast<SliceType const&>(t))
 {
 }
 
@@ -143,6 +191,30 @@ typename TimeFreqCommon<SliceType>::ConstSpectra TimeFreqCommon<SliceType>::spec
     return (*this)[DimensionIndex<units::Time>(offset)];
 }
 
+template<typename SliceType>
+typename TimeFreqCommon<SliceType>::SpectraRange TimeFreqCommon<SliceType>::spectra()
+{
+    return SpectraRange(spectrum(0), this->template dimension<units::Time>(), multiarray::slice_range_stride<units::Time>(*this));
+}
+
+template<typename SliceType>
+typename TimeFreqCommon<SliceType>::ConstSpectraRange TimeFreqCommon<SliceType>::spectra() const
+{
+    return ConstSpectraRange(spectrum(0), this->template dimension<units::Time>(), multiarray::slice_range_stride<units::Time>(*this));
+}
+
+template<typename SliceType>
+typename TimeFreqCommon<SliceType>::ChannelRange TimeFreqCommon<SliceType>::channels()
+{
+    return ChannelRange(channel(0), this->template dimension<units::Frequency>(), multiarray::slice_range_stride<units::Frequency>(*this));
+}
+
+template<typename SliceType>
+typename TimeFreqCommon<SliceType>::ConstChannelRange TimeFreqCommon<SliceType>::channels() const
+{
+    return ConstChannelRange(channel(0), this->template dimension<units::Frequency>(), multiarray::slice_range_stride<units::Frequency>(*this));
+}
+
 template<typename SliceType>
 std::size_t TimeFreqCommon<SliceType>::number_of_channels() const
 {
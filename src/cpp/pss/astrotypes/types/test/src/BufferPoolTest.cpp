@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pss/astrotypes/types/test/BufferPoolTest.h"
+#include "pss/astrotypes/types/BufferPool.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+BufferPoolTest::BufferPoolTest()
+    : ::testing::Test()
+{
+}
+
+BufferPoolTest::~BufferPoolTest()
+{
+}
+
+void BufferPoolTest::SetUp()
+{
+}
+
+void BufferPoolTest::TearDown()
+{
+}
+
+TEST_F(BufferPoolTest, test_recycle)
+{
+    typedef BufferPool<TimeFrequency<uint16_t>> PoolType;
+    PoolType pool;
+    DimensionSize<units::Time> const spectra(10);
+    DimensionSize<units::Frequency> const channels(8);
+
+    uint16_t const* address = nullptr;
+    {
+        auto data = pool.acquire(spectra, channels);
+        ASSERT_EQ(spectra, data->dimension<units::Time>());
+        ASSERT_EQ(channels, data->dimension<units::Frequency>());
+        ASSERT_EQ(1U, pool.outstanding());
+        ASSERT_EQ(0U, pool.available());
+        std::fill(data->begin(), data->end(), 5);
+        address = &*data->begin();
+    }
+    ASSERT_EQ(0U, pool.outstanding());
+    ASSERT_EQ(1U, pool.available());
+
+    // same shape (specified in either order) should reuse the block, value initialised
+    auto data = pool.acquire(channels, spectra);
+    ASSERT_EQ(address, &*data->begin());
+    ASSERT_TRUE(std::all_of(data->begin(), data->end(), [](uint16_t v) { return v == 0; }));
+    ASSERT_EQ(1U, pool.hits());
+    ASSERT_EQ(1U, pool.misses());
+    ASSERT_DOUBLE_EQ(0.5, pool.hit_rate());
+
+    // a different shape requires a new block
+    auto data_2 = pool.acquire(DimensionSize<units::Time>(11), channels);
+    ASSERT_NE(address, &*data_2->begin());
+    ASSERT_EQ(2U, pool.misses());
+    ASSERT_EQ(2U, pool.outstanding());
+}
+
+TEST_F(BufferPoolTest, test_no_initialisation)
+{
+    typedef BufferPool<FrequencyTime<uint8_t>> PoolType;
+    PoolType pool(PoolType::Initialisation::None);
+    {
+        auto data = pool.acquire(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+        std::fill(data->begin(), data->end(), 7);
+    }
+    auto data = pool.acquire(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+    ASSERT_TRUE(std::all_of(data->begin(), data->end(), [](uint8_t v) { return v == 7; }));
+}
+
+TEST_F(BufferPoolTest, test_release_after_pool_destroyed)
+{
+    typedef BufferPool<TimeFrequency<uint8_t>> PoolType;
+    PoolType::BufferType data;
+    {
+        PoolType pool;
+        data = pool.acquire(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(4));
+        pool.clear();
+    }
+    ASSERT_EQ(16U, data->data_size());
+    data.reset();
+}
+
+TEST_F(BufferPoolTest, test_multithreaded)
+{
+    typedef BufferPool<TimeFrequency<float>> PoolType;
+    PoolType pool;
+    unsigned const number_of_threads = 4;
+    unsigned const iterations = 1000;
+
+    std::vector<std::thread> threads;
+    for(unsigned t = 0; t < number_of_threads; ++t) {
+        threads.emplace_back([&]() {
+            for(unsigned i = 0; i < iterations; ++i) {
+                auto data = pool.acquire(DimensionSize<units::Time>(16), DimensionSize<units::Frequency>(16));
+                std::fill(data->begin(), data->end(), 1.0f);
+            }
+        });
+    }
+    for(auto& thread : threads) thread.join();
+
+    ASSERT_EQ(0U, pool.outstanding());
+    ASSERT_EQ(number_of_threads * iterations, pool.hits() + pool.misses());
+    ASSERT_GE(number_of_threads, pool.misses());
+    ASSERT_EQ(pool.misses(), pool.available());
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
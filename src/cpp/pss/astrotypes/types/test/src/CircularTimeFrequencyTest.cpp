@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../CircularTimeFrequencyTest.h"
+#include "pss/astrotypes/types/CircularTimeFrequency.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+CircularTimeFrequencyTest::CircularTimeFrequencyTest()
+    : ::testing::Test()
+{
+}
+
+CircularTimeFrequencyTest::~CircularTimeFrequencyTest()
+{
+}
+
+void CircularTimeFrequencyTest::SetUp()
+{
+}
+
+void CircularTimeFrequencyTest::TearDown()
+{
+}
+
+namespace {
+// a block of spectra with each value identifying its spectrum (s) and channel (c) as s * 100 + c
+TimeFrequency<int> make_spectra(std::size_t first_spectrum, std::size_t number_of_spectra, std::size_t number_of_channels)
+{
+    TimeFrequency<int> data((DimensionSize<units::Time>(number_of_spectra)), DimensionSize<units::Frequency>(number_of_channels));
+    for(std::size_t s = 0; s < number_of_spectra; ++s) {
+        auto spectrum = data.spectrum(s);
+        int c = 0;
+        for(auto& value : spectrum) {
+            value = static_cast<int>(first_spectrum + s) * 100 + c++;
+        }
+    }
+    return data;
+}
+
+// check the window holds the spectra [first_spectrum, first_spectrum + window.number_of_spectra())
+template<typename WindowT>
+void verify_window(WindowT const& window, std::size_t first_spectrum)
+{
+    std::size_t const channels = window.number_of_channels();
+    std::size_t i = 0;
+    for(auto const& value : window) {
+        ASSERT_EQ(static_cast<int>((first_spectrum + i / channels) * 100 + i % channels), value) << "element " << i;
+        ++i;
+    }
+    ASSERT_EQ(window.data_size(), i);
+    for(std::size_t s = 0; s < window.number_of_spectra(); ++s) {
+        ASSERT_EQ(static_cast<int>((first_spectrum + s) * 100), *window.spectrum(s).begin());
+    }
+}
+} // namespace
+
+TEST_F(CircularTimeFrequencyTest, test_push)
+{
+    CircularTimeFrequency<int> ring(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(4));
+    ASSERT_TRUE(ring.empty());
+    ASSERT_EQ(10U, ring.capacity());
+    ASSERT_EQ(4U, ring.number_of_channels());
+
+    ring.push(make_spectra(0, 6, 4));
+    ASSERT_EQ(6U, ring.number_of_spectra());
+    ASSERT_FALSE(ring.full());
+    verify_window(ring.window(), 0);
+
+    // overwrite the oldest
+    ring.push(make_spectra(6, 7, 4));
+    ASSERT_TRUE(ring.full());
+    ASSERT_EQ(10U, ring.number_of_spectra());
+    verify_window(ring.window(), 3);
+
+    // more than the capacity in one go
+    ring.push(make_spectra(13, 25, 4));
+    ASSERT_EQ(10U, ring.number_of_spectra());
+    verify_window(ring.window(), 28);
+
+    ring.clear();
+    ASSERT_TRUE(ring.empty());
+    ASSERT_EQ(0U, ring.window().data_size());
+}
+
+TEST_F(CircularTimeFrequencyTest, test_push_wrong_channels)
+{
+    CircularTimeFrequency<int> ring(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(4));
+    ASSERT_THROW(ring.push(make_spectra(0, 2, 5)), std::invalid_argument);
+    ASSERT_TRUE(ring.empty());
+}
+
+TEST_F(CircularTimeFrequencyTest, test_push_frequency_time)
+{
+    CircularTimeFrequency<int> ring(DimensionSize<units::Time>(4), DimensionSize<units::Frequency>(3));
+    FrequencyTime<int> data(make_spectra(0, 5, 3));
+    ring.push(data);
+    verify_window(ring.window(), 1);
+}
+
+TEST_F(CircularTimeFrequencyTest, test_wrapped_window)
+{
+    CircularTimeFrequency<int> ring(DimensionSize<units::Time>(8), DimensionSize<units::Frequency>(3));
+    ring.push(make_spectra(0, 5, 3));
+    ring.push(make_spectra(5, 8, 3)); // oldest held is spectrum 5 at physical position 5
+
+    auto const& const_ring = ring;
+    auto window = const_ring.window(DimensionIndex<units::Time>(1), DimensionSize<units::Time>(6));
+    ASSERT_EQ(6U, window.number_of_spectra());
+    ASSERT_EQ(DimensionSize<units::Time>(6), window.dimension<units::Time>());
+    ASSERT_EQ(DimensionSize<units::Frequency>(3), window.dimension<units::Frequency>());
+    verify_window(window, 6);
+
+    // random access across the wrap
+    auto it = window.begin();
+    ASSERT_EQ(18, window.end() - it);
+    ASSERT_EQ(900, it[9]);
+    it += 10;
+    ASSERT_EQ(901, *it);
+    --it;
+    ASSERT_EQ(900, *it);
+    it -= 9;
+    ASSERT_EQ(600, *it);
+    ASSERT_TRUE(it == window.begin());
+
+    // two contiguous runs, split at the physical end
+    std::vector<std::size_t> runs;
+    window.for_each_contiguous_run([&](int const* begin, int const* end)
+                                   {
+                                       runs.push_back(end - begin);
+                                   });
+    ASSERT_EQ(2U, runs.size());
+    ASSERT_EQ(6U, runs[0]); // physical spectra 6 and 7
+    ASSERT_EQ(12U, runs[1]);
+
+    ASSERT_THROW(const_ring.window(DimensionIndex<units::Time>(3), DimensionSize<units::Time>(6)), std::out_of_range);
+}
+
+TEST_F(CircularTimeFrequencyTest, test_head_commit)
+{
+    CircularTimeFrequency<int> ring(DimensionSize<units::Time>(8), DimensionSize<units::Frequency>(2));
+    ring.push(make_spectra(0, 6, 2));
+
+    // only 2 spectra before the physical end
+    auto head = ring.head(DimensionSize<units::Time>(5));
+    ASSERT_EQ(DimensionSize<units::Time>(2), head.dimension<units::Time>());
+    auto const data = make_spectra(6, 2, 2);
+    std::copy(data.begin(), data.end(), head.begin());
+    ASSERT_EQ(6U, ring.number_of_spectra()); // nothing added until commit
+    ring.commit(head.dimension<units::Time>());
+    ASSERT_TRUE(ring.full());
+
+    head = ring.head(DimensionSize<units::Time>(3));
+    ASSERT_EQ(DimensionSize<units::Time>(3), head.dimension<units::Time>());
+    auto const data_2 = make_spectra(8, 3, 2);
+    std::copy(data_2.begin(), data_2.end(), head.begin());
+    ring.commit(DimensionSize<units::Time>(3));
+    verify_window(ring.window(), 3);
+
+    ASSERT_THROW(ring.commit(DimensionSize<units::Time>(6)), std::out_of_range);
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
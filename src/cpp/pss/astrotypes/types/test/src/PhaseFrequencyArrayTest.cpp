@@ -26,6 +26,7 @@
 #include "pss/astrotypes/types/test/PhaseFrequencyArrayTest.h"
 //#include "cheetah/data/Units.h"
 #include <type_traits>
+#include <algorithm>
 #include <numeric>
 
 namespace pss {
@@ -167,6 +168,38 @@ TYPED_TEST(PhaseFrequencyArrayTest, test_phase_bin_iterator)
     IteratorAssignmentHelper<TypeParam>::exec(channel_array);
 }
 
+//------------------------------- RANGES -------------------------------//
+
+// Test that channels() and phase_bins() step through every slice in order
+TYPED_TEST(PhaseFrequencyArrayTest, test_channel_and_phase_bin_ranges)
+{
+    typedef typename TypeParam::value_type ValueType;
+    auto& data = *this->_phase_frequency_array;
+
+    // mark each channel with its number (modulo the range of the smallest type)
+    std::size_t channel_number = 0;
+    for(auto& channel : data.channels()) {
+        ASSERT_EQ(channel.number_of_phase_bins(), 256);
+        std::fill(channel.begin(), channel.end(), static_cast<ValueType>(channel_number % 200));
+        ++channel_number;
+    }
+    ASSERT_EQ(4096U, channel_number);
+
+    auto const& const_data = data;
+    std::size_t phase_bin_number = 0;
+    for(auto const& phase_bin : const_data.phase_bins()) {
+        ASSERT_EQ(phase_bin.number_of_channels(), 4096);
+        std::size_t c = 0;
+        for(auto const& value : phase_bin) {
+            ASSERT_EQ(static_cast<ValueType>(c % 200), value) << phase_bin_number << ", " << c;
+            ++c;
+        }
+        ++phase_bin_number;
+    }
+    ASSERT_EQ(256U, phase_bin_number);
+    ASSERT_EQ(static_cast<ValueType>(17), *const_data.channels()[DimensionIndex<units::Frequency>(17)].begin());
+}
+
 } // namespace test
 } // namespace types
 } // namespace astrotypes
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../PolarisationTimeFrequencyTest.h"
+#include "pss/astrotypes/types/PolarisationTimeFrequency.h"
+#include "pss/astrotypes/types/Stokes.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+PolarisationTimeFrequencyTest::PolarisationTimeFrequencyTest()
+    : ::testing::Test()
+{
+}
+
+PolarisationTimeFrequencyTest::~PolarisationTimeFrequencyTest()
+{
+}
+
+void PolarisationTimeFrequencyTest::SetUp()
+{
+}
+
+void PolarisationTimeFrequencyTest::TearDown()
+{
+}
+
+TEST_F(PolarisationTimeFrequencyTest, test_polarisation_blocks)
+{
+    PolarisationTimeFrequency<uint16_t> data(DimensionSize<units::Time>(5), DimensionSize<units::Polarisation>(3), DimensionSize<units::Frequency>(4));
+    ASSERT_EQ(5U, data.number_of_spectra());
+    ASSERT_EQ(3U, data.number_of_polarisations());
+    ASSERT_EQ(4U, data.number_of_channels());
+
+    uint16_t n = 0;
+    std::generate(data.begin(), data.end(), [&]() { return n++; });
+
+    // each spectrum holds a contiguous block of channels for each polarisation
+    for(std::size_t pol = 0; pol < 3; ++pol) {
+        auto const block = data.polarisation(pol);
+        ASSERT_EQ(5U, block.dimension<units::Time>());
+        ASSERT_EQ(1U, block.dimension<units::Polarisation>());
+        ASSERT_EQ(4U, block.dimension<units::Frequency>());
+        for(std::size_t t = 0; t < 5; ++t) {
+            for(std::size_t f = 0; f < 4; ++f) {
+                ASSERT_EQ((t * 3 + pol) * 4 + f, (block[DimensionIndex<units::Time>(t)][DimensionIndex<units::Polarisation>(0)][DimensionIndex<units::Frequency>(f)]));
+            }
+        }
+    }
+    auto const spectrum = data.spectrum(2);
+    ASSERT_EQ(12U, std::distance(spectrum.begin(), spectrum.end()));
+    ASSERT_EQ(24U, *spectrum.begin());
+}
+
+TEST_F(PolarisationTimeFrequencyTest, test_deinterleave)
+{
+    TimeFrequency<std::array<uint8_t, 4>> interleaved(DimensionSize<units::Time>(6), DimensionSize<units::Frequency>(9));
+    uint8_t n = 0;
+    for(auto& value : interleaved) {
+        for(auto& pol : value) pol = n++;
+    }
+
+    PolarisationTimeFrequency<uint8_t> data;
+    deinterleave(interleaved, data);
+    ASSERT_EQ(6U, data.number_of_spectra());
+    ASSERT_EQ(4U, data.number_of_polarisations());
+    ASSERT_EQ(9U, data.number_of_channels());
+    for(std::size_t pol = 0; pol < 4; ++pol) {
+        for(std::size_t t = 0; t < 6; ++t) {
+            for(std::size_t f = 0; f < 9; ++f) {
+                ASSERT_EQ((interleaved[DimensionIndex<units::Time>(t)][DimensionIndex<units::Frequency>(f)][pol])
+                         , (data.polarisation(pol)[DimensionIndex<units::Time>(t)][DimensionIndex<units::Polarisation>(0)][DimensionIndex<units::Frequency>(f)]));
+            }
+        }
+    }
+
+    // runtime number of polarisations, including the generic case
+    std::vector<uint8_t> in(3 * 5);
+    std::generate(in.begin(), in.end(), [&]() { return n++; });
+    std::vector<uint8_t> out(3 * 5);
+    uint8_t* pols[] = { &out[0], &out[5], &out[10] };
+    deinterleave(in.data(), 5, 3, pols);
+    std::vector<uint8_t> round_trip(3 * 5);
+    uint8_t const* const_pols[] = { pols[0], pols[1], pols[2] };
+    interleave(const_pols, 5, 3, round_trip.data());
+    ASSERT_EQ(in, round_trip);
+    ASSERT_EQ(in[4], out[6]);
+}
+
+TEST_F(PolarisationTimeFrequencyTest, test_stokes_i)
+{
+    TimeFrequency<std::array<uint8_t, 2>> interleaved(DimensionSize<units::Time>(10), DimensionSize<units::Frequency>(16));
+    uint8_t n = 200;
+    for(auto& value : interleaved) {
+        value[0] = n++;
+        value[1] = 255;
+    }
+
+    // fused from the interleaved data
+    TimeFrequency<uint16_t> fused;
+    stokes_i(interleaved, fused);
+    ASSERT_EQ(10U, fused.number_of_spectra());
+    ASSERT_EQ(16U, fused.number_of_channels());
+    auto it = interleaved.cbegin();
+    for(auto const& value : fused) {
+        ASSERT_EQ((*it)[0] + (*it)[1], value); // no overflow in the wider output type
+        ++it;
+    }
+
+    // from the deinterleaved data
+    PolarisationTimeFrequency<uint8_t> data;
+    deinterleave(interleaved, data);
+    TimeFrequency<uint16_t> stokes(DimensionSize<units::Time>(1), DimensionSize<units::Frequency>(1));
+    stokes_i(data, stokes);
+    ASSERT_TRUE(fused == stokes);
+}
+
+TEST_F(PolarisationTimeFrequencyTest, test_full_stokes)
+{
+    PolarisationTimeFrequency<uint8_t> coherency(DimensionSize<units::Time>(3), DimensionSize<units::Polarisation>(4), DimensionSize<units::Frequency>(5));
+    std::fill(coherency.polarisation(0).begin(), coherency.polarisation(0).end(), 10);
+    std::fill(coherency.polarisation(1).begin(), coherency.polarisation(1).end(), 30);
+    std::fill(coherency.polarisation(2).begin(), coherency.polarisation(2).end(), 4);
+    std::fill(coherency.polarisation(3).begin(), coherency.polarisation(3).end(), 7);
+
+    PolarisationTimeFrequency<float> stokes;
+    full_stokes(coherency, stokes);
+    ASSERT_EQ(4U, stokes.number_of_polarisations());
+    float const expected[] = { 40.0f, -20.0f, 8.0f, 14.0f };
+    for(std::size_t pol = 0; pol < 4; ++pol) {
+        auto const block = stokes.polarisation(pol);
+        ASSERT_TRUE(std::all_of(block.begin(), block.end(), [&](float v) { return v == expected[pol]; })) << pol;
+    }
+
+    PolarisationTimeFrequency<uint8_t> dual(DimensionSize<units::Time>(3), DimensionSize<units::Polarisation>(2), DimensionSize<units::Frequency>(5));
+    ASSERT_THROW(full_stokes(dual, stokes), std::invalid_argument);
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
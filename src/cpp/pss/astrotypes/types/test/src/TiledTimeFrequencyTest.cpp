@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018 PulsarSearchSoft
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "../TiledTimeFrequencyTest.h"
+#include "pss/astrotypes/types/TiledTimeFrequency.h"
+#include "pss/astrotypes/types/TimeFrequency.h"
+#include <algorithm>
+
+
+namespace pss {
+namespace astrotypes {
+namespace test {
+
+
+TiledTimeFrequencyTest::TiledTimeFrequencyTest()
+    : ::testing::Test()
+{
+}
+
+TiledTimeFrequencyTest::~TiledTimeFrequencyTest()
+{
+}
+
+void TiledTimeFrequencyTest::SetUp()
+{
+}
+
+void TiledTimeFrequencyTest::TearDown()
+{
+}
+
+TEST_F(TiledTimeFrequencyTest, test_spectra_and_channels)
+{
+    TimeFrequency<uint16_t> tf(DimensionSize<units::Time>(100), DimensionSize<units::Frequency>(70));
+    uint16_t n = 0;
+    std::generate(tf.begin(), tf.end(), [&]() { return n++; });
+
+    TiledTimeFrequency<uint16_t, multiarray::TileLayout<16, 32>> tiled(tf);
+    ASSERT_EQ(tf.number_of_spectra(), tiled.number_of_spectra());
+    ASSERT_EQ(tf.number_of_channels(), tiled.number_of_channels());
+
+    for(std::size_t i = 0; i < 100; ++i) {
+        auto const expected = tf.spectrum(i);
+        auto const spectrum = tiled.spectrum(i);
+        ASSERT_TRUE(std::equal(spectrum.begin(), spectrum.end(), expected.begin())) << i;
+    }
+    for(std::size_t i = 0; i < 70; ++i) {
+        auto const expected = tf.channel(i);
+        auto const channel = tiled.channel(i);
+        ASSERT_TRUE(std::equal(channel.cbegin(), channel.cend(), expected.begin())) << i;
+    }
+
+    // round trip through a FrequencyTime
+    FrequencyTime<uint16_t> ft(DimensionSize<units::Time>(100), DimensionSize<units::Frequency>(70));
+    tiled.copy_to(ft);
+    ASSERT_TRUE(FrequencyTime<uint16_t>(tf) == ft);
+}
+
+} // namespace test
+} // namespace astrotypes
+} // namespace pss
@@ -23,6 +23,13 @@
  */
 #include "pss/astrotypes/types/test/TimeFrequencyTest.h"
 #include "pss/astrotypes/types/TimeFrequency.h"
+#include "pss/astrotypes/multiarray/Reduce.h"
+#include "pss/astrotypes/multiarray/View.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 
 using namespace pss::astrotypes::units;
@@ -335,6 +342,186 @@ TEST_F(TimeFrequencyTest, test_freq_time_slice_has_exact_dimensions)
     static_assert(std::is_same<std::true_type, typename has_exact_dimensions<FrequencyTime<double>::Channel, units::Time>::type>::value, "expecting true");
 }
 
+TEST_F(TimeFrequencyTest, test_time_freq_append_spectra)
+{
+    TimeFrequency<uint16_t> block(DimensionSize<Time>(4), DimensionSize<Frequency>(10));
+    uint16_t n = 0;
+    std::generate(block.begin(), block.end(), [&]() { return n++; });
+
+    // accumulate spectra one at a time into an initially empty object
+    TimeFrequency<uint16_t> accumulator;
+    accumulator.reserve(DimensionSize<Time>(2), DimensionSize<Frequency>(10));
+    accumulator.append(block.spectrum(0));
+    ASSERT_EQ(DimensionSize<Time>(2), accumulator.capacity<Time>());
+    for(std::size_t i = 1; i < 20; ++i) {
+        accumulator.append(block.spectrum(i % 4));
+    }
+    accumulator.append(block);
+    ASSERT_EQ(DimensionSize<Time>(24), accumulator.number_of_spectra());
+    ASSERT_EQ(DimensionSize<Frequency>(10), accumulator.number_of_channels());
+    ASSERT_LE(24U, static_cast<std::size_t>(accumulator.capacity<Time>()));
+    for(std::size_t i = 0; i < 24; ++i) {
+        auto const spectrum = accumulator.spectrum(i);
+        auto const expected = block.spectrum(i % 4);
+        ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), spectrum.cbegin())) << i;
+    }
+
+    TimeFrequency<uint16_t> other(DimensionSize<Time>(1), DimensionSize<Frequency>(5));
+    ASSERT_THROW(accumulator.append(other.spectrum(0)), std::invalid_argument);
+}
+
+TEST_F(TimeFrequencyTest, test_no_initialisation_constructor)
+{
+    TimeFrequency<uint8_t> tf(NoInitialisation(), DimensionSize<Time>(10), DimensionSize<Frequency>(20));
+    ASSERT_EQ(DimensionSize<Time>(10), tf.number_of_spectra());
+    ASSERT_EQ(DimensionSize<Frequency>(20), tf.number_of_channels());
+    ASSERT_EQ(200U, tf.data_size());
+
+    FrequencyTime<uint8_t> ft(NoInitialisation(), DimensionSize<Time>(10), DimensionSize<Frequency>(20));
+    ASSERT_EQ(DimensionSize<Time>(10), ft.number_of_spectra());
+    ASSERT_EQ(DimensionSize<Frequency>(20), ft.number_of_channels());
+}
+
+TEST_F(TimeFrequencyTest, test_view_band_flip_materialise)
+{
+    TimeFrequency<uint16_t> tf(DimensionSize<Time>(10), DimensionSize<Frequency>(32));
+    std::iota(tf.begin(), tf.end(), 0);
+
+    // flip the band and drop a flagged channel
+    std::vector<bool> flags(32, false);
+    flags[3] = true;
+    auto flagged = multiarray::IndexMapper<Frequency>::exclude_flagged(flags);
+    std::vector<std::size_t> table;
+    for(std::size_t i = flagged.size(); i > 0; --i) table.push_back(flagged(i - 1));
+    auto view = multiarray::make_view(tf, multiarray::IndexMapper<Frequency>(table));
+
+    auto const flipped = view.materialise<TimeFrequency<uint16_t>>();
+    ASSERT_EQ(DimensionSize<Time>(10), flipped.number_of_spectra());
+    ASSERT_EQ(DimensionSize<Frequency>(31), flipped.number_of_channels());
+    for(std::size_t t = 0; t < 10; ++t) {
+        for(std::size_t f = 0; f < 31; ++f) {
+            std::size_t const source_channel = (f < 28) ? 31 - f : 30 - f;
+            ASSERT_EQ(tf[DimensionIndex<Time>(t)][DimensionIndex<Frequency>(source_channel)]
+                    , flipped[DimensionIndex<Time>(t)][DimensionIndex<Frequency>(f)]) << t << ", " << f;
+        }
+    }
+}
+
+TEST_F(TimeFrequencyTest, test_spectra_and_channel_ranges)
+{
+    TimeFrequency<uint16_t> tf(DimensionSize<Time>(10), DimensionSize<Frequency>(32));
+    std::iota(tf.begin(), tf.end(), 0);
+    FrequencyTime<uint16_t> ft(tf);
+
+    std::size_t spectrum_number = 0;
+    for(auto const& spectrum : tf.spectra()) {
+        auto expected = ft.spectrum(spectrum_number);
+        ASSERT_EQ(32U, spectrum.data_size());
+        ASSERT_TRUE(std::equal(spectrum.begin(), spectrum.end(), expected.begin())) << spectrum_number;
+        ++spectrum_number;
+    }
+    ASSERT_EQ(10U, spectrum_number);
+    ASSERT_EQ(10U, static_cast<std::size_t>(ft.spectra().size()));
+
+    std::size_t channel_number = 0;
+    for(auto const& channel : ft.channels()) {
+        auto expected = tf.channel(channel_number);
+        ASSERT_EQ(10U, channel.data_size());
+        ASSERT_TRUE(std::equal(channel.begin(), channel.end(), expected.begin())) << channel_number;
+        ++channel_number;
+    }
+    ASSERT_EQ(32U, channel_number);
+
+    // modify through the range
+    for(auto& channel : tf.channels()) {
+        std::fill(channel.begin(), channel.end(), 0);
+        break;
+    }
+    ASSERT_EQ(0U, *tf.spectrum(9).begin());
+    ASSERT_EQ(9U * 32U + 1U, *(tf.spectrum(9).begin() + 1));
+
+    // ranges over a slice
+    TimeFrequency<uint16_t> const& const_tf = tf;
+    auto block = const_tf.slice(DimensionSpan<Time>(DimensionIndex<Time>(2), DimensionSize<Time>(3))
+                              , DimensionSpan<Frequency>(DimensionIndex<Frequency>(4), DimensionSize<Frequency>(8)));
+    spectrum_number = 0;
+    for(auto const& spectrum : block.spectra()) {
+        ASSERT_EQ(8U, spectrum.data_size());
+        ASSERT_EQ((spectrum_number + 2) * 32 + 4, *spectrum.begin());
+        ++spectrum_number;
+    }
+    ASSERT_EQ(3U, spectrum_number);
+    channel_number = 0;
+    for(auto const& channel : block.channels()) {
+        ASSERT_EQ(3U, channel.data_size());
+        ASSERT_EQ(2 * 32 + 4 + channel_number, *channel.begin());
+        ++channel_number;
+    }
+    ASSERT_EQ(8U, channel_number);
+
+    // ranges over a strided slice
+    auto every_other = const_tf.slice(DimensionSpan<Time>(DimensionIndex<Time>(1), DimensionSize<Time>(4), 2));
+    spectrum_number = 0;
+    for(auto const& spectrum : every_other.spectra()) {
+        ASSERT_EQ((2 * spectrum_number + 1) * 32 + 1, *(spectrum.begin() + 1));
+        ++spectrum_number;
+    }
+    ASSERT_EQ(4U, spectrum_number);
+}
+
+TEST_F(TimeFrequencyTest, test_zero_dm_and_bandpass)
+{
+    TimeFrequency<uint8_t> tf(DimensionSize<Time>(50), DimensionSize<Frequency>(64));
+    std::size_t n = 0;
+    std::generate(tf.begin(), tf.end(), [&n]() { return static_cast<uint8_t>(n++ % 251); });
+    FrequencyTime<uint8_t> ft(tf);
+
+    // zero-DM time series
+    auto zero_dm = multiarray::reduce<Frequency>(tf);
+    auto ft_zero_dm = multiarray::reduce<Frequency>(ft);
+    static_assert(std::is_same<decltype(zero_dm), multiarray::ReducedArray<uint32_t, Time>>::value, "unexpected type");
+    ASSERT_EQ(DimensionSize<Time>(50), zero_dm.dimension<Time>());
+    for(DimensionIndex<Time> t(0); t < 50; ++t) {
+        auto const spectrum = tf.spectrum(t);
+        ASSERT_EQ(std::accumulate(spectrum.begin(), spectrum.end(), 0U), zero_dm[t]);
+        ASSERT_EQ(zero_dm[t], ft_zero_dm[t]);
+    }
+
+    // bandpass
+    auto bandpass = multiarray::mean<Time>(tf);
+    auto ft_bandpass = multiarray::mean<Time>(ft);
+    static_assert(std::is_same<decltype(bandpass), multiarray::ReducedArray<float, Frequency>>::value, "unexpected type");
+    ASSERT_EQ(DimensionSize<Frequency>(64), bandpass.dimension<Frequency>());
+    for(DimensionIndex<Frequency> f(0); f < 64; ++f) {
+        auto const channel = tf.channel(f);
+        ASSERT_FLOAT_EQ(std::accumulate(channel.begin(), channel.end(), 0U) / 50.0f, bandpass[f]);
+        ASSERT_FLOAT_EQ(bandpass[f], ft_bandpass[f]);
+    }
+}
+
+TEST_F(TimeFrequencyTest, test_static_number_of_channels)
+{
+    typedef TimeFrequency<uint8_t, std::allocator<uint8_t>, 16> StaticTimeFrequency;
+    static_assert(has_exact_dimensions<StaticTimeFrequency, Time, Frequency>::value, "expecting the Frequency tag");
+
+    StaticTimeFrequency tf(DimensionSize<Time>(10), DimensionSize<Frequency>(16));
+    ASSERT_EQ(16U, tf.number_of_channels());
+    ASSERT_EQ(10U, tf.number_of_spectra());
+    ASSERT_EQ(16U, tf.spectrum(3).data_size());
+    ASSERT_THROW(StaticTimeFrequency(DimensionSize<Time>(10), DimensionSize<Frequency>(8)), std::invalid_argument);
+
+    // a runtime sized block of any size can still be used alongside
+    TimeFrequency<uint8_t> runtime_tf(DimensionSize<Time>(10), DimensionSize<Frequency>(8));
+    ASSERT_EQ(8U, runtime_tf.number_of_channels());
+
+    // transpose to a static FrequencyTime
+    std::iota(tf.begin(), tf.end(), 0);
+    FrequencyTime<uint8_t, std::allocator<uint8_t>, 16> ft(tf);
+    ASSERT_EQ(16U, ft.number_of_channels());
+    ASSERT_EQ(10U, ft.number_of_spectra());
+    ASSERT_TRUE(std::equal(tf.spectrum(3).begin(), tf.spectrum(3).end(), ft.spectrum(3).begin()));
+}
+
 } // namespace test
 } // namespace astrotypes
 } // namespace pss